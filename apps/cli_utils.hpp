@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/synthesis_server.hpp"
+#include "core/properties.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace syrec::cli {
+    /**
+     * Parse a setting given as '<key>=<value>' on the command line.
+     *
+     * The values 'true' and 'false' are parsed as booleans and non-negative integers as unsigned values while all other values are kept as strings.
+     * @param setting The setting in the format '<key>=<value>'
+     * @return The key and the value of the setting or std::nullopt if the setting is malformed
+     */
+    inline std::optional<std::pair<std::string, SynthesisRequest::SettingValue>> parseSetting(const std::string& setting) {
+        const auto separatorPos = setting.find('=');
+        if (separatorPos == std::string::npos || separatorPos == 0) {
+            return std::nullopt;
+        }
+
+        std::string key   = setting.substr(0, separatorPos);
+        std::string value = setting.substr(separatorPos + 1);
+        if (value == "true" || value == "false") {
+            return std::make_pair(std::move(key), SynthesisRequest::SettingValue(value == "true"));
+        }
+        if (!value.empty() && value.size() <= 9 && std::all_of(value.cbegin(), value.cend(), [](const char c) { return c >= '0' && c <= '9'; })) {
+            return std::make_pair(std::move(key), SynthesisRequest::SettingValue(static_cast<unsigned>(std::stoul(value))));
+        }
+        return std::make_pair(std::move(key), SynthesisRequest::SettingValue(std::move(value)));
+    }
+
+    /**
+     * Parse a setting given as '<key>=<value>' on the command line and store it in the settings.
+     *
+     * @param settings The settings to which the parsed setting is added
+     * @param setting The setting in the format '<key>=<value>'
+     * @return Whether the setting was well-formed
+     */
+    inline bool parseSetting(Properties& settings, const std::string& setting) {
+        const auto parsedSetting = parseSetting(setting);
+        if (!parsedSetting.has_value()) {
+            return false;
+        }
+        std::visit([&](const auto& value) { settings.set(parsedSetting->first, value); }, parsedSetting->second);
+        return true;
+    }
+} // namespace syrec::cli
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "cli_utils.hpp"
+#include "core/properties.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    void printUsage(std::ostream& os) {
+        os << "Usage: mqt-syrec-batch [options] <program.src>...\n"
+           << "\n"
+           << "Synthesizes SyReC programs concurrently and writes the report circuits_<scheme>_synthesis.json per synthesis scheme.\n"
+           << "\n"
+           << "Options:\n"
+           << "  -s, --scheme <cost_aware|line_aware>  Synthesis scheme, can be given multiple times (default: cost_aware)\n"
+           << "  -j, --threads <n>                     Number of worker threads (default: 0, i.e. one per hardware thread)\n"
+           << "  -o, --output-dir <dir>                Directory to which the reports are written (default: current directory)\n"
+           << "  -l, --file-list <file>                File containing further programs to synthesize, one per line\n"
+           << "      --setting <key>=<value>           Setting passed to the synthesis, 'true' and 'false' are passed as booleans\n"
+           << "                                        and non-negative integers as unsigned values while all other values are passed as strings\n"
+           << "  -h, --help                            Print this help message\n";
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::vector<std::string> args(argv + 1, argv + argc);
+
+    std::vector<SynthesisScheme> schemes;
+    std::vector<std::string>     filenames;
+    std::filesystem::path        outputDir = ".";
+    unsigned                     nThreads  = 0;
+    const auto                   settings  = std::make_shared<Properties>();
+
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& arg           = args[i];
+        const bool         hasNextOption = i + 1 < args.size();
+        if (arg == "-h" || arg == "--help") {
+            printUsage(std::cout);
+            return 0;
+        }
+        if ((arg == "-s" || arg == "--scheme") && hasNextOption) {
+            const auto scheme = getSynthesisSchemeByName(args[++i]);
+            if (!scheme.has_value()) {
+                std::cerr << "Unknown synthesis scheme " << args[i] << "\n";
+                return 2;
+            }
+            if (std::find(schemes.cbegin(), schemes.cend(), *scheme) == schemes.cend()) {
+                schemes.emplace_back(*scheme);
+            }
+        } else if ((arg == "-j" || arg == "--threads") && hasNextOption) {
+            try {
+                nThreads = static_cast<unsigned>(std::stoul(args[++i]));
+            } catch (const std::exception&) {
+                std::cerr << "Invalid number of threads " << args[i] << "\n";
+                return 2;
+            }
+        } else if ((arg == "-o" || arg == "--output-dir") && hasNextOption) {
+            outputDir = args[++i];
+        } else if ((arg == "-l" || arg == "--file-list") && hasNextOption) {
+            std::ifstream fileList(args[++i]);
+            if (!fileList.good()) {
+                std::cerr << "Could not open file list " << args[i] << "\n";
+                return 2;
+            }
+            for (std::string line; std::getline(fileList, line);) {
+                if (!line.empty()) {
+                    filenames.emplace_back(line);
+                }
+            }
+        } else if (arg == "--setting" && hasNextOption) {
+            if (!cli::parseSetting(*settings, args[++i])) {
+                std::cerr << "Invalid setting " << args[i] << ", expected <key>=<value>\n";
+                return 2;
+            }
+        } else if (!arg.empty() && arg.front() == '-') {
+            std::cerr << "Unknown or incomplete option " << arg << "\n";
+            printUsage(std::cerr);
+            return 2;
+        } else {
+            filenames.emplace_back(arg);
+        }
+    }
+
+    if (filenames.empty()) {
+        printUsage(std::cerr);
+        return 2;
+    }
+    if (schemes.empty()) {
+        schemes.emplace_back(SynthesisScheme::CostAware);
+    }
+
+    // A program given multiple times is only synthesized once
+    std::vector<std::string> uniqueFilenames;
+    for (const auto& filename: filenames) {
+        if (std::find(uniqueFilenames.cbegin(), uniqueFilenames.cend(), filename) == uniqueFilenames.cend()) {
+            uniqueFilenames.emplace_back(filename);
+        }
+    }
+    const auto names = getNamesOfBatchSynthesisPrograms(uniqueFilenames);
+
+    std::vector<BatchSynthesisJob> jobs;
+    jobs.reserve(schemes.size() * uniqueFilenames.size());
+    for (const auto scheme: schemes) {
+        for (std::size_t i = 0; i < uniqueFilenames.size(); ++i) {
+            jobs.emplace_back(BatchSynthesisJob{names[i], uniqueFilenames[i], scheme, settings});
+        }
+    }
+    const auto results = synthesizeBatch(jobs, nThreads);
+
+    bool allJobsOk = true;
+    for (const auto scheme: schemes) {
+        std::vector<BatchSynthesisResult> resultsOfScheme;
+        std::copy_if(results.cbegin(), results.cend(), std::back_inserter(resultsOfScheme), [scheme](const BatchSynthesisResult& result) { return result.scheme == scheme; });
+        for (const auto& result: resultsOfScheme) {
+            if (!result.ok) {
+                std::cerr << result.filename << " (" << getNameOfSynthesisScheme(scheme) << "): " << result.errorMessage << "\n";
+                allJobsOk = false;
+            }
+        }
+
+        const auto    reportFilename = outputDir / ("circuits_" + std::string(getNameOfSynthesisScheme(scheme)) + "_synthesis.json");
+        std::ofstream report(reportFilename);
+        if (!report.good()) {
+            std::cerr << "Could not write report " << reportFilename.string() << "\n";
+            return 2;
+        }
+        writeBatchSynthesisReport(report, resultsOfScheme);
+    }
+    return allJobsOk ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_server.hpp"
+
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    volatile std::sig_atomic_t stopRequested = 0;
+
+    void requestStop(int /*signal*/) {
+        stopRequested = 1;
+    }
+
+    void printUsage(std::ostream& os) {
+        os << "Usage: mqt-syrec-server [options] <socket>\n"
+           << "\n"
+           << "Synthesizes the SyReC programs and truth tables and imports the circuits sent by local clients (e.g. mqt-syrec --server <socket>)\n"
+           << "via the Unix domain socket until it is interrupted. Parsed modules, synthesized modules and recent results are kept between requests.\n"
+           << "\n"
+           << "Options:\n"
+           << "  -j, --threads <n>                     Number of worker threads serving the clients (default: 0, i.e. one per hardware thread)\n"
+           << "  -t, --idle-timeout <seconds>          Time after which the connection of a client that does not send any data is closed (default: 60)\n"
+           << "  -h, --help                            Print this help message\n";
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::vector<std::string> args(argv + 1, argv + argc);
+
+    std::string          socketPath;
+    std::size_t          nThreads    = 0;
+    std::chrono::seconds idleTimeout = std::chrono::duration_cast<std::chrono::seconds>(SynthesisServer::DEFAULT_IDLE_TIMEOUT);
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& arg           = args[i];
+        const bool         hasNextOption = i + 1 < args.size();
+        if (arg == "-h" || arg == "--help") {
+            printUsage(std::cout);
+            return 0;
+        }
+        if ((arg == "-j" || arg == "--threads") && hasNextOption) {
+            try {
+                nThreads = static_cast<std::size_t>(std::stoul(args[++i]));
+            } catch (const std::exception&) {
+                std::cerr << "Invalid number of threads " << args[i] << "\n";
+                return 2;
+            }
+        } else if ((arg == "-t" || arg == "--idle-timeout") && hasNextOption) {
+            try {
+                idleTimeout = std::chrono::seconds(std::stoul(args[++i]));
+            } catch (const std::exception&) {
+                std::cerr << "Invalid idle timeout " << args[i] << "\n";
+                return 2;
+            }
+        } else if (!arg.empty() && arg.front() == '-') {
+            std::cerr << "Unknown or incomplete option " << arg << "\n";
+            printUsage(std::cerr);
+            return 2;
+        } else if (socketPath.empty()) {
+            socketPath = arg;
+        } else {
+            std::cerr << "Only a single socket can be given\n";
+            return 2;
+        }
+    }
+
+    if (socketPath.empty()) {
+        printUsage(std::cerr);
+        return 2;
+    }
+
+    SynthesisServer server(socketPath, nThreads, idleTimeout);
+    if (const auto errorMessage = server.start(); !errorMessage.empty()) {
+        std::cerr << errorMessage << "\n";
+        return 1;
+    }
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+    std::cout << "Listening on " << socketPath << std::endl;
+
+    while (stopRequested == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    server.stop();
+    return 0;
+}
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_server.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "cli_utils.hpp"
+#include "core/circuit.hpp"
+#include "core/io/binary_circuit.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/io/quantum_computation_import.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/real/parser.hpp"
+#include "core/syrec/program.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "core/utils/timer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    void printUsage(std::ostream& os) {
+        os << "Usage: mqt-syrec [options] <input>\n"
+           << "\n"
+           << "Reads a SyReC program (.src), a truth table (.pla) or a circuit in the RevLib (.real) or binary circuit format (.bin).\n"
+           << "SyReC programs are synthesized with the selected synthesis scheme while truth tables are synthesized with the DD-based synthesis.\n"
+           << "\n"
+           << "Options:\n"
+           << "  -s, --scheme <cost_aware|line_aware>  Synthesis scheme for SyReC programs (default: cost_aware)\n"
+           << "      --dd-method <method>              DD-based synthesis method for truth tables, one of one_pass, coding or\n"
+           << "                                        coding_without_additional_line (default: one_pass). Only the one-pass synthesis\n"
+           << "                                        synthesizes the truth table without extending it to all input patterns\n"
+           << "      --setting <key>=<value>           Setting passed to the synthesis of SyReC programs, 'true' and 'false' are passed as booleans\n"
+           << "                                        and non-negative integers as unsigned values while all other values are passed as strings\n"
+           << "      --simulate <pattern>              Simulate the circuit for an input pattern, can be given multiple times. The pattern consists of\n"
+           << "                                        one value (0 or 1) per line or one value per non-constant line\n"
+           << "  -o, --output <file>                   Write the circuit to a file whose format (.qasm, .real or .bin) is determined by its extension\n"
+           << "      --server <socket>                 Synthesize or import the input by the synthesis server (mqt-syrec-server) listening on the\n"
+           << "                                        Unix domain socket instead of in this process\n"
+           << "  -q, --quiet                           Do not print the statistics of the circuit\n"
+           << "  -h, --help                            Print this help message\n";
+    }
+
+    std::string getLowercaseExtension(const std::string& filename) {
+        std::string extension = std::filesystem::path(filename).extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        return extension;
+    }
+
+    /**
+     * Execute a phase of the tool and record its run-time.
+     * @param phase The phase to execute, returning an error message that is empty on success
+     * @param runtime The run-time of the phase in seconds
+     * @return The error message of the phase
+     */
+    template<typename Phase>
+    std::string runPhase(const Phase& phase, double& runtime) {
+        const auto             statistics = std::make_shared<Properties>();
+        Timer<PropertiesTimer> timer;
+        timer.start(PropertiesTimer(statistics));
+        std::string errorMessage;
+        try {
+            errorMessage = phase();
+        } catch (const std::exception& e) {
+            errorMessage = e.what();
+        }
+        timer.stop();
+        runtime = statistics->get<double>("runtime", 0.);
+        return errorMessage;
+    }
+
+    std::string synthesizeTruthTable(Circuit& circ, TruthTable& tt, const DdSynthesisMethod method) {
+        const auto qc = DDSynthesizer::synthesizePla(std::move(tt), method);
+        if (qc == nullptr) {
+            return "DD-based synthesis of truth table failed";
+        }
+        return importQuantumComputation(circ, *qc) ? "" : "Circuit created by the DD-based synthesis contains unsupported operations";
+    }
+
+    std::string simulate(const Circuit& circ, const std::string& pattern) {
+        const auto& constants         = circ.getConstants();
+        const auto  nNonConstantLines = static_cast<std::size_t>(std::count(constants.cbegin(), constants.cend(), constant()));
+        if (pattern.size() != circ.getLines() && pattern.size() != nNonConstantLines) {
+            return "Expected input pattern " + pattern + " to consist of " + std::to_string(circ.getLines()) + " or " + std::to_string(nNonConstantLines) + " values";
+        }
+
+        NBitValuesContainer input(circ.getLines());
+        NBitValuesContainer output(circ.getLines());
+        std::size_t         patternIdx = 0;
+        for (std::size_t line = 0; line < circ.getLines(); ++line) {
+            if (pattern.size() != circ.getLines() && constants[line].has_value()) {
+                input.set(line, *constants[line]);
+            } else {
+                input.set(line, pattern[patternIdx++] == '1');
+            }
+        }
+        simpleSimulation(output, circ, input);
+        std::cout << input.stringify() << " -> " << output.stringify() << "\n";
+        return "";
+    }
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::vector<std::string> args(argv + 1, argv + argc);
+
+    std::string              inputFilename;
+    std::string              outputFilename;
+    std::vector<std::string> simulatedPatterns;
+    SynthesisScheme          scheme   = SynthesisScheme::CostAware;
+    DdSynthesisMethod        ddMethod = DdSynthesisMethod::OnePass;
+    bool                     quiet    = false;
+    const auto               settings = std::make_shared<Properties>();
+    std::string              serverSocket;
+
+    std::map<std::string, SynthesisRequest::SettingValue> requestSettings;
+
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        const std::string& arg           = args[i];
+        const bool         hasNextOption = i + 1 < args.size();
+        if (arg == "-h" || arg == "--help") {
+            printUsage(std::cout);
+            return 0;
+        }
+        if ((arg == "-s" || arg == "--scheme") && hasNextOption) {
+            const auto selectedScheme = getSynthesisSchemeByName(args[++i]);
+            if (!selectedScheme.has_value()) {
+                std::cerr << "Unknown synthesis scheme " << args[i] << "\n";
+                return 2;
+            }
+            scheme = *selectedScheme;
+        } else if (arg == "--dd-method" && hasNextOption) {
+            std::string method = args[++i];
+            std::replace(method.begin(), method.end(), '-', '_');
+            if (method == "one_pass") {
+                ddMethod = DdSynthesisMethod::OnePass;
+            } else if (method == "coding") {
+                ddMethod = DdSynthesisMethod::Coding;
+            } else if (method == "coding_without_additional_line") {
+                ddMethod = DdSynthesisMethod::CodingWithoutAdditionalLine;
+            } else {
+                std::cerr << "Unknown DD-based synthesis method " << args[i] << "\n";
+                return 2;
+            }
+        } else if (arg == "--setting" && hasNextOption) {
+            auto setting = cli::parseSetting(args[++i]);
+            if (!setting.has_value()) {
+                std::cerr << "Invalid setting " << args[i] << ", expected <key>=<value>\n";
+                return 2;
+            }
+            std::visit([&](const auto& value) { settings->set(setting->first, value); }, setting->second);
+            requestSettings.insert_or_assign(std::move(setting->first), std::move(setting->second));
+        } else if (arg == "--simulate" && hasNextOption) {
+            const std::string& pattern = args[++i];
+            if (pattern.empty() || pattern.find_first_not_of("01") != std::string::npos) {
+                std::cerr << "Invalid input pattern " << pattern << ", expected a sequence of 0 and 1\n";
+                return 2;
+            }
+            simulatedPatterns.emplace_back(pattern);
+        } else if ((arg == "-o" || arg == "--output") && hasNextOption) {
+            outputFilename = args[++i];
+            if (const auto extension = getLowercaseExtension(outputFilename); extension != ".qasm" && extension != ".real" && extension != ".bin") {
+                std::cerr << "Unsupported output format " << extension << ", expected .qasm, .real or .bin\n";
+                return 2;
+            }
+        } else if (arg == "--server" && hasNextOption) {
+            serverSocket = args[++i];
+        } else if (arg == "-q" || arg == "--quiet") {
+            quiet = true;
+        } else if (!arg.empty() && arg.front() == '-') {
+            std::cerr << "Unknown or incomplete option " << arg << "\n";
+            printUsage(std::cerr);
+            return 2;
+        } else if (inputFilename.empty()) {
+            inputFilename = arg;
+        } else {
+            std::cerr << "Only a single input file can be processed\n";
+            return 2;
+        }
+    }
+
+    if (inputFilename.empty()) {
+        printUsage(std::cerr);
+        return 2;
+    }
+    const auto inputExtension = getLowercaseExtension(inputFilename);
+    if (inputExtension != ".src" && inputExtension != ".pla" && inputExtension != ".real" && inputExtension != ".bin") {
+        std::cerr << "Unsupported input format " << inputExtension << ", expected .src, .pla, .real or .bin\n";
+        return 2;
+    }
+    if (!std::filesystem::is_regular_file(inputFilename)) {
+        std::cerr << "Could not open file " << inputFilename << "\n";
+        return 1;
+    }
+
+    Circuit                                     circ;
+    std::vector<std::pair<std::string, double>> runtimes;
+    const auto                                  runRecordedPhase = [&runtimes](const std::string& phaseName, const auto& phase) {
+        double     runtime      = 0;
+        const auto errorMessage = runPhase(phase, runtime);
+        runtimes.emplace_back(phaseName, runtime);
+        if (!errorMessage.empty()) {
+            std::cerr << errorMessage << "\n";
+        }
+        return errorMessage.empty();
+    };
+
+    bool ok = true;
+    if (!serverSocket.empty() && inputExtension != ".bin") {
+        ok = runRecordedPhase("synthesis", [&]() -> std::string {
+            SynthesisRequest request;
+            request.format   = inputExtension == ".src" ? SynthesisRequest::Format::SyReC : (inputExtension == ".pla" ? SynthesisRequest::Format::Pla : SynthesisRequest::Format::Real);
+            request.scheme   = scheme;
+            request.ddMethod = ddMethod;
+            request.settings = requestSettings;
+            std::ifstream is(inputFilename, std::ios::binary);
+            request.content.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+
+            const auto response = sendSynthesisRequest(serverSocket, request);
+            if (!response.error.empty()) {
+                return response.error;
+            }
+            if (response.circuit.empty()) {
+                return "The synthesis server did not return a circuit, which is the case for dry runs";
+            }
+            std::istringstream circuitStream(response.circuit);
+            return readBinaryCircuit(circ, circuitStream) ? "" : "Invalid circuit received from the synthesis server";
+        });
+    } else if (inputExtension == ".src") {
+        Program prog;
+        ok = runRecordedPhase("parsing", [&]() { return prog.read(inputFilename); });
+        ok = ok && runRecordedPhase("synthesis", [&]() -> std::string {
+                 const bool synthesized = scheme == SynthesisScheme::CostAware ? CostAwareSynthesis::synthesize(circ, prog, settings) : LineAwareSynthesis::synthesize(circ, prog, settings);
+                 return synthesized ? "" : "Synthesis of program failed";
+             });
+    } else if (inputExtension == ".pla") {
+        TruthTable tt;
+        ok = runRecordedPhase("parsing", [&]() -> std::string { return readPla(tt, inputFilename, false) ? "" : "Could not read truth table " + inputFilename; });
+        ok = ok && runRecordedPhase("synthesis", [&]() { return synthesizeTruthTable(circ, tt, ddMethod); });
+    } else if (inputExtension == ".real") {
+        ok = runRecordedPhase("parsing", [&]() -> std::string {
+            const auto qc = RealParser::importf(inputFilename);
+            return importQuantumComputation(circ, qc) ? "" : "Circuit " + inputFilename + " contains unsupported operations";
+        });
+    } else {
+        ok = runRecordedPhase("parsing", [&]() -> std::string { return readBinaryCircuitFile(circ, inputFilename) ? "" : "Could not read binary circuit " + inputFilename; });
+    }
+    if (!ok) {
+        return 1;
+    }
+    if (circ.isInCostEstimationMode() && (!simulatedPatterns.empty() || !outputFilename.empty())) {
+        std::cerr << "The circuit of a dry run can neither be simulated nor written to a file\n";
+        return 2;
+    }
+
+    if (!simulatedPatterns.empty()) {
+        ok = runRecordedPhase("simulation", [&]() -> std::string {
+            for (const auto& pattern: simulatedPatterns) {
+                if (auto errorMessage = simulate(circ, pattern); !errorMessage.empty()) {
+                    return errorMessage;
+                }
+            }
+            return "";
+        });
+    }
+
+    if (ok && !outputFilename.empty()) {
+        ok = runRecordedPhase("output", [&]() -> std::string {
+            const auto outputExtension = getLowercaseExtension(outputFilename);
+            bool       written         = false;
+            if (outputExtension == ".qasm") {
+                written = circ.toQasmFile(outputFilename);
+            } else if (outputExtension == ".real") {
+                written = circ.toRealFile(outputFilename);
+            } else {
+                written = writeBinaryCircuitFile(circ, outputFilename);
+            }
+            return written ? "" : "Could not write circuit to " + outputFilename;
+        });
+    }
+
+    if (!quiet) {
+        std::cout << "lines:            " << circ.getLines() << "\n"
+                  << "gates:            " << circ.numGates() << "\n"
+                  << "quantum costs:    " << circ.quantumCost() << "\n"
+                  << "transistor costs: " << circ.transistorCost() << "\n";
+        for (const auto& [phaseName, runtime]: runtimes) {
+            std::cout << std::left << std::setw(18) << (phaseName + ":") << std::fixed << std::setprecision(6) << runtime << " s\n";
+        }
+    }
+    return ok ? 0 : 1;
+}
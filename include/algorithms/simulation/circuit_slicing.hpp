@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "core/properties.hpp"
+
+#include <vector>
+
+namespace syrec {
+    /**
+    * @brief Extracts the cone of influence of a set of lines from a circuit
+    *
+    * Since a reversible gate only modifies the values of its target lines, the output values
+    * of the given \p lines only depend on the gates that (transitively) target them as well
+    * as on the input values of the lines used by said gates. All other gates and lines are
+    * removed from the resulting slice.
+    *
+    * The lines of the slice keep their relative order as well as the meta-data (input/output names,
+    * constant and garbage specification) of the corresponding lines in \p circ. Simulating the slice
+    * with the input values of the mapped lines yields the same output values for the requested
+    * lines as simulating the whole circuit.
+    *
+    * @param slice Circuit into which the extracted sub-circuit is written. Should be empty.
+    * @param lineMapping Mapping of the lines of the slice to the lines of \p circ, i.e. line i of the slice corresponds to line lineMapping[i] of \p circ.
+    * @param circ Circuit to be sliced.
+    * @param lines The lines of \p circ whose output values shall be determined by the slice.
+    * @param statistics <table border="0" width="100%">
+    *   <tr>
+    *     <td class="indexkey">Information</td>
+    *     <td class="indexkey">Type</td>
+    *     <td class="indexkey">Description</td>
+    *   </tr>
+    *   <tr>
+    *     <td class="indexvalue">runtime</td>
+    *     <td class="indexvalue">double</td>
+    *     <td class="indexvalue">Run-time consumed by the algorithm in CPU seconds.</td>
+    *   </tr>
+    * </table>
+    * @return Whether all requested lines existed in \p circ and the slice could be created.
+    */
+    bool sliceCircuit(Circuit& slice, std::vector<Gate::Line>& lineMapping, const Circuit& circ, const std::vector<Gate::Line>& lines,
+                      const Properties::ptr& statistics = Properties::ptr());
+} // namespace syrec
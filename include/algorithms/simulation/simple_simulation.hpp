@@ -12,6 +12,7 @@
 
 #include "core/circuit.hpp"
 #include "core/gate.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/n_bit_values_container.hpp"
 #include "core/properties.hpp"
 
@@ -60,4 +61,21 @@ namespace syrec {
     void simpleSimulation(NBitValuesContainer& output, const Circuit& circ, const NBitValuesContainer& input,
                           const Properties::ptr& statistics = Properties::ptr());
 
+    /**
+    * @brief Simple Simulation function for a hierarchical circuit
+    *
+    * Simulates the hierarchical circuit \p circ without flattening it. For each instance whose
+    * control lines are all set, the values of the mapped lines are gathered into the lines of the
+    * instantiated definition, whose gates and nested instances are simulated (in reverse order if
+    * the instance is inverted) before the values are written back to the mapped lines.
+    *
+    * @param output Output pattern. The index of the pattern corresponds to the line index of the top-level circuit.
+    * @param circ Hierarchical circuit to be simulated.
+    * @param input Input pattern. The bit-width of the input pattern has to be initialized properly to the
+    *              number of lines of the top-level circuit.
+    * @param statistics See simpleSimulation(NBitValuesContainer&, const Circuit&, const NBitValuesContainer&, const Properties::ptr&)
+    */
+    void simpleSimulation(NBitValuesContainer& output, const HierarchicalCircuit& circ, const NBitValuesContainer& input,
+                          const Properties::ptr& statistics = Properties::ptr());
+
 } // namespace syrec
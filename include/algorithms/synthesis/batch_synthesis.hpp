@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/gate.hpp"
+#include "core/properties.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief The synthesis schemes available for the synthesis of SyReC programs
+     */
+    enum class SynthesisScheme {
+        CostAware,
+        LineAware
+    };
+
+    /**
+     * Determine the name of a synthesis scheme, i.e. 'cost_aware' or 'line_aware', as used in the names of the test configurations.
+     * @param scheme The synthesis scheme
+     * @return The name of the synthesis scheme
+     */
+    [[nodiscard]] std::string_view getNameOfSynthesisScheme(SynthesisScheme scheme);
+
+    /**
+     * Determine the synthesis scheme from its name.
+     * @param name The name of the synthesis scheme, either with underscores or hyphens (i.e. 'cost_aware' or 'cost-aware')
+     * @return The synthesis scheme if the name is known, otherwise std::nullopt
+     */
+    [[nodiscard]] std::optional<SynthesisScheme> getSynthesisSchemeByName(std::string_view name);
+
+    /**
+     * @brief The synthesis of a SyReC program file with a given synthesis scheme
+     */
+    struct BatchSynthesisJob {
+        std::string     name;                                      ///< The name identifying the program in the report
+        std::string     filename;                                  ///< The file containing the SyReC program
+        SynthesisScheme scheme   = SynthesisScheme::CostAware;     ///< The synthesis scheme used
+        Properties::ptr settings = std::make_shared<Properties>(); ///< The settings of the synthesis scheme
+    };
+
+    /**
+     * Determine the names identifying the programs of a batch in the report.
+     *
+     * A program is named by the stem of its file, as are the entries of the test configurations, unless another program of the batch shares this stem.
+     * Such programs are named by their file as given instead, with programs given multiple times sharing the same name.
+     * @param filenames The files containing the SyReC programs
+     * @return The name of each program in the order of the files
+     */
+    [[nodiscard]] std::vector<std::string> getNamesOfBatchSynthesisPrograms(const std::vector<std::string>& filenames);
+
+    /**
+     * @brief The characteristics of the circuit synthesized for a job of the batch as well as the resources required by its synthesis
+     */
+    struct BatchSynthesisResult {
+        std::string     name;
+        std::string     filename;
+        SynthesisScheme scheme = SynthesisScheme::CostAware;
+        bool            ok     = false;
+        std::string     errorMessage;
+
+        unsigned     numGates        = 0;
+        unsigned     lines           = 0;
+        Gate::cost_t quantumCosts    = 0;
+        Gate::cost_t transistorCosts = 0;
+
+        double parsingRuntime   = 0; ///< Run-time of the parsing of the program in seconds
+        double synthesisRuntime = 0; ///< Run-time of the synthesis of the program in seconds
+        /// Peak resident set size of the process in bytes after the job finished. Since all jobs share the same process, the value is an upper bound of the memory
+        /// required by the job if multiple jobs are processed concurrently. Zero if not supported by the platform.
+        std::size_t peakMemory = 0;
+    };
+
+    /**
+     * Synthesize the programs of a batch of jobs concurrently, each with its own program and circuit.
+     *
+     * @param jobs The jobs to process
+     * @param nThreads The number of threads processing the jobs, a value of zero uses one thread per available hardware thread
+     * @return The results of the jobs in the order of the jobs
+     */
+    [[nodiscard]] std::vector<BatchSynthesisResult> synthesizeBatch(const std::vector<BatchSynthesisJob>& jobs, unsigned nThreads = 0);
+
+    /**
+     * Write the results of a batch synthesis as JSON object keyed by the name of the job.
+     *
+     * The entry of each successful job contains the same fields as the entries of the test configurations in test/configs (i.e. num_gates, lines, quantum_costs and transistor_costs)
+     * followed by the synthesis scheme, the run-time per phase and the peak memory. Failed jobs only report the synthesis scheme and their error message.
+     * @param os The stream to write the report to
+     * @param results The results of the batch synthesis
+     */
+    void writeBatchSynthesisReport(std::ostream& os, const std::vector<BatchSynthesisResult>& results);
+} // namespace syrec
@@ -18,14 +18,49 @@
 #include "ir/operations/Control.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 
 namespace syrec {
 
     auto buildDD(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
 
+    /**
+     * @brief Builds the DD of a truth table given by (possibly overlapping) cubes as read by parsePla
+     *
+     * The DD equals the DD of the table extended by extend(), but the complete table is never constructed.
+     * Instead, the cubes covering the inputs of a sub-table are split recursively and sub-tables given by the same cubes are built only once,
+     * so that a cube with don't care inputs results in shared edges. Thus, the memory required is proportional to the DD rather than to the 2^n rows.
+     *
+     * @param tt truth table with the same number of inputs and outputs
+     * @param dd package used to construct the DD
+     * @return DD of the extended truth table
+     */
+    auto buildDDFromCubes(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
+
+    /**
+     * @brief The methods of the DD-based synthesis of truth tables
+     */
+    enum class DdSynthesisMethod : std::uint8_t {
+        OnePass,
+        Coding,
+        CodingWithoutAdditionalLine
+    };
+
     class DDSynthesizer {
     public:
+        static auto synthesizeTruthTable(const TruthTable& tt, const DdSynthesisMethod method) -> std::shared_ptr<qc::QuantumComputation> {
+            switch (method) {
+                case DdSynthesisMethod::OnePass:
+                    return synthesizeOnePass(tt);
+                case DdSynthesisMethod::Coding:
+                    return synthesizeCodingTechniques(tt);
+                case DdSynthesisMethod::CodingWithoutAdditionalLine:
+                    return synthesizeCodingTechniques(tt, false);
+            }
+            return nullptr;
+        }
+
         static auto synthesizeCodingTechniques(const TruthTable& tt, const bool withAdditionalLine = true) -> std::shared_ptr<qc::QuantumComputation> {
             DDSynthesizer synthesizer{};
             return synthesizer.synthesizeCodingTechniquesTT(tt, withAdditionalLine);
@@ -36,6 +71,15 @@ namespace syrec {
             return synthesizer.synthesizeOnePassTT(tt);
         }
 
+        // synthesizes a truth table given by its cubes (see readPla) like the one-pass synthesis of the extended truth table, but builds the DD from the cubes (see buildDDFromCubes), i.e. without extending it
+        static auto synthesizeCubes(const TruthTable& tt) -> std::shared_ptr<qc::QuantumComputation> {
+            DDSynthesizer synthesizer{};
+            return synthesizer.synthesizeCubesTT(tt);
+        }
+
+        // synthesizes a truth table given by its cubes, which is only extended if the selected method is not the one-pass synthesis
+        static auto synthesizePla(TruthTable tt, DdSynthesisMethod method) -> std::shared_ptr<qc::QuantumComputation>;
+
         auto synthesize(dd::mEdge src, std::unique_ptr<dd::Package>& dd) -> std::shared_ptr<qc::QuantumComputation>;
 
         [[nodiscard]] auto numGate() const -> std::size_t {
@@ -108,6 +152,8 @@ namespace syrec {
         auto synthesizeOnePassTT(TruthTable tt) -> std::shared_ptr<qc::QuantumComputation>;
 
         auto synthesizeCodingTechniquesTT(TruthTable tt, bool withAdditionalLine) -> std::shared_ptr<qc::QuantumComputation>;
+
+        auto synthesizeCubesTT(TruthTable const& tt) -> std::shared_ptr<qc::QuantumComputation>;
     };
 
 } // namespace syrec
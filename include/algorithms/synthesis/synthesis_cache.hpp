@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/circuit.hpp"
+#include "core/syrec/module.hpp"
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Persistent cache of synthesized circuits in a local directory
+     *
+     * Each entry is stored in its own file named after the key of the synthesis, which is a hash of the abstract syntax tree of the main module, of the hashes of
+     * all modules (un)called by it, of the configuration of the synthesis scheme and of the version of the synthesis algorithms (see SYNTHESIS_ALGORITHM_VERSION). Since the bitwidths of the variables and numeric expressions are part of the
+     * abstract syntax tree, a program parsed with a different default bitwidth results in a different key. The entry stores the statistics of the synthesis and
+     * the synthesized circuit in the compact binary circuit format (see writeBinaryCircuit(...)).
+     *
+     * Entries are written to a temporary file in the cache directory which is then renamed to the file of the entry. Thus, processes sharing the cache directory
+     * either read a complete entry or none at all. Entries that cannot be read, e.g. because they were corrupted, are treated like missing entries.
+     *
+     * @remarks Gate annotations are not stored, thus the gates of a circuit read from the cache are not annotated with the line numbers of their statements.
+     */
+    class SynthesisCache {
+    public:
+        /**
+         * @brief The unsigned statistics of a synthesis by their name
+         */
+        using Statistics = std::vector<std::pair<std::string, unsigned>>;
+
+        /**
+         * @brief The version of the synthesis algorithms, which is part of the keys of the entries
+         *
+         * It has to be incremented whenever a change of the synthesis alters the circuits synthesized for the same program and settings, so that the circuits cached by
+         * previous versions are no longer returned.
+         */
+        static constexpr unsigned SYNTHESIS_ALGORITHM_VERSION = 1U;
+
+        /**
+         * @param directory The directory storing the entries of the cache, which is created when the first entry is stored
+         */
+        explicit SynthesisCache(std::string directory):
+            directory(std::move(directory)) {}
+
+        /**
+         * Compute the key of the synthesis of a module.
+         *
+         * @param mainModule The main module of the synthesized program
+         * @param configuration The synthesis scheme and all settings that influence the synthesized circuit
+         * @return The key as 16 hexadecimal digits
+         */
+        [[nodiscard]] static std::string computeKey(const Module& mainModule, std::string_view configuration);
+
+        /**
+         * Read the entry of a synthesis.
+         *
+         * @param key The key of the synthesis
+         * @param circ The empty circuit to which the lines and gates of the cached circuit are added, only modified if the entry was read successfully
+         * @param statistics The statistics of the cached synthesis
+         * @return Whether the entry exists and was read successfully
+         */
+        bool load(const std::string& key, Circuit& circ, Statistics& statistics) const;
+
+        /**
+         * Store the entry of a synthesis, replacing any existing entry with the same key.
+         *
+         * @param key The key of the synthesis
+         * @param circ The synthesized circuit
+         * @param statistics The statistics of the synthesis
+         * @return Whether the entry was stored successfully
+         */
+        bool store(const std::string& key, const Circuit& circ, const Statistics& statistics) const;
+
+    private:
+        [[nodiscard]] std::string getFilenameOfEntry(const std::string& key) const;
+
+        std::string directory;
+    };
+} // namespace syrec
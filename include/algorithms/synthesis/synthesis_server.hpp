@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_session.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief A request of a client of the synthesis server
+     */
+    struct SynthesisRequest {
+        /**
+         * @brief The format of the content of the request
+         */
+        enum class Format : std::uint8_t {
+            SyReC, ///< SyReC program synthesized with the selected synthesis scheme
+            Pla,   ///< Truth table synthesized with the selected DD-based synthesis method
+            Real   ///< Circuit in the RevLib format which is only imported
+        };
+
+        /**
+         * @brief The value of a setting passed to the synthesis of a SyReC program
+         */
+        using SettingValue = std::variant<bool, unsigned, std::string>;
+
+        Format                              format   = Format::SyReC;
+        std::string                         content; ///< The SyReC program, truth table or circuit
+        SynthesisScheme                     scheme   = SynthesisScheme::CostAware;
+        DdSynthesisMethod                   ddMethod = DdSynthesisMethod::OnePass;
+        std::map<std::string, SettingValue> settings;
+        bool                                returnCircuit = true; ///< Whether the circuit is returned or only its statistics
+
+        /**
+         * Encode the request as payload of a frame of the synthesis server protocol.
+         *
+         * @return The encoded request
+         */
+        [[nodiscard]] std::string encode() const;
+
+        /**
+         * Decode a request from the payload of a frame of the synthesis server protocol.
+         *
+         * @param payload The encoded request
+         * @return The request or std::nullopt if the payload is not a valid request
+         */
+        [[nodiscard]] static std::optional<SynthesisRequest> decode(std::string_view payload);
+    };
+
+    /**
+     * @brief The response of the synthesis server to a request
+     */
+    struct SynthesisResponse {
+        /**
+         * @brief The value of a statistic of the synthesis
+         */
+        using StatisticValue = std::variant<bool, std::uint64_t, double>;
+
+        std::string                           error;   ///< The error message if the request failed, otherwise an empty string
+        std::map<std::string, StatisticValue> statistics;
+        std::string                           circuit; ///< The circuit in the binary circuit format if it was requested
+
+        /**
+         * Encode the response as payload of a frame of the synthesis server protocol.
+         *
+         * @return The encoded response
+         */
+        [[nodiscard]] std::string encode() const;
+
+        /**
+         * Decode a response from the payload of a frame of the synthesis server protocol.
+         *
+         * @param payload The encoded response
+         * @return The response or std::nullopt if the payload is not a valid response
+         */
+        [[nodiscard]] static std::optional<SynthesisResponse> decode(std::string_view payload);
+    };
+
+    /**
+     * @brief Long-running server that synthesizes the requests of local clients connected via a Unix domain socket
+     *
+     * Each message of the protocol is a frame consisting of the length of its payload as 32-bit little-endian integer followed by the payload, which is an encoded
+     * SynthesisRequest sent by the client or an encoded SynthesisResponse sent by the server. A client may send multiple requests over the same connection, each of
+     * which is answered by a response before the next request is read.
+     *
+     * The connections are served by a pool of worker threads, each of which serves one connection at a time. A connection on which the client does not send any
+     * data within the idle timeout is closed, so that idle clients cannot occupy all worker threads. Between requests, the server keeps the synthesis sessions of
+     * SyReC programs (see SynthesisSession), so that a program that only differs in some of its modules from a program synthesized before with the same scheme and
+     * settings only parses and synthesizes the changed modules again. Additionally, the responses to the most recent requests are kept, so that a repeated request
+     * is answered without any synthesis and its response reports the statistic 'reused_response'.
+     *
+     * @remarks Unix domain sockets are not supported on Windows, on which start() fails.
+     */
+    class SynthesisServer {
+    public:
+        static constexpr std::chrono::milliseconds DEFAULT_IDLE_TIMEOUT{60000};
+
+        /**
+         * @param socketPath The path of the Unix domain socket the server listens on
+         * @param nWorkers The number of worker threads serving the connections, a value of zero uses one thread per available hardware thread
+         * @param idleTimeout The time after which a connection on which no data was received is closed
+         */
+        explicit SynthesisServer(std::string socketPath, std::size_t nWorkers = 0U, std::chrono::milliseconds idleTimeout = DEFAULT_IDLE_TIMEOUT);
+
+        SynthesisServer(const SynthesisServer&)            = delete;
+        SynthesisServer& operator=(const SynthesisServer&) = delete;
+
+        ~SynthesisServer();
+
+        /**
+         * Bind the socket and start the worker threads.
+         *
+         * A stale socket file left by a terminated server is replaced while the socket of a running server is not.
+         *
+         * @return The error message if the server could not be started, otherwise an empty string
+         */
+        [[nodiscard]] std::string start();
+
+        /**
+         * Stop accepting connections, wait for the worker threads to finish their current requests and remove the socket file.
+         */
+        void stop();
+
+        /**
+         * Handle a request without a connection, e.g. to reuse the warm caches of the server within the same process.
+         *
+         * @param request The request
+         * @return The response
+         */
+        [[nodiscard]] SynthesisResponse handle(const SynthesisRequest& request);
+
+    private:
+        void acceptConnections();
+        void serveConnections();
+        void serveConnection(int connection);
+
+        [[nodiscard]] SynthesisResponse handleSyrecRequest(const SynthesisRequest& request);
+
+        std::string               socketPath;
+        std::size_t               nWorkers;
+        std::chrono::milliseconds idleTimeout;
+        int                       listeningSocket = -1;
+
+        std::atomic<bool>        stopped{true};
+        std::thread              acceptor;
+        std::vector<std::thread> workers;
+
+        std::mutex              connectionsMutex;
+        std::condition_variable connectionAvailable;
+        std::queue<int>         pendingConnections;
+
+        // Synthesis sessions not used by any worker together with the scheme and settings of their requests, the most recently used session first
+        std::mutex                                                           sessionsMutex;
+        std::list<std::pair<std::string, std::unique_ptr<SynthesisSession>>> idleSessions;
+
+        // Responses to the most recent requests by their encoded request, the oldest request first
+        std::mutex                                         responsesMutex;
+        std::unordered_map<std::string, SynthesisResponse> recentResponses;
+        std::queue<std::string>                            recentRequests;
+    };
+
+    /**
+     * Send a request to a synthesis server and wait for its response.
+     *
+     * @param socketPath The path of the Unix domain socket the server listens on
+     * @param request The request
+     * @return The response of the server, whose error message describes the failure if the server could not be reached
+     */
+    [[nodiscard]] SynthesisResponse sendSynthesisRequest(const std::string& socketPath, const SynthesisRequest& request);
+} // namespace syrec
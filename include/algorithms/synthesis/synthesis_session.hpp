@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Incremental parsing and synthesis of consecutive versions of a SyReC program, e.g. while it is edited
+     *
+     * The session keeps the modules of the last parsed version of the program together with their source. When parsing a new version, only the modules whose
+     * source changed and the modules calling them are parsed again while all other modules are reused. The gates synthesized for the (un)calls of the reused modules
+     * are kept in a module synthesis cache (see the setting 'memoize_module_synthesis') across syntheses, so that only the changed modules and their callers are synthesized again.
+     * If neither the main module nor any module called by it changed, the previously synthesized circuit is kept.
+     *
+     * @remarks Since the line numbers of the statements of a module are annotated to the synthesized gates, a module is also parsed again if its first line moved.
+     */
+    class SynthesisSession {
+    public:
+        /**
+         * @param scheme The synthesis scheme used
+         * @param settings The settings of the synthesis scheme, which must not change during the session since the cached syntheses depend on them
+         * @param readSettings The settings used to parse the program
+         */
+        explicit SynthesisSession(SynthesisScheme scheme = SynthesisScheme::CostAware, Properties::ptr settings = std::make_shared<Properties>(), const ReadProgramSettings& readSettings = ReadProgramSettings{});
+
+        /**
+         * Parse a new version of the program.
+         *
+         * If the modules of the program cannot be parsed separately, the whole program is parsed to report the same errors as Program::read(...).
+         * The statistics 'reparsed_modules' and 'reused_modules' report the number of parsed and reused modules.
+         *
+         * @param source The SyReC program
+         * @param statistics The statistics of the parsing
+         * @return The error message if parsing failed, in which case the last successfully parsed version of the program is kept, otherwise an empty string
+         */
+        std::string parse(std::string_view source, const Properties::ptr& statistics = std::make_shared<Properties>());
+
+        /**
+         * Synthesize the last successfully parsed version of the program.
+         *
+         * Besides the statistics of the synthesis scheme, the statistic 'reused_circuit' reports whether the previously synthesized circuit was kept.
+         *
+         * @param statistics The statistics of the synthesis
+         * @return Whether the synthesis was successful
+         */
+        bool synthesize(const Properties::ptr& statistics = std::make_shared<Properties>());
+
+        /**
+         * @brief The last successfully parsed version of the program
+         */
+        [[nodiscard]] const Program& program() const {
+            return *prog;
+        }
+
+        /**
+         * @brief The circuit synthesized for the last successfully parsed version of the program
+         */
+        [[nodiscard]] const Circuit& circuit() const {
+            return circ;
+        }
+
+    private:
+        struct ParsedModule {
+            std::string              source;
+            unsigned                 firstLineNumber;
+            Module::ptr              module;
+            std::vector<Module::ptr> callees; // The modules (un)called by the statements of the module
+        };
+
+        SynthesisScheme     scheme;
+        Properties::ptr     settings;
+        ReadProgramSettings readSettings;
+
+        std::unique_ptr<Program>  prog = std::make_unique<Program>();
+        std::vector<ParsedModule> parsedModules;
+
+        std::shared_ptr<SyrecSynthesis::ModuleSynthesisCache> moduleSynthesisCache = std::make_shared<SyrecSynthesis::ModuleSynthesisCache>();
+        Circuit                                               circ;
+        // The main module and the modules called by it from which the circuit was synthesized
+        std::optional<std::vector<Module::ptr>> synthesizedModules;
+    };
+} // namespace syrec
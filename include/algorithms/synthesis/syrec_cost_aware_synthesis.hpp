@@ -12,11 +12,13 @@
 
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/circuit.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/program.hpp"
 #include "core/syrec/statement.hpp"
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace syrec {
@@ -25,12 +27,29 @@ namespace syrec {
         using SyrecSynthesis::SyrecSynthesis;
 
         static bool synthesize(Circuit& circ, const Program& program, const Properties::ptr& settings = std::make_shared<Properties>(), const Properties::ptr& statistics = std::make_shared<Properties>());
+        static bool synthesize(HierarchicalCircuit& circ, const Program& program, const Properties::ptr& settings = std::make_shared<Properties>(), const Properties::ptr& statistics = std::make_shared<Properties>());
 
     protected:
         bool processStatement(Circuit& circuit, const Statement::ptr& statement) override {
             return SyrecSynthesis::onStatement(circuit, statement);
         }
 
+        [[nodiscard]] bool supportsConstantLineRecycling() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool supportsInverseReplayOfModuleSynthesis() const override {
+            return true;
+        }
+
+        [[nodiscard]] bool supportsCommonSubexpressionElimination() const override {
+            return true;
+        }
+
+        [[nodiscard]] std::string_view getNameOfScheme() const override {
+            return "cost_aware";
+        }
+
         bool assignAdd(Circuit& circuit, std::vector<unsigned>& rhs, std::vector<unsigned>& lhs, [[maybe_unused]] const unsigned& op) override {
             return increase(circuit, rhs, lhs);
         }
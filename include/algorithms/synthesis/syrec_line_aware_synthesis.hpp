@@ -12,12 +12,14 @@
 
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/circuit.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/program.hpp"
 #include "core/syrec/statement.hpp"
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 namespace syrec {
@@ -26,10 +28,15 @@ namespace syrec {
         using SyrecSynthesis::SyrecSynthesis;
 
         static bool synthesize(Circuit& circ, const Program& program, const Properties::ptr& settings = std::make_shared<Properties>(), const Properties::ptr& statistics = std::make_shared<Properties>());
+        static bool synthesize(HierarchicalCircuit& circ, const Program& program, const Properties::ptr& settings = std::make_shared<Properties>(), const Properties::ptr& statistics = std::make_shared<Properties>());
 
     protected:
         bool processStatement(Circuit& circuit, const Statement::ptr& statement) override;
 
+        [[nodiscard]] std::string_view getNameOfScheme() const override {
+            return "line_aware";
+        }
+
         bool opRhsLhsExpression(const Expression::ptr& expression, std::vector<unsigned>& v) override;
 
         bool opRhsLhsExpression(const VariableExpression& expression, std::vector<unsigned>& v) override;
@@ -76,6 +83,11 @@ namespace syrec {
 
         static bool decreaseNewAssign(Circuit& circuit, const std::vector<unsigned>& rhs, const std::vector<unsigned>& lhs);
 
-        bool expressionOpInverse(Circuit& circuit, [[maybe_unused]] unsigned op, [[maybe_unused]] const std::vector<unsigned>& expLhs, [[maybe_unused]] const std::vector<unsigned>& expRhs) const override;
+        /**
+         * Determine whether a binary operation is evaluated in-place on the lines of its right-hand side operand, i.e. whether its evaluation can be reverted by appending the inverse of its gates.
+         * @param op The binary operation
+         * @return Whether the operation is evaluated in-place
+         */
+        [[nodiscard]] static bool isEvaluatedInPlace(unsigned op);
     };
 } // namespace syrec
@@ -11,6 +11,8 @@
 #pragma once
 
 #include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/module.hpp"
@@ -19,10 +21,17 @@
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <optional>
+#include <set>
 #include <stack>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace syrec {
@@ -31,6 +40,7 @@ namespace syrec {
         std::stack<unsigned>               expOpp;
         std::stack<std::vector<unsigned>>  expLhss;
         std::stack<std::vector<unsigned>>  expRhss;
+        std::stack<Circuit::GateRange>     expGateRanges;
         bool                               subFlag = false;
         std::vector<unsigned>              opVec;
         std::vector<unsigned>              assignOpVector;
@@ -108,29 +118,369 @@ namespace syrec {
         static bool  swap(Circuit& circuit, const std::vector<unsigned>& dest1, const std::vector<unsigned>& dest2);                                            // NOLINT(cppcoreguidelines-noexcept-swap, performance-noexcept-swap) <=>
         static bool  decrease(Circuit& circuit, const std::vector<unsigned>& rhs, const std::vector<unsigned>& lhs);
         static bool  increase(Circuit& circuit, const std::vector<unsigned>& rhs, const std::vector<unsigned>& lhs);
-        virtual bool expressionOpInverse([[maybe_unused]] Circuit& circuit, [[maybe_unused]] unsigned op, [[maybe_unused]] const std::vector<unsigned>& expLhs, [[maybe_unused]] const std::vector<unsigned>& expRhs) const;
         bool         checkRepeats();
 
         // shift operations
         static bool leftShift(Circuit& circuit, const std::vector<unsigned>& dest, const std::vector<unsigned>& src1, unsigned src2);  // <<
         static bool rightShift(Circuit& circuit, const std::vector<unsigned>& dest, const std::vector<unsigned>& src1, unsigned src2); // >>
 
-        static void addVariable(Circuit& circ, const std::vector<unsigned>& dimensions, const Variable::ptr& var, constant constant, bool garbage, const std::string& arraystr);
-        void        getVariables(const VariableAccess::ptr& var, std::vector<unsigned>& lines);
+        void getVariables(const VariableAccess::ptr& var, std::vector<unsigned>& lines);
 
         unsigned getConstantLine(Circuit& circuit, bool value);
         void     getConstantLines(Circuit& circuit, unsigned bitwidth, unsigned value, std::vector<unsigned>& lines);
 
+        /**
+         * Determine whether the constant lines used to evaluate an expression can be recycled, either by the setting 'recycle_constant_lines' or the 'constant_line_budget'.
+         *
+         * @remarks Recycling reverts the gates created for the evaluation of an expression once its result is no longer needed, which is only valid
+         * for synthesis schemes that do not revert the effects of the expression evaluation on their own.
+         * @return Whether the recycling of constant lines is supported by the synthesis scheme.
+         */
+        [[nodiscard]] virtual bool supportsConstantLineRecycling() const {
+            return false;
+        }
+
+        /**
+         * Determine whether the synthesis of an uncall of a module can be replaced by the inverted synthesis of a call of the same module (and vice versa) when memoizing module syntheses.
+         *
+         * @remarks Only valid for synthesis schemes whose synthesis of a reversed statement is the inverse of the synthesis of the original statement.
+         * @return Whether the inverse replay of cached module syntheses is supported by the synthesis scheme.
+         */
+        [[nodiscard]] virtual bool supportsInverseReplayOfModuleSynthesis() const {
+            return false;
+        }
+
+        /**
+         * Determine whether the result of an evaluated expression can be reused for a structurally equal expression as long as the lines used by its evaluation were not modified in the meantime.
+         *
+         * @remarks Only valid for synthesis schemes that keep the result of each evaluated expression on separate lines which are not modified by the operations using the result.
+         * @return Whether the elimination of common subexpressions is supported by the synthesis scheme.
+         */
+        [[nodiscard]] virtual bool supportsCommonSubexpressionElimination() const {
+            return false;
+        }
+
+        /**
+         * @brief The name of the synthesis scheme, which distinguishes its syntheses in the persistent synthesis cache (see the setting 'synthesis_cache_directory')
+         */
+        [[nodiscard]] virtual std::string_view getNameOfScheme() const = 0;
+
+        /**
+         * @brief The kinds of expressions whose results can be reused
+         */
+        enum class SubexpressionKind : std::uint8_t { Numeric,
+                                                      Binary,
+                                                      Shift };
+
+        /**
+         * @brief Identifies the result of an expression by the structure of the expression
+         *
+         * Consists of the kind of the expression, its operation, its bitwidth, its value (the value of a numeric expression or the shift amount of a shift expression) followed by the lines of its left and right operand.
+         */
+        using CommonSubexpressionKey = std::tuple<SubexpressionKind, unsigned, unsigned, unsigned, std::vector<unsigned>, std::vector<unsigned>>;
+
+        /**
+         * @brief The lines storing the result of an evaluated expression
+         *
+         * Since the gates of the evaluation are only executed if all propagated control lines are set, the result is only available while these control lines are still propagated.
+         * The version of each line used by the evaluation (i.e. the lines of its operands, its result and the propagated control lines) at the time of the evaluation is recorded to detect later modifications of these lines.
+         */
+        struct CommonSubexpression {
+            std::vector<unsigned>                         lines;
+            Gate::LinesLookup                             propagatedControlLines;
+            std::vector<std::pair<unsigned, std::size_t>> versionsOfUsedLines;
+        };
+
+        /**
+         * Reuse the result of a previous evaluation of a structurally equal expression.
+         *
+         * @remarks A result is not reused while recording a loop body template, since its lines would not be offset for the remaining iterations, or if it overlaps the left operand of a binary expression whose right operand is evaluated.
+         * @param circuit The circuit to which the gates of the expression would be added
+         * @param key The key identifying the expression
+         * @param lines The container to which the lines storing the reused result are appended
+         * @return Whether a result could be reused
+         */
+        bool reuseCommonSubexpression(const Circuit& circuit, const CommonSubexpressionKey& key, std::vector<unsigned>& lines);
+
+        /**
+         * Record the result of an evaluated expression for later reuse.
+         * @param circuit The circuit containing the gates of the expression
+         * @param key The key identifying the expression
+         * @param lines The lines storing the result of the expression
+         */
+        void recordCommonSubexpression(const Circuit& circuit, const CommonSubexpressionKey& key, const std::vector<unsigned>& lines);
+
+        /**
+         * Prevent the reuse of all recorded results whose evaluation used any of the given lines.
+         * @param modifiedLines The lines whose values were modified
+         */
+        void invalidateCommonSubexpressions(const std::vector<unsigned>& modifiedLines);
+
+        /**
+         * @brief The gates and the constant lines acquired during the synthesis of an expression or statement
+         */
+        struct Computation {
+            Circuit::GateRange gates;                          ///< The gates of the computation
+            std::size_t        acquiredConstantLinesBegin = 0; ///< Number of acquired but not yet released constant lines prior to the computation
+            std::size_t        acquiredConstantLinesEnd   = 0; ///< Number of acquired but not yet released constant lines after the computation
+            std::size_t        instancesBegin             = 0; ///< Number of instances of the top-level circuit of the synthesized hierarchical circuit prior to the computation
+        };
+
+        /**
+         * Start recording a computation, i.e. remember the current number of gates and acquired constant lines.
+         * @param circuit The circuit to which the gates of the computation will be added
+         * @return The started computation whose end is determined by a call to endComputation(...)
+         */
+        [[nodiscard]] Computation beginComputation(const Circuit& circuit) const;
+
+        /**
+         * Finish the recording of a computation.
+         * @param circuit The circuit to which the gates of the computation were added
+         * @param computation The computation to finish
+         */
+        void endComputation(const Circuit& circuit, Computation& computation) const;
+
+        /**
+         * Determine whether a computation can be uncomputed by appending its gates in reverse order to the circuit.
+         *
+         * @remarks This is only the case if none of the gates added after the computation modified a line used by the computation and if none of the constant lines
+         * acquired during the computation is part of the lines that need to be kept.
+         * @param circuit The circuit containing the gates of the computation
+         * @param computation The computation to check
+         * @param linesToKeep The lines whose values are still required after the uncomputation
+         * @return Whether the computation can be uncomputed
+         */
+        [[nodiscard]] bool canUncompute(const Circuit& circuit, const Computation& computation, const std::vector<unsigned>& linesToKeep) const;
+
+        /**
+         * Uncompute a computation by appending its gates in reverse order to the circuit and return all constant lines acquired during the computation
+         * to the pool of free constant lines.
+         *
+         * @param circuit The circuit to which the uncomputation gates are added
+         * @param computation The computation to uncompute
+         * @return Whether all gates of the uncomputation could be created
+         */
+        bool uncomputeAndReleaseConstantLines(Circuit& circuit, const Computation& computation);
+
+        /**
+         * Uncompute the computations of the operands of an expression as long as the number of constant lines in use exceeds the constant line budget.
+         *
+         * @remarks The intermediate results of the operands are recomputed should they be required again, i.e. when the expression itself is uncomputed (Bennett-style pebbling).
+         * @param circuit The circuit to which the uncomputation gates are added
+         * @param operandComputations The computations of the operands of the expression in the order in which they were performed
+         * @param result The lines storing the result of the expression
+         * @return Whether all gates of the uncomputation could be created
+         */
+        bool uncomputeOperandsExceedingConstantLineBudget(Circuit& circuit, const std::vector<Computation>& operandComputations, const std::vector<unsigned>& result);
+
+        /**
+         * Determine whether the number of constant lines currently in use exceeds the constant line budget defined in the synthesis settings.
+         * @return Whether a constant line budget was defined and is exceeded.
+         */
+        [[nodiscard]] bool exceedsConstantLineBudget() const {
+            return constantLineBudget.has_value() && acquiredConstantLines.size() > *constantLineBudget;
+        }
+
+        /**
+         * @brief Identifies the synthesis of a (un)call of a module whose gates only depend on the module, the direction of the (un)call and the variables bound to the module parameters
+         *
+         * Consists of the module, whether the module was uncalled and, for each parameter, the index of the first parameter referencing the same variable followed by the bitwidth and the dimensions of the referenced variable.
+         */
+        using ModuleSynthesisCacheKey = std::tuple<const Module*, bool, std::vector<unsigned>>;
+
+        /**
+         * @brief The gates synthesized for a (un)call of a module
+         *
+         * The gates are stored in a circuit whose first lines correspond to the lines of the variables bound to the module parameters (in the order of the parameters)
+         * while all remaining lines correspond to the lines added during the synthesis of the (un)call. The control lines propagated to the (un)call are not part of the cached gates.
+         * Since the synthesis of the (un)call also modifies the state of the synthesizer, the lines released as free constant lines as well as the global gate annotations active at the end of the synthesis are recorded.
+         * When synthesizing a hierarchical circuit, the gates and the module instances of the (un)call are moved to a definition of the hierarchical circuit instead.
+         */
+        struct CachedModuleSynthesis {
+            Circuit                                          gates;
+            std::optional<HierarchicalCircuit::DefinitionId> definition;
+            std::size_t                                      nParameterLines         = 0;
+            std::size_t                                      nRequestedConstantLines = 0;
+            std::size_t                                      nAddedConstantLines     = 0;
+            std::map<bool, std::vector<unsigned>>            releasedConstLines;
+            std::map<std::string, std::string, std::less<>>  globalGateAnnotations;
+        };
+
+    public:
+        /**
+         * @brief The cached syntheses of the (un)calls of modules
+         *
+         * If passed with the setting 'module_synthesis_cache', the cache is kept across the syntheses of programs sharing modules, e.g. of consecutive versions of an edited program.
+         * Since the cached syntheses are identified by the address of their module, the syntheses of a module must be removed before the module is destroyed, since another module could be allocated at its address.
+         */
+        class ModuleSynthesisCache {
+        public:
+            /**
+             * Remove the cached syntheses of all modules except the given ones.
+             * @param modules The modules whose cached syntheses are kept
+             */
+            void retainModules(const std::set<const Module*>& modules);
+
+            [[nodiscard]] std::size_t size() const {
+                return entries.size();
+            }
+
+        private:
+            friend class SyrecSynthesis;
+
+            std::map<ModuleSynthesisCacheKey, CachedModuleSynthesis> entries;
+        };
+
+    protected:
+        [[nodiscard]] ModuleSynthesisCacheKey createModuleSynthesisCacheKey(const Module& module, bool isUncall) const;
+
+        /**
+         * Determine the lines of the variables bound to the parameters of a module in the order of the parameters.
+         * @param module The module whose parameters were bound to the arguments of a (un)call
+         * @return The lines of the variables referenced by the module parameters
+         */
+        [[nodiscard]] std::vector<Gate::Line> getParameterLines(const Module& module);
+
+        /**
+         * Cache the gates synthesized for a (un)call of a module.
+         *
+         * @remarks The synthesis is not cached if any of its gates uses a line that is neither a line of a variable bound to a module parameter nor a line added during the synthesis of the (un)call
+         * or if any of the free constant lines available prior to the synthesis of the (un)call was used. Neither is it cached if a control line propagated to the (un)call is also the line of a
+         * variable bound to a module parameter, since such a control line cannot be distinguished from the controls of the gates of the module. Finally, the synthesis of a module is not
+         * cached if the module or any module (un)called by it declares local variables, whose lines are only added for their first (un)call.
+         * @param circuit The circuit containing the synthesized gates
+         * @param cacheKey The key identifying the synthesized (un)call
+         * @param module The (un)called module
+         * @param synthesis The computation recording the gates of the (un)call
+         * @param freeConstLinesBegin The free constant lines prior to the synthesis of the (un)call
+         * @param linesBegin The number of lines of the circuit prior to the synthesis of the (un)call
+         * @param nRequestedConstantLinesBegin The number of requested constant lines prior to the synthesis of the (un)call
+         * @param nAddedConstantLinesBegin The number of added constant lines prior to the synthesis of the (un)call
+         */
+        void cacheModuleSynthesis(const Circuit& circuit, const ModuleSynthesisCacheKey& cacheKey, const Module& module, const Computation& synthesis, const std::map<bool, std::vector<unsigned>>& freeConstLinesBegin, std::size_t linesBegin, std::size_t nRequestedConstantLinesBegin, std::size_t nAddedConstantLinesBegin);
+
+        /**
+         * Determine whether the synthesis of an uncall of a module is the inverse of the synthesis of a call of the module.
+         *
+         * @remarks Only modules consisting of unary statements, assignments, swaps and (un)calls of modules satisfying the same condition are considered since the reversal of the remaining statements does not yield their inverse.
+         * @param module The (un)called module
+         * @return Whether the synthesis of an uncall of the module is the inverse of the synthesis of a call of the module
+         */
+        [[nodiscard]] static bool isUncallInverseOfCall(const Module& module);
+
+        /**
+         * Replay the cached gates of a previous synthesis of a (un)call of a module with the lines of the currently bound parameters.
+         *
+         * @remarks If only the opposite direction of the (un)call was cached, its synthesis did not require additional lines, the synthesis scheme supports the inverse replay of module syntheses and the uncall of the module is the inverse of its call, its gates are replayed in reverse order.
+         * @param circuit The circuit to which the gates are added
+         * @param cacheKey The key identifying the (un)call
+         * @param module The (un)called module
+         * @return std::nullopt if no matching synthesis was cached, otherwise whether all cached gates could be added to the circuit
+         */
+        std::optional<bool> replayCachedModuleSynthesis(Circuit& circuit, const ModuleSynthesisCacheKey& cacheKey, const Module& module);
+
+        /**
+         * Get the circuit storing the lines and gates of a cached synthesis of a (un)call of a module.
+         * @param cachedSynthesis The cached synthesis
+         * @return The circuit of the definition of the hierarchical circuit if the cached synthesis was moved to one, otherwise the gates of the cached synthesis
+         */
+        [[nodiscard]] const Circuit& getCachedGates(const CachedModuleSynthesis& cachedSynthesis) const;
+
+        /**
+         * Replace the gates and module instances synthesized for a (un)call of a module in the top-level circuit of the synthesized hierarchical circuit by an instance of the definition created for the cached synthesis.
+         *
+         * @remarks The synthesized gates are kept if the synthesis was not cached or if any of the control lines propagated to the (un)call is a line of the instance.
+         * @param circuit The top-level circuit containing the synthesized gates
+         * @param cacheKey The key identifying the synthesized (un)call
+         * @param module The (un)called module
+         * @param synthesis The computation recording the gates and instances of the (un)call
+         * @param linesBegin The number of lines of the circuit prior to the synthesis of the (un)call
+         * @return Whether the synthesized gates were either kept or replaced by an instance
+         */
+        bool outlineModuleSynthesis(Circuit& circuit, const ModuleSynthesisCacheKey& cacheKey, const Module& module, const Computation& synthesis, std::size_t linesBegin);
+
+        /**
+         * @brief The lines accessed during the synthesis of the first iteration of a loop with the change of each line per increment of the loop variable
+         *
+         * The recorded template cannot be instantiated if a line is accessed with different changes per increment of the loop variable or if the loop variable is redefined by a loop of an (un)called module.
+         */
+        struct LoopBodyTemplateRecording {
+            std::string                        loopVariable;
+            std::map<unsigned, std::ptrdiff_t> lineOffsetsPerLoopVariableIncrement;
+            bool                               isInstantiable = true;
+        };
+
+        /**
+         * Determine whether the gates synthesized for an iteration of a loop only depend on the value of the loop variable by an offset of their lines.
+         *
+         * @remarks This is the case if the loop variable is only used as the index of a dimension or as a single bit of a variable access while all other uses
+         * (i.e. as the value of a numeric expression, as a shift amount, as the bound of a bit range or as the bound of a nested loop) change the structure of the synthesized gates.
+         * @param statement The loop to check
+         * @return Whether the synthesis of the loop body can be used as a template for all iterations of the loop
+         */
+        [[nodiscard]] static bool isLoopBodyTemplatable(const ForStatement& statement);
+
+        /**
+         * Record the change of a line accessed during the recording of a loop body template per increment of the loop variable.
+         * @param line The accessed line
+         * @param lineOffsetPerLoopVariableIncrement The change of the accessed line per increment of the loop variable
+         */
+        void recordLineOfLoopBodyTemplate(unsigned line, std::ptrdiff_t lineOffsetPerLoopVariableIncrement);
+
+        /**
+         * Synthesize a loop by recording the gates of its first iteration as a template that is instantiated for the remaining iterations by offsetting the lines of its gates.
+         *
+         * @remarks Iterations for which the instantiated template would access a line outside of the circuit or map two lines of the template to the same line are synthesized from the loop body instead.
+         * The gates of consecutive instantiated iterations are created concurrently if more than one synthesis thread is configured and each thread creates at least MIN_GATES_PER_SYNTHESIS_THREAD gates.
+         * @param circuit The circuit to which the gates of the loop are added
+         * @param statement The loop to synthesize
+         * @param from The value of the loop variable in the first iteration
+         * @param to The value of the loop variable in the last iteration
+         * @param step The (non-zero) change of the loop variable per iteration
+         * @return Whether the synthesis of the loop was successful
+         */
+        bool synthesizeForStatementUsingLoopBodyTemplate(Circuit& circuit, const ForStatement& statement, unsigned from, unsigned to, unsigned step);
+
         static bool synthesize(SyrecSynthesis* synthesizer, Circuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics);
+        static bool synthesize(SyrecSynthesis* synthesizer, HierarchicalCircuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics);
 
-        std::stack<Statement::ptr>    stmts;
-        Circuit&                      circ; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
-        Number::loop_variable_mapping loopMap;
-        std::stack<Module::ptr>       modules;
+        std::stack<Statement::ptr>   stmts;
+        Circuit&                     circ; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+        Number::loop_variable_values loopVariableValues;
+        std::stack<Module::ptr>      modules;
 
     private:
         VarLinesMap                           varLines;
         std::map<bool, std::vector<unsigned>> freeConstLinesMap;
+
+        bool                       recycleConstantLines = false;
+        std::optional<std::size_t> constantLineBudget;
+        // The acquired constant lines that were not released yet with the value of each line prior to its acquisition
+        std::vector<std::pair<unsigned, bool>> acquiredConstantLines;
+        std::size_t                            nRequestedConstantLines = 0;
+        std::size_t                            nAddedConstantLines     = 0;
+
+        bool                                  memoizeModuleSynthesis   = false;
+        std::size_t                           nReplayedModuleSyntheses = 0;
+        std::shared_ptr<ModuleSynthesisCache> moduleSynthesisCache     = std::make_shared<ModuleSynthesisCache>();
+        // The hierarchical circuit whose top-level circuit is synthesized, in which case the (un)calls of modules are synthesized as instances of the definitions of their cached syntheses
+        HierarchicalCircuit* hierarchy = nullptr;
+
+        // The minimum number of gates of instantiated iterations created by each synthesis thread
+        static constexpr std::size_t MIN_GATES_PER_SYNTHESIS_THREAD = 4096U;
+
+        bool                                     instantiateLoopBodyTemplates = false;
+        std::size_t                              nInstantiatedLoopIterations  = 0;
+        std::size_t                              nSynthesisThreads            = 1;
+        std::optional<LoopBodyTemplateRecording> loopBodyTemplateRecording;
+
+        bool                                                  eliminateCommonSubexpressions = false;
+        std::size_t                                           nReusedSubexpressions         = 0;
+        std::map<CommonSubexpressionKey, CommonSubexpression> commonSubexpressions;
+        // The number of modifications of each line that were reported by invalidateCommonSubexpressions(...)
+        std::vector<std::size_t> lineVersions;
+        // The lines of the left operands of all binary expressions whose right operand is currently evaluated
+        std::vector<unsigned> linesOfPendingOperands;
     };
 
 } // namespace syrec
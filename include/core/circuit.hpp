@@ -13,11 +13,17 @@
 #include "gate.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <cstddef>
 #include <fstream>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
+#include <set>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -46,15 +52,59 @@ namespace syrec {
 
         ~Circuit() = default;
 
+        Circuit(const Circuit&)            = default;
+        Circuit(Circuit&&)                 = default;
+        Circuit& operator=(const Circuit&) = default;
+        Circuit& operator=(Circuit&&)      = default;
+
+        /**
+         * @brief A contiguous range of gates of a circuit
+         *
+         * The range is identified by the index of its first gate and the index following its last gate.
+         */
+        struct GateRange {
+            std::size_t begin = 0;
+            std::size_t end   = 0;
+
+            [[nodiscard]] std::size_t size() const noexcept {
+                return end - begin;
+            }
+        };
+
         /**
          * @brief Returns the number of gates
          *
-         * This method returns the number of gates in the circuit.
+         * This method returns the number of gates in the circuit, including the gates only counted in the cost estimation mode.
          *
          * @return Number of gates
          */
-        [[nodiscard]] auto numGates() const {
-            return gates.size();
+        [[nodiscard]] std::size_t numGates() const {
+            return gates.size() + countedGates.size();
+        }
+
+        /**
+         * Enable the cost estimation mode of the circuit.
+         *
+         * In the cost estimation mode, gates added to the circuit are only validated and counted while neither their control lines nor annotations are stored.
+         * Thus, the circuit does not contain any gates that can be iterated while the number of gates, the quantum cost and the transistor cost of the circuit
+         * are determined as if the gates were created. All functions adding gates to the circuit return a placeholder gate instead of the added gate, which only has the
+         * type and the target lines of the added gate and is not part of the circuit.
+         * @return Whether the cost estimation mode could be enabled, which is only possible if the circuit does not contain any gates.
+         */
+        [[maybe_unused]] bool enableCostEstimationMode() {
+            if (numGates() != 0) {
+                return false;
+            }
+            costEstimationMode = true;
+            return true;
+        }
+
+        /**
+         * Determine whether the gates added to the circuit are only counted.
+         * @return Whether the cost estimation mode is enabled
+         */
+        [[nodiscard]] bool isInCostEstimationMode() const noexcept {
+            return costEstimationMode;
         }
 
         /**
@@ -74,8 +124,9 @@ namespace syrec {
          */
         void setLines(unsigned l) {
             lines = l;
-            inputs.resize(lines, "i");
-            outputs.resize(lines, "o");
+            inputs.resize(lines, explicitLineName("i"));
+            outputs.resize(lines, explicitLineName("o"));
+            invalidateFormattedLineNames();
             constants.resize(lines, constant());
             garbage.resize(lines, false);
         }
@@ -137,8 +188,8 @@ namespace syrec {
      * @param inputs Input names
      */
         void setInputs(const std::vector<std::string>& in) {
-            inputs = in;
-            inputs.resize(lines, "i");
+            inputs = explicitLineNames(in, "i");
+            formattedInputs.reset();
         }
 
         /**
@@ -151,7 +202,31 @@ namespace syrec {
      * @return Input names
      */
         [[nodiscard]] const std::vector<std::string>& getInputs() const {
-            return inputs;
+            if (!formattedInputs.has_value()) {
+                formattedInputs = formatInputs();
+            }
+            return *formattedInputs;
+        }
+
+        /**
+         * @brief Formats the input names of the lines in a circuit
+         *
+         * Unlike getInputs(), the formatted names are not kept by the circuit.
+         *
+         * @return Input names
+         */
+        [[nodiscard]] std::vector<std::string> formatInputs() const {
+            return formatLineNames(inputs);
+        }
+
+        /**
+         * @brief Returns the input name of a line in a circuit
+         *
+         * @param line The line whose input name shall be returned
+         * @return Input name of the line
+         */
+        [[nodiscard]] std::string getInput(const Gate::Line line) const {
+            return formatLineName(inputs.at(line));
         }
 
         /**
@@ -164,8 +239,8 @@ namespace syrec {
      * @param outputs Output names
      */
         void setOutputs(const std::vector<std::string>& out) {
-            outputs = out;
-            outputs.resize(lines, "o");
+            outputs = explicitLineNames(out, "o");
+            formattedOutputs.reset();
         }
 
         /**
@@ -178,7 +253,31 @@ namespace syrec {
      * @return Output names
      */
         [[nodiscard]] const std::vector<std::string>& getOutputs() const {
-            return outputs;
+            if (!formattedOutputs.has_value()) {
+                formattedOutputs = formatOutputs();
+            }
+            return *formattedOutputs;
+        }
+
+        /**
+         * @brief Formats the output names of the lines in a circuit
+         *
+         * Unlike getOutputs(), the formatted names are not kept by the circuit.
+         *
+         * @return Output names
+         */
+        [[nodiscard]] std::vector<std::string> formatOutputs() const {
+            return formatLineNames(outputs);
+        }
+
+        /**
+         * @brief Returns the output name of a line in a circuit
+         *
+         * @param line The line whose output name shall be returned
+         * @return Output name of the line
+         */
+        [[nodiscard]] std::string getOutput(const Gate::Line line) const {
+            return formatLineName(outputs.at(line));
         }
 
         /**
@@ -318,6 +417,14 @@ namespace syrec {
             return false;
         }
 
+        /**
+         * Get the active global gate annotations that are added to all future gates added to the circuit.
+         * @return The active global gate annotations
+         */
+        [[nodiscard]] const std::map<std::string, std::string, std::less<>>& getGlobalGateAnnotations() const noexcept {
+            return activeGlobalGateAnnotations;
+        }
+
         /**
        * @brief Add a line to a circuit with specifying all meta-data
        *
@@ -334,14 +441,88 @@ namespace syrec {
        */
         unsigned addLine(const std::string& input, const std::string& output, const constant& c = constant(), bool g = false) {
             lines += 1;
-            inputs.emplace_back(input);
-            outputs.emplace_back(output);
+            inputs.emplace_back(explicitLineName(input));
+            outputs.emplace_back(explicitLineName(output));
+            invalidateFormattedLineNames();
             constants.emplace_back(c);
             garbage.emplace_back(g);
 
             return lines - 1;
         }
 
+        /**
+         * @brief Add the lines of a variable to a circuit
+         *
+         * One line is added per bit of every element of the variable. The lines are ordered by the elements of the variable in row-major order and by the bits of an element
+         * within the lines of the element. Both the input and output name of a line are given by <name>[<index of first dimension>]...[<index of last dimension>].<bit>.
+         *
+         * Instead of a string per line, only the name, dimensions and bitwidth of the variable are stored once while the names of the lines are formatted on access.
+         *
+         * @param variableName Name of the variable
+         * @param dimensions Dimensions of the variable
+         * @param bitwidth Bitwidth of an element of the variable
+         * @param c Constant value of the lines (Default: Not constant)
+         * @param g If true, the lines are garbage lines
+         *
+         * @return The index of the first added line
+         */
+        unsigned addLinesOfVariable(const std::string& variableName, const std::vector<unsigned>& dimensions, const unsigned bitwidth, const constant& c = constant(), bool g = false) {
+            unsigned numLinesOfVariable = bitwidth;
+            for (const auto dimension: dimensions) {
+                numLinesOfVariable *= dimension;
+            }
+
+            const unsigned firstLine = lines;
+            if (numLinesOfVariable == 0) {
+                return firstLine;
+            }
+
+            const auto scheme = static_cast<unsigned>(lineNameSchemes.size());
+            lineNameSchemes.emplace_back(LineNameScheme{variableName, dimensions, bitwidth});
+
+            lines += numLinesOfVariable;
+            inputs.reserve(lines);
+            outputs.reserve(lines);
+            for (unsigned index = 0; index < numLinesOfVariable; ++index) {
+                inputs.emplace_back(LineName{scheme, index});
+                outputs.emplace_back(LineName{scheme, index});
+            }
+            invalidateFormattedLineNames();
+            constants.resize(lines, c);
+            garbage.resize(lines, g);
+            return firstLine;
+        }
+
+        /**
+         * @brief Add a copy of a line of a circuit with all of its meta-data
+         *
+         * Copies of the lines of this circuit keep the compact representation of their names, the names of lines of other circuits are copied as strings.
+         *
+         * @param circuit The circuit containing the line to copy
+         * @param line The line to copy
+         *
+         * @return The index of the newly added line
+         */
+        unsigned addLineCopy(const Circuit& circuit, const Gate::Line line) {
+            if (&circuit != this) {
+                return addLine(circuit.getInput(line), circuit.getOutput(line), circuit.getConstants().at(line), circuit.getGarbage().at(line));
+            }
+
+            // Copy the meta-data before adding the line since the containers of the meta-data could be reallocated
+            const LineName input         = inputs.at(line);
+            const LineName output        = outputs.at(line);
+            const constant constantValue = constants.at(line);
+            const bool     isGarbage     = garbage.at(line);
+
+            lines += 1;
+            inputs.emplace_back(input);
+            outputs.emplace_back(output);
+            invalidateFormattedLineNames();
+            constants.emplace_back(constantValue);
+            garbage.emplace_back(isGarbage);
+            return lines - 1;
+        }
+
         [[maybe_unused]] Gate::ptr createAndAddToffoliGate(const Gate::Line controlLineOne, const Gate::Line controlLineTwo, const Gate::Line targetLine) {
             // The defined function signature expecting two control lines might be misleading since a toffoli gate with only one control line can be implemented as a CNOT gate thus we allow
             // that the first and second control lines are equal
@@ -376,6 +557,128 @@ namespace syrec {
             return createAndAddGate(Gate::Type::Fredkin, std::nullopt, Gate::LinesLookup({targetLineOne, targetLineTwo}));
         }
 
+        /**
+         * Create and add a copy of a gate (possibly of another circuit) to the circuit.
+         *
+         * @remarks The same restrictions as for any other gate added to the circuit apply, i.e. the control lines of the active control line propagation scopes are added to the copy.
+         * @param gate The gate to copy
+         * @param lineMapping Optional remapping of the lines of \p gate, line l of the gate is mapped to lineMapping[l]. Lines without an entry in the mapping keep their index.
+         * @return A smart pointer to the created gate instance. If no gate was created a nullptr is returned.
+         */
+        [[maybe_unused]] Gate::ptr createAndAddGateCopy(const Gate& gate, const std::vector<Gate::Line>& lineMapping = {}) {
+            const auto mapLine = [&lineMapping](const Gate::Line line) {
+                return line < lineMapping.size() ? lineMapping[line] : line;
+            };
+
+            Gate::LinesLookup controlLines;
+            for (const auto controlLine: gate.controls) {
+                controlLines.emplace(mapLine(controlLine));
+            }
+            Gate::LinesLookup targetLines;
+            for (const auto targetLine: gate.targets) {
+                targetLines.emplace(mapLine(targetLine));
+            }
+
+            // Two distinct target lines that are mapped onto the same line cannot be represented by a gate of the same type
+            if (targetLines.size() != gate.targets.size()) {
+                return nullptr;
+            }
+            return createAndAddGate(gate.type, controlLines, targetLines);
+        }
+
+        /**
+         * Mark the beginning of a range of gates that will be added to the circuit.
+         * @return An empty gate range starting at the next gate added to the circuit
+         */
+        [[nodiscard]] GateRange beginGateRange() const noexcept {
+            return {numGates(), numGates()};
+        }
+
+        /**
+         * Mark the end of a range of gates, i.e. the range will contain all gates added to the circuit since its beginning was marked.
+         * @param gateRange The gate range whose end shall be set to the current number of gates of the circuit
+         */
+        void endGateRange(GateRange& gateRange) const noexcept {
+            gateRange.end = numGates();
+        }
+
+        /**
+         * Append copies of a range of gates (possibly of another circuit or of this circuit) to the circuit.
+         *
+         * @remarks The same restrictions as for gates created by createAndAddGateCopy(...) apply. The annotations of the gates of the range overwrite the values of the active global gate annotations of their copies.
+         * @param source The circuit containing the gates of the range
+         * @param gateRange The range of gates to append
+         * @param lineMapping Optional remapping of the lines of the gates, line l of a gate is mapped to lineMapping[l]. Lines without an entry in the mapping keep their index.
+         * @return Whether copies of all gates of the range were added to the circuit.
+         */
+        [[maybe_unused]] bool appendGateRange(const Circuit& source, const GateRange& gateRange, const std::vector<Gate::Line>& lineMapping = {}) {
+            return appendCopiesOfGateRange(source, gateRange, lineMapping, false);
+        }
+
+        /**
+         * Append the inverse of a range of gates (possibly of another circuit or of this circuit) to the circuit.
+         *
+         * Since both Toffoli and Fredkin gates are self-inverse, the inverse consists of copies of the gates of the range in reverse order.
+         * @remarks The same restrictions as for gates created by createAndAddGateCopy(...) apply. The copies are only annotated with the active global gate annotations.
+         * @param source The circuit containing the gates of the range
+         * @param gateRange The range of gates to invert
+         * @param lineMapping Optional remapping of the lines of the gates, line l of a gate is mapped to lineMapping[l]. Lines without an entry in the mapping keep their index.
+         * @return Whether copies of all gates of the range were added to the circuit.
+         */
+        [[maybe_unused]] bool appendInverseOfGateRange(const Circuit& source, const GateRange& gateRange, const std::vector<Gate::Line>& lineMapping = {}) {
+            return appendCopiesOfGateRange(source, gateRange, lineMapping, true);
+        }
+
+        /**
+         * Move all gates of another circuit, including their annotations, to the end of the circuit.
+         *
+         * This allows gates to be created concurrently in separate circuits which are afterwards concatenated in a deterministic order.
+         * @remarks Neither the propagated control lines nor the active global gate annotations of the circuit are applied to the moved gates.
+         * @param other The circuit whose gates are moved, which does not contain any gates afterwards
+         * @return Whether all gates were moved, which is only the case if all lines of the gates of the other circuit are lines of this circuit and both circuits are either in the cost estimation mode or not.
+         */
+        [[maybe_unused]] bool appendGatesMovedFrom(Circuit& other) {
+            if (isInCostEstimationMode() != other.isInCostEstimationMode()) {
+                return false;
+            }
+            if (isInCostEstimationMode()) {
+                // The control lines propagated in the other circuit are unrelated to the ones of this circuit
+                for (auto countedGate: other.countedGates) {
+                    countedGate.propagatedControlLinesVersion = UNRELATED_PROPAGATED_CONTROL_LINES_VERSION;
+                    countedGates.emplace_back(countedGate);
+                }
+                other.countedGates.clear();
+                return true;
+            }
+            if (!std::all_of(other.gates.cbegin(), other.gates.cend(), [&](const Gate::ptr& gate) { return areLinesWithinRange(gate->controls) && areLinesWithinRange(gate->targets); })) {
+                return false;
+            }
+
+            gates.reserve(gates.size() + other.gates.size());
+            std::move(other.gates.begin(), other.gates.end(), std::back_inserter(gates));
+            other.gates.clear();
+            // The annotations are keyed by the address of their gate which does not change when moving the gate
+            annotations.merge(other.annotations);
+            other.annotations.clear();
+            return true;
+        }
+
+        /**
+         * Remove all gates starting at the given index, including their annotations, from the circuit.
+         * @param begin The index of the first removed gate
+         * @return Whether the gates were removed, which is not supported in the cost estimation mode
+         */
+        [[maybe_unused]] bool removeGatesFrom(const std::size_t begin) {
+            if (isInCostEstimationMode() || begin > gates.size()) {
+                return false;
+            }
+            for (auto gate = std::next(gates.cbegin(), static_cast<std::ptrdiff_t>(begin)); gate != gates.cend(); ++gate) {
+                annotations.erase(gate->get());
+            }
+            gates.erase(std::next(gates.begin(), static_cast<std::ptrdiff_t>(begin)), gates.end());
+            return true;
+        }
+
         /**
          * Activate a new control line propagation scope.
          *
@@ -403,6 +706,7 @@ namespace syrec {
                 return;
             }
 
+            ++propagatedControlLinesVersion;
             const auto& localControlLineScope = controlLinePropagationScopes.back();
             for (const auto [controlLine, wasControlLineActiveInParentScope]: localControlLineScope) {
                 if (wasControlLineActiveInParentScope) {
@@ -436,6 +740,7 @@ namespace syrec {
             }
 
             aggregateOfPropagatedControlLines.erase(controlLine);
+            ++propagatedControlLinesVersion;
             return true;
         }
 
@@ -463,15 +768,27 @@ namespace syrec {
                 localControlLineScope.emplace(std::make_pair(controlLine, aggregateOfPropagatedControlLines.count(controlLine) != 0));
             }
             aggregateOfPropagatedControlLines.emplace(controlLine);
+            ++propagatedControlLinesVersion;
             return true;
         }
 
+        /**
+         * Get the control lines of all active control line propagation scopes, i.e. the control lines that are added to any future gate added to the circuit.
+         * @return The aggregate of all propagated control lines
+         */
+        [[nodiscard]] const Gate::LinesLookup& getPropagatedControlLines() const noexcept {
+            return aggregateOfPropagatedControlLines;
+        }
+
         // SIGNALS
         [[nodiscard]] Gate::cost_t quantumCost() const {
             Gate::cost_t cost = 0U;
             for (const auto& g: gates) {
                 cost += g->quantumCost(lines);
             }
+            for (const auto& countedGate: countedGates) {
+                cost += Gate::quantumCost(countedGate.type, countedGate.nControls, lines);
+            }
             return cost;
         }
 
@@ -480,6 +797,9 @@ namespace syrec {
             for (const auto& g: gates) {
                 cost += (8ULL * g->controls.size());
             }
+            for (const auto& countedGate: countedGates) {
+                cost += (8ULL * countedGate.nControls);
+            }
             return cost;
         }
 
@@ -511,6 +831,72 @@ namespace syrec {
             return true;
         }
 
+        /**
+         * @brief Convert circuit to the RevLib .real format.
+         *
+         * The lines are declared as the variables x0, ..., xN-1 while the input and output names of the lines are used as the names of the inputs and outputs of the circuit.
+         * Since the .real format only allows letters, digits and underscores in these names, all other characters are replaced by an underscore and names that would be
+         * ambiguous afterwards are suffixed with the index of their line.
+         * @return .real string
+         */
+        [[nodiscard]] std::string toReal() const {
+            std::vector<std::string> variables(lines);
+            for (unsigned line = 0; line < lines; ++line) {
+                variables[line] = "x" + std::to_string(line);
+            }
+
+            std::stringstream ss;
+            ss << ".version 2.0\n.numvars " << lines << "\n.variables";
+            for (const auto& variable: variables) {
+                ss << " " << variable;
+            }
+            const std::vector<std::string> inputNames  = formatInputs();
+            const std::vector<std::string> outputNames = formatOutputs();
+            for (const auto& [header, names]: {std::make_pair(".inputs", &inputNames), std::make_pair(".outputs", &outputNames)}) {
+                ss << "\n"
+                   << header;
+                for (const auto& ioName: getUniqueRealIoNames(*names, variables)) {
+                    ss << " " << ioName;
+                }
+            }
+            ss << "\n.constants ";
+            for (const auto& c: constants) {
+                ss << (c.has_value() ? (*c ? '1' : '0') : '-');
+            }
+            ss << "\n.garbage ";
+            for (const bool g: garbage) {
+                ss << (g ? '1' : '-');
+            }
+            ss << "\n.begin\n";
+            for (const auto& g: gates) {
+                ss << (g->type == Gate::Type::Fredkin ? 'f' : 't') << g->controls.size() + g->targets.size();
+                for (const auto& control: g->controls) {
+                    ss << " " << variables[control];
+                }
+                for (const auto& target: g->targets) {
+                    ss << " " << variables[target];
+                }
+                ss << "\n";
+            }
+            ss << ".end\n";
+            return ss.str();
+        }
+
+        /**
+         * @brief Write circuit to .real file.
+         * @param filename Filename (should end with .real)
+         * @return True if successful, false otherwise
+         */
+        [[nodiscard]] bool toRealFile(const std::string& filename) const {
+            std::ofstream file(filename);
+            if (!file.is_open()) {
+                return false; // GCOVR_EXCL_LINE
+            }
+            file << toReal();
+            file.close();
+            return true;
+        }
+
     protected:
         /**
          * Create and add a gate of type \p gateType to the circuit.
@@ -527,6 +913,9 @@ namespace syrec {
             if ((controlLines.has_value() && !areLinesWithinRange(*controlLines)) || !areLinesWithinRange(targetLines)) {
                 return nullptr;
             }
+            if (isInCostEstimationMode()) {
+                return countGate(gateType, controlLines, targetLines);
+            }
 
             auto gateInstance  = std::make_shared<Gate>();
             gateInstance->type = gateType;
@@ -562,19 +951,238 @@ namespace syrec {
             return std::all_of(linesToCheck.cbegin(), linesToCheck.cend(), [&](const Gate::Line line) { return isLineWithinRange(line); });
         }
 
+        /**
+         * Determine the names of the inputs or outputs of the lines as written to a .real file, i.e. names only consisting of letters, digits and underscores that are
+         * neither equal to one another nor to the name of a variable.
+         * @param names The input or output names of the lines
+         * @param variables The names of the variables declared for the lines
+         * @return The unique names of the inputs or outputs of the lines
+         */
+        [[nodiscard]] static std::vector<std::string> getUniqueRealIoNames(const std::vector<std::string>& names, const std::vector<std::string>& variables) {
+            std::set<std::string, std::less<>> usedNames(variables.cbegin(), variables.cend());
+            std::vector<std::string>           uniqueNames;
+            uniqueNames.reserve(names.size());
+            for (std::size_t line = 0; line < names.size(); ++line) {
+                std::string ioName = names[line];
+                std::replace_if(ioName.begin(), ioName.end(), [](const char c) { return std::isalnum(static_cast<unsigned char>(c)) == 0 && c != '_'; }, '_');
+                if (ioName.empty() || usedNames.count(ioName) != 0) {
+                    ioName += "_" + std::to_string(line);
+                }
+                while (usedNames.count(ioName) != 0) {
+                    ioName += "_";
+                }
+                usedNames.emplace(ioName);
+                uniqueNames.emplace_back(std::move(ioName));
+            }
+            return uniqueNames;
+        }
+
+        /**
+         * Validate and count a gate added in the cost estimation mode without creating an instance of the gate.
+         * @param gateType The type of the gate
+         * @param controlLines The control lines of the gate, to which the registered control lines of all active control line propagation scopes are added
+         * @param targetLines The target lines of the gate
+         * @return A placeholder gate with the type and target lines of the gate if the gate was counted, otherwise a nullptr.
+         */
+        [[nodiscard]] Gate::ptr countGate(const Gate::Type gateType, const std::optional<Gate::LinesLookup>& controlLines, const Gate::LinesLookup& targetLines) {
+            const auto isControlLine = [&](const Gate::Line line) {
+                return aggregateOfPropagatedControlLines.count(line) != 0 || (controlLines.has_value() && controlLines->count(line) != 0);
+            };
+            if (std::any_of(targetLines.cbegin(), targetLines.cend(), isControlLine)) {
+                return nullptr;
+            }
+
+            std::size_t nControls = aggregateOfPropagatedControlLines.size();
+            if (controlLines.has_value()) {
+                nControls += static_cast<std::size_t>(std::count_if(controlLines->cbegin(), controlLines->cend(), [&](const Gate::Line line) { return aggregateOfPropagatedControlLines.count(line) == 0; }));
+            }
+            countedGates.emplace_back(CountedGate{gateType, nControls, propagatedControlLinesVersion});
+
+            // Each counted gate gets its own placeholder since the returned gates may be modified by the caller
+            auto placeholderGate     = std::make_shared<Gate>();
+            placeholderGate->type    = gateType;
+            placeholderGate->targets = targetLines;
+            return placeholderGate;
+        }
+
+        /**
+         * Count copies of a range of gates counted in the cost estimation mode of this circuit.
+         *
+         * Since the lines of the counted gates are not known, the copy of a gate is only counted if its control lines are known to be equal to the ones of
+         * the gate, i.e. if no control lines are propagated or if the propagated control lines did not change since the gate was counted.
+         * @param gateRange The range of gates to copy
+         * @return Whether copies of all gates of the range were counted
+         */
+        bool countCopiesOfGateRange(const GateRange& gateRange) {
+            if (!aggregateOfPropagatedControlLines.empty() && std::any_of(std::next(countedGates.cbegin(), static_cast<std::ptrdiff_t>(gateRange.begin)), std::next(countedGates.cbegin(), static_cast<std::ptrdiff_t>(gateRange.end)), [&](const CountedGate& countedGate) { return countedGate.propagatedControlLinesVersion != propagatedControlLinesVersion; })) {
+                return false;
+            }
+
+            // Reserving the required capacity upfront prevents the reallocation of the counted gates while the range is copied
+            countedGates.reserve(countedGates.size() + gateRange.size());
+            for (std::size_t i = gateRange.begin; i < gateRange.end; ++i) {
+                CountedGate copy                   = countedGates[i];
+                copy.propagatedControlLinesVersion = propagatedControlLinesVersion;
+                countedGates.emplace_back(copy);
+            }
+            return true;
+        }
+
+        bool appendCopiesOfGateRange(const Circuit& source, const GateRange& gateRange, const std::vector<Gate::Line>& lineMapping, const bool inReverseOrder) {
+            if (gateRange.begin > gateRange.end || gateRange.end > source.numGates()) {
+                return false;
+            }
+            if (source.isInCostEstimationMode()) {
+                // The inverse of a range of gates consists of the same gates, which only differ in their order that does not influence the costs of the circuit
+                return &source == this && lineMapping.empty() && countCopiesOfGateRange(gateRange);
+            }
+
+            // Reserving the required capacity upfront prevents the reallocation of the gates while the range is copied, which would invalidate the references
+            // to the gates of the range if the source is this circuit.
+            gates.reserve(gates.size() + gateRange.size());
+            const bool canCopyGatesVerbatim = lineMapping.empty() && aggregateOfPropagatedControlLines.empty() && !isInCostEstimationMode();
+            for (std::size_t i = 0; i < gateRange.size(); ++i) {
+                const Gate& gate = *source.gates[inReverseOrder ? gateRange.end - 1 - i : gateRange.begin + i];
+
+                Gate::ptr gateCopy;
+                if (canCopyGatesVerbatim) {
+                    if (!areLinesWithinRange(gate.controls) || !areLinesWithinRange(gate.targets)) {
+                        return false;
+                    }
+                    gateCopy = std::make_shared<Gate>(gate);
+                    gates.emplace_back(gateCopy);
+                    for (const auto& [annotationKey, annotationValue]: activeGlobalGateAnnotations) {
+                        annotate(*gateCopy, annotationKey, annotationValue);
+                    }
+                } else {
+                    gateCopy = createAndAddGateCopy(gate, lineMapping);
+                    if (gateCopy == nullptr) {
+                        return false;
+                    }
+                }
+
+                if (inReverseOrder) {
+                    continue;
+                }
+                if (const auto gateAnnotations = source.annotations.find(&gate); gateAnnotations != source.annotations.cend()) {
+                    for (const auto& [annotationKey, annotationValue]: gateAnnotations->second) {
+                        annotate(*gateCopy, annotationKey, annotationValue);
+                    }
+                }
+            }
+            return true;
+        }
+
     private:
+        /**
+         * @brief The naming scheme of the lines of a variable added via addLinesOfVariable
+         */
+        struct LineNameScheme {
+            std::string           variableName;
+            std::vector<unsigned> dimensions;
+            unsigned              bitwidth;
+
+            /**
+             * Format the name of the line of the variable at the given index, with the index being decomposed into the indices of the dimensions and the bit in row-major order.
+             * @param index The index of the line relative to the first line of the variable
+             * @return The name of the line
+             */
+            [[nodiscard]] std::string format(const unsigned index) const {
+                std::string suffix  = "." + std::to_string(index % bitwidth);
+                unsigned    element = index / bitwidth;
+                for (auto dimension = dimensions.crbegin(); dimension != dimensions.crend(); ++dimension) {
+                    suffix = "[" + std::to_string(element % *dimension) + "]" + suffix;
+                    element /= *dimension;
+                }
+                return variableName + suffix;
+            }
+        };
+
+        /**
+         * @brief The name of a line, either referring to an explicitly named line or to a line of a variable
+         *
+         * For explicitly named lines, the index refers to the interned names, otherwise to the line relative to the first line of the variable.
+         */
+        struct LineName {
+            unsigned scheme;
+            unsigned index;
+        };
+
+        static constexpr unsigned EXPLICIT_LINE_NAME = std::numeric_limits<unsigned>::max();
+
+        [[nodiscard]] LineName explicitLineName(const std::string& lineName) {
+            const auto [id, inserted] = explicitNameIds.try_emplace(lineName, static_cast<unsigned>(explicitNames.size()));
+            if (inserted) {
+                explicitNames.emplace_back(lineName);
+            }
+            return LineName{EXPLICIT_LINE_NAME, id->second};
+        }
+
+        [[nodiscard]] std::vector<LineName> explicitLineNames(const std::vector<std::string>& lineNames, const std::string& defaultName) {
+            std::vector<LineName> result;
+            result.reserve(lines);
+            for (std::size_t line = 0; line < lines; ++line) {
+                result.emplace_back(explicitLineName(line < lineNames.size() ? lineNames[line] : defaultName));
+            }
+            return result;
+        }
+
+        [[nodiscard]] std::string formatLineName(const LineName& lineName) const {
+            if (lineName.scheme == EXPLICIT_LINE_NAME) {
+                return explicitNames[lineName.index];
+            }
+            return lineNameSchemes[lineName.scheme].format(lineName.index);
+        }
+
+        [[nodiscard]] std::vector<std::string> formatLineNames(const std::vector<LineName>& lineNames) const {
+            std::vector<std::string> result;
+            result.reserve(lineNames.size());
+            for (const auto& lineName: lineNames) {
+                result.emplace_back(formatLineName(lineName));
+            }
+            return result;
+        }
+
+        void invalidateFormattedLineNames() noexcept {
+            formattedInputs.reset();
+            formattedOutputs.reset();
+        }
+
         std::vector<std::shared_ptr<Gate>> gates;
         unsigned                           lines = 0;
 
-        std::vector<std::string> inputs;
-        std::vector<std::string> outputs;
-        std::vector<constant>    constants;
-        std::vector<bool>        garbage;
-        std::string              name;
+        std::vector<LineName>                     inputs;
+        std::vector<LineName>                     outputs;
+        std::vector<LineNameScheme>               lineNameSchemes;
+        std::vector<std::string>                  explicitNames;
+        std::unordered_map<std::string, unsigned> explicitNameIds;
+        std::vector<constant>                     constants;
+        std::vector<bool>                         garbage;
+        std::string                               name;
+
+        // The formatted names returned by getInputs() and getOutputs() until the names of the lines change
+        mutable std::optional<std::vector<std::string>> formattedInputs;
+        mutable std::optional<std::vector<std::string>> formattedOutputs;
 
         Gate::LinesLookup                                 aggregateOfPropagatedControlLines;
         std::vector<std::unordered_map<Gate::Line, bool>> controlLinePropagationScopes;
 
+        /**
+         * @brief The information about a gate counted in the cost estimation mode that is required to determine its costs
+         */
+        struct CountedGate {
+            Gate::Type  type      = Gate::Type::None;
+            std::size_t nControls = 0;
+            /// The version of the propagated control lines at the time the gate was counted
+            std::size_t propagatedControlLinesVersion = 0;
+        };
+        static constexpr std::size_t UNRELATED_PROPAGATED_CONTROL_LINES_VERSION = std::numeric_limits<std::size_t>::max();
+
+        std::vector<CountedGate> countedGates;
+        bool                     costEstimationMode = false;
+        // Incremented whenever the propagated control lines may have changed
+        std::size_t propagatedControlLinesVersion = 0;
+
         std::map<const Gate*, std::map<std::string, std::string>> annotations;
         // To be able to use a std::string_view key lookup (heterogeneous lookup) in a std::map/std::unordered_set
         // we need to define the transparent comparator (std::less<>). This feature is only available starting with C++17
@@ -45,10 +45,22 @@ namespace syrec {
         using ptr         = std::shared_ptr<Gate>;
 
         [[nodiscard]] cost_t quantumCost(unsigned lines) const {
+            return quantumCost(type, controls.size(), lines);
+        }
+
+        /**
+         * @brief Determine the quantum cost of a gate without requiring an instance of the gate
+         *
+         * @param type The type of the gate
+         * @param nControls The number of control lines of the gate
+         * @param lines The number of lines of the circuit containing the gate
+         * @return The quantum cost of the gate
+         */
+        [[nodiscard]] static cost_t quantumCost(const Type type, const std::size_t nControls, const unsigned lines) {
             cost_t costs = 0U;
 
             const unsigned n = lines;
-            std::size_t    c = controls.size();
+            std::size_t    c = nControls;
 
             if (type == Gate::Type::Fredkin) {
                 c += 1U;
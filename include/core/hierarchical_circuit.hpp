@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Circuit in which sub-circuits are stored once and instantiated by reference
+     *
+     * A hierarchical circuit consists of definitions, each storing its gates in a circuit together with the instances of other definitions placed in between these gates.
+     * An instance maps the lines of the instantiated definition to lines of the enclosing definition, adds its control lines to all gates of the instantiated definition
+     * and can apply the inverse of the instantiated definition, i.e. its gates and instances in reverse order (since both Toffoli and Fredkin gates are self-inverse).
+     *
+     * The first definition is the top-level circuit whose lines are the lines of the flattened circuit. A definition can only instantiate definitions that were added before it,
+     * with the exception of the top-level circuit which can instantiate any other definition, which prevents cyclic instantiations.
+     */
+    class HierarchicalCircuit {
+    public:
+        using DefinitionId = std::size_t;
+
+        static constexpr DefinitionId TOP_LEVEL_DEFINITION = 0;
+
+        /**
+         * @brief The instantiation of a definition inside another definition
+         */
+        struct Instance {
+            DefinitionId            definition = TOP_LEVEL_DEFINITION;
+            std::vector<Gate::Line> lineMapping;        ///< Line l of the instantiated definition is mapped to line lineMapping[l] of the enclosing definition
+            bool                    isInverted = false; ///< Whether the inverse of the instantiated definition is applied
+            Gate::LinesLookup       controls;           ///< Lines of the enclosing definition added as control lines to all gates of the instantiated definition
+        };
+
+        /**
+         * @brief A sub-circuit of the hierarchical circuit
+         *
+         * Each instance is stored with the number of gates of the circuit preceding it, instances with the same number of preceding gates are applied in the order in which they were added.
+         */
+        struct Definition {
+            std::string                                   name;
+            Circuit                                       circuit;
+            std::vector<std::pair<std::size_t, Instance>> instances;
+        };
+
+        HierarchicalCircuit();
+
+        /**
+         * Get the circuit of the top-level definition to which gates can be added directly.
+         * @return The circuit of the top-level definition
+         */
+        [[nodiscard]] Circuit& getTopLevelCircuit() {
+            return definitions.front().circuit;
+        }
+
+        [[nodiscard]] const Circuit& getTopLevelCircuit() const {
+            return definitions.front().circuit;
+        }
+
+        /**
+         * Add a definition that can be instantiated afterwards.
+         * @param name The name of the definition (e.g. the name of the synthesized module)
+         * @param circuit The lines and gates of the definition
+         * @param instances The instances of the definition with the number of gates of the circuit preceding each instance
+         * @return The identifier of the added definition or std::nullopt if any of the instances is not valid (see isValidInstance(...)) or would succeed the gates of the circuit
+         */
+        std::optional<DefinitionId> addDefinition(const std::string& name, Circuit circuit, std::vector<std::pair<std::size_t, Instance>> instances = {});
+
+        [[nodiscard]] std::size_t numDefinitions() const noexcept {
+            return definitions.size();
+        }
+
+        [[nodiscard]] const Definition& getDefinition(const DefinitionId definition) const {
+            return definitions.at(definition);
+        }
+
+        /**
+         * Determine whether an instance can be added to a definition.
+         *
+         * This is only the case if the instantiated definition can be instantiated by the enclosing definition, its lines are mapped to distinct lines of the enclosing definition
+         * and the control lines of the instance are lines of the enclosing definition that are not used by the instantiated definition.
+         * @param parent The enclosing definition
+         * @param instance The instance to check
+         * @return Whether the instance can be added
+         */
+        [[nodiscard]] bool isValidInstance(DefinitionId parent, const Instance& instance) const;
+
+        /**
+         * Add an instance after all current gates and instances of a definition.
+         * @param parent The enclosing definition
+         * @param instance The instance to add
+         * @return Whether the instance was valid and thus added
+         */
+        bool addInstance(DefinitionId parent, Instance instance);
+
+        /**
+         * Remove all gates and instances added to a definition after the given number of gates and instances.
+         * @param definition The definition to truncate
+         * @param nGates The number of gates to keep
+         * @param nInstances The number of instances to keep
+         * @return Whether the gates and instances were removed, which is not possible if any of the kept instances would succeed a removed gate or if the circuit of the definition is in the cost estimation mode
+         */
+        bool truncate(DefinitionId definition, std::size_t nGates, std::size_t nInstances);
+
+        /**
+         * Determine the total number of instances of all definitions.
+         * @return The number of instances
+         */
+        [[nodiscard]] std::size_t numInstances() const;
+
+        /**
+         * Determine the number of gates of the flattened circuit without flattening the circuit.
+         * @return The number of gates of the flattened circuit
+         */
+        [[nodiscard]] std::size_t numGates() const;
+
+        /**
+         * Determine the quantum cost of the flattened circuit without flattening the circuit.
+         *
+         * The costs of each definition are determined once per number of additional control lines with which the definition is instantiated.
+         * @return The quantum cost of the flattened circuit
+         */
+        [[nodiscard]] Gate::cost_t quantumCost() const;
+
+        /**
+         * Determine the transistor cost of the flattened circuit without flattening the circuit.
+         * @return The transistor cost of the flattened circuit
+         */
+        [[nodiscard]] Gate::cost_t transistorCost() const;
+
+        /**
+         * Create the flat circuit in which all instances are replaced by the gates of their instantiated definitions.
+         *
+         * @remarks The gates of inverted instances are only annotated with the global gate annotations active in the flat circuit, similar to Circuit::appendInverseOfGateRange(...).
+         * @param circ The empty circuit to which the lines of the top-level circuit and the flattened gates are added
+         * @return Whether all gates could be added to the flat circuit
+         */
+        bool flatten(Circuit& circ) const;
+
+        /**
+         * Append the flattened gates of an instance to a circuit.
+         *
+         * Control lines propagated in the circuit are added to the appended gates in addition to the control lines of the instance.
+         * @param circ The circuit to which the gates are appended
+         * @param instance The instance whose lines are mapped to lines of the circuit
+         * @return Whether all gates could be added to the circuit
+         */
+        bool appendFlattenedInstance(Circuit& circ, const Instance& instance) const;
+
+        /**
+         * Visit the gates and instances of a definition in the order of their application or in the reverse order.
+         * @param definition The definition whose elements are visited
+         * @param inReverseOrder Whether the elements are visited in reverse order
+         * @param onGate Called with the index of each gate in the circuit of the definition, returning whether the visit shall continue
+         * @param onInstance Called with each instance of the definition, returning whether the visit shall continue
+         * @return Whether all elements were visited
+         */
+        template<typename OnGate, typename OnInstance>
+        static bool forEachElement(const Definition& definition, const bool inReverseOrder, OnGate&& onGate, OnInstance&& onInstance) {
+            const std::size_t nGates     = definition.circuit.numGates();
+            const std::size_t nInstances = definition.instances.size();
+            if (!inReverseOrder) {
+                std::size_t gate = 0;
+                for (const auto& [nPrecedingGates, instance]: definition.instances) {
+                    for (; gate < nPrecedingGates; ++gate) {
+                        if (!onGate(gate)) {
+                            return false;
+                        }
+                    }
+                    if (!onInstance(instance)) {
+                        return false;
+                    }
+                }
+                for (; gate < nGates; ++gate) {
+                    if (!onGate(gate)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            std::size_t gate = nGates;
+            for (std::size_t i = nInstances; i > 0; --i) {
+                const auto& [nPrecedingGates, instance] = definition.instances[i - 1];
+                for (; gate > nPrecedingGates; --gate) {
+                    if (!onGate(gate - 1)) {
+                        return false;
+                    }
+                }
+                if (!onInstance(instance)) {
+                    return false;
+                }
+            }
+            for (; gate > 0; --gate) {
+                if (!onGate(gate - 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    private:
+        // Definitions are only appended (or removed again from the back) so that references to the top-level circuit, e.g. by a synthesis, remain valid
+        std::deque<Definition> definitions;
+
+        [[nodiscard]] std::size_t  numGates(DefinitionId definition, std::map<DefinitionId, std::size_t>& numGatesOfDefinitions) const;
+        [[nodiscard]] Gate::cost_t quantumCost(DefinitionId definition, std::size_t nAdditionalControls, unsigned lines, std::map<std::pair<DefinitionId, std::size_t>, Gate::cost_t>& costsOfDefinitions) const;
+        [[nodiscard]] Gate::cost_t transistorCost(DefinitionId definition, std::size_t nAdditionalControls, std::map<std::pair<DefinitionId, std::size_t>, Gate::cost_t>& costsOfDefinitions) const;
+        bool                       appendFlattenedDefinition(Circuit& circ, DefinitionId definition, const std::vector<Gate::Line>& lineMapping, bool isInverted) const;
+    };
+} // namespace syrec
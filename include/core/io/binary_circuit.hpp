@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/circuit.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace syrec {
+    /**
+     * Write a circuit in the compact binary circuit format.
+     *
+     * The format starts with the magic bytes 'SYRC' followed by the format version, the number of lines and the names, constant values and garbage flags
+     * of the lines. Each gate is stored as its type, the number of its control and target lines as well as the indices of these lines. All integers are stored
+     * in little-endian byte order independent of the platform. Gate annotations are not stored.
+     * @param circ The circuit to write
+     * @param os The stream to write the circuit to
+     * @return Whether the circuit was written successfully
+     */
+    bool writeBinaryCircuit(const Circuit& circ, std::ostream& os);
+
+    /**
+     * Write a circuit in the compact binary circuit format to a file.
+     * @param circ The circuit to write
+     * @param filename The name of the file (should end with .bin)
+     * @return Whether the circuit was written successfully
+     */
+    bool writeBinaryCircuitFile(const Circuit& circ, const std::string& filename);
+
+    /**
+     * Read a circuit written in the compact binary circuit format.
+     * @param circ The empty circuit to which the lines and gates are added
+     * @param is The stream to read the circuit from
+     * @return Whether a valid circuit was read
+     */
+    bool readBinaryCircuit(Circuit& circ, std::istream& is);
+
+    /**
+     * Read a circuit written in the compact binary circuit format from a file.
+     * @param circ The empty circuit to which the lines and gates are added
+     * @param filename The name of the file
+     * @return Whether a valid circuit was read
+     */
+    bool readBinaryCircuitFile(Circuit& circ, const std::string& filename);
+} // namespace syrec
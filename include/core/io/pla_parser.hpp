@@ -25,6 +25,7 @@ namespace syrec {
 
     auto extend(TruthTable& tt) -> void;
 
-    bool readPla(TruthTable& tt, const std::string& filename);
+    // reads the cubes of the PLA file and, unless extendTable is false (e.g. to build the DD by buildDDFromCubes), extends the truth table
+    bool readPla(TruthTable& tt, const std::string& filename, bool extendTable = true);
 
 } // namespace syrec
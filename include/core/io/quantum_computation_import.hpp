@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/circuit.hpp"
+#include "ir/QuantumComputation.hpp"
+
+namespace syrec {
+    /**
+     * Import the gates of a quantum computation, e.g. read from a .real file or created by the DD-based synthesis, into a circuit.
+     *
+     * Qubit i of the quantum computation is mapped to line i of the circuit. Ancillary qubits are imported as lines with the constant value false while
+     * garbage qubits are imported as garbage lines. The lines are named after the quantum registers of the quantum computation.
+     * Since gates of the circuit only support positive control lines, each negative control line of a gate is negated before and after the gate.
+     * Only (multi-controlled) X and SWAP operations can be imported while identity operations are skipped.
+     * @param circ The empty circuit to which the lines and gates are added
+     * @param qc The quantum computation to import
+     * @return Whether all operations of the quantum computation could be imported
+     */
+    bool importQuantumComputation(Circuit& circ, const qc::QuantumComputation& qc);
+} // namespace syrec
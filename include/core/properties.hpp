@@ -125,6 +125,20 @@ namespace syrec {
             map[k] = value;
         }
 
+        /**
+     * @brief Iterator to the first property, ordered by their keys
+     */
+        [[nodiscard]] storage_type::const_iterator begin() const {
+            return map.cbegin();
+        }
+
+        /**
+     * @brief Iterator past the last property
+     */
+        [[nodiscard]] storage_type::const_iterator end() const {
+            return map.cend();
+        }
+
     private:
         storage_type map;
     };
@@ -12,6 +12,7 @@
 
 #include "core/syrec/variable.hpp"
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <utility>
@@ -33,6 +34,18 @@ namespace syrec {
 
         using vec = std::vector<ptr>;
 
+        /**
+         * @brief Kind of an expression
+         *
+         * Allows to dispatch on the type of an expression without relying on RTTI.
+         */
+        enum class Kind : std::uint8_t {
+            Numeric,
+            Variable,
+            Binary,
+            Shift
+        };
+
         /**
        * @brief Standard constructor
        */
@@ -51,6 +64,11 @@ namespace syrec {
        * @return Bit-width of the expression
        */
         [[nodiscard]] virtual unsigned bitwidth() const = 0;
+
+        /**
+         * @brief The kind of the expression which determines the type to which the expression can be cast
+         */
+        [[nodiscard]] virtual Kind kind() const = 0;
     };
 
     /**
@@ -118,6 +136,10 @@ namespace syrec {
             return bwidth;
         }
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Numeric;
+        }
+
         Number::ptr value = nullptr;
         unsigned    bwidth{};
     };
@@ -141,6 +163,10 @@ namespace syrec {
             return var->bitwidth();
         }
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Variable;
+        }
+
         VariableAccess::ptr var = nullptr;
     };
 
@@ -289,6 +315,10 @@ namespace syrec {
             }
         }
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Binary;
+        }
+
         Expression::ptr lhs = nullptr;
         unsigned        op{};
         Expression::ptr rhs = nullptr;
@@ -345,6 +375,10 @@ namespace syrec {
             return lhs->bitwidth();
         }
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Shift;
+        }
+
         Expression::ptr lhs = nullptr;
         unsigned        op{};
         Number::ptr     rhs = nullptr;
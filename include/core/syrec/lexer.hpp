@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace syrec {
+    /**
+     * @brief Token of a SyReC program
+     *
+     * Keywords are not distinguished from identifiers since whether a word is a keyword depends on its position in the program (e.g. a variable can be named like a keyword).
+     */
+    struct Token {
+        enum class Kind : std::uint8_t {
+            Identifier, ///< Sequence of alphanumeric characters and underscores containing at least one non-digit
+            Number,     ///< Sequence of digits
+            LeftParenthesis,
+            RightParenthesis,
+            LeftBracket,
+            RightBracket,
+            Comma,
+            Dot,
+            Colon,
+            Hash,
+            Dollar,
+            Swap, ///< <=>
+            Tilde,
+            Increment, ///< ++
+            Decrement, ///< --
+            Plus,
+            Minus,
+            Caret,
+            Star,
+            Slash,
+            Percent,
+            LogicalAnd, ///< &&
+            LogicalOr,  ///< ||
+            Ampersand,
+            Pipe,
+            Assign, ///< =
+            Equals, ///< ==
+            NotEquals,
+            Less,
+            Greater,
+            LessEquals,
+            GreaterEquals,
+            ShiftLeft,
+            ShiftRight,
+            EndOfInput,
+            Invalid ///< Character that cannot start a token or unterminated multi-line comment
+        };
+
+        Kind             kind = Kind::EndOfInput;
+        std::string_view text;           ///< The characters of the token in the program
+        std::size_t      offset     = 0; ///< The position of the first character of the token in the program
+        unsigned         lineNumber = 1; ///< The line of the first character of the token
+    };
+
+    /**
+     * @brief Lexer splitting a SyReC program into tokens
+     *
+     * Whitespace, semicolons as well as single-line (//) and multi-line comments are skipped between tokens. Operators are matched greedily, e.g. <=> is a single token.
+     * Since the state of the lexer only consists of its position, it can be copied to look ahead or to return to an earlier token.
+     */
+    class Lexer {
+    public:
+        /**
+         * @param content The SyReC program
+         * @param firstLineNumber The line number of the first line of the program, e.g. if the program is part of a larger file
+         */
+        explicit Lexer(const std::string_view content, const unsigned firstLineNumber = 1U):
+            content(content), lineNumber(firstLineNumber) {}
+
+        /**
+         * Determine the next token and advance the lexer past it.
+         * @return The next token, which is of kind Token::Kind::EndOfInput once all characters were consumed
+         */
+        Token next();
+
+        /**
+         * Determine the rest of the program starting at the given position, e.g. to report where parsing failed.
+         * @param offset The position in the program
+         * @return The characters of the program starting at the position
+         */
+        [[nodiscard]] std::string_view remainder(const std::size_t offset) const {
+            return content.substr(std::min(offset, content.size()));
+        }
+
+    private:
+        std::string_view content;
+        std::size_t      position   = 0;
+        unsigned         lineNumber = 1;
+
+        bool skipIgnoredCharacters();
+    };
+} // namespace syrec
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * @brief Memory arena from which the nodes of a SyReC program are allocated
+     *
+     * Memory is handed out from large chunks by incrementing an offset and is only released at once when the arena is destroyed.
+     */
+    class NodeArena {
+    public:
+        NodeArena() = default;
+
+        NodeArena(const NodeArena&)            = delete;
+        NodeArena& operator=(const NodeArena&) = delete;
+
+        /**
+         * Allocate uninitialized memory from the arena.
+         * @param size The number of bytes to allocate
+         * @param alignment The alignment of the allocated memory
+         * @return Pointer to the allocated memory
+         */
+        [[nodiscard]] void* allocate(std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief The number of bytes allocated from the arena
+         */
+        [[nodiscard]] std::size_t allocatedBytes() const noexcept {
+            return nAllocatedBytes;
+        }
+
+    private:
+        static constexpr std::size_t CHUNK_SIZE = 64U * 1024U;
+
+        std::vector<std::unique_ptr<unsigned char[]>> chunks; // NOLINT(*-avoid-c-arrays)
+        std::size_t                                   offsetInCurrentChunk = 0;
+        std::size_t                                   sizeOfCurrentChunk   = 0;
+        std::size_t                                   nAllocatedBytes      = 0;
+    };
+
+    /**
+     * @brief Allocator handing out the memory of a shared arena
+     *
+     * Since std::allocate_shared(...) stores a copy of the allocator alongside each allocated node, the arena lives as long as any node allocated from it.
+     */
+    template<typename T>
+    class NodeArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit NodeArenaAllocator(std::shared_ptr<NodeArena> arena) noexcept:
+            arena(std::move(arena)) {}
+
+        template<typename U>
+        NodeArenaAllocator(const NodeArenaAllocator<U>& other) noexcept: // NOLINT(google-explicit-constructor)
+            arena(other.arena) {}
+
+        [[nodiscard]] T* allocate(const std::size_t n) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        // The memory of the arena is only released at once
+        void deallocate([[maybe_unused]] T* p, [[maybe_unused]] std::size_t n) noexcept {}
+
+        template<typename U>
+        [[nodiscard]] bool operator==(const NodeArenaAllocator<U>& other) const noexcept {
+            return arena == other.arena;
+        }
+
+        template<typename U>
+        [[nodiscard]] bool operator!=(const NodeArenaAllocator<U>& other) const noexcept {
+            return arena != other.arena;
+        }
+
+    private:
+        template<typename U>
+        friend class NodeArenaAllocator;
+
+        std::shared_ptr<NodeArena> arena;
+    };
+
+    /**
+     * @brief Creates the nodes of a SyReC program in a shared arena
+     *
+     * Numbers, variable accesses and expressions are hash-consed, i.e. structurally equal nodes are only created once and shared by all of their uses.
+     * Each of these nodes gets an ID that is unique among the nodes of its type in the pool and that is assigned in the order of creation, thus being stable
+     * for repeated parses of the same program. Two nodes created by the same pool are thus structurally equal if and only if they are the same node.
+     * Since statements are identified by their line number and may be modified after their creation, they are only allocated in the arena.
+     */
+    class NodePool {
+    public:
+        NodePool():
+            arena(std::make_shared<NodeArena>()) {}
+
+        [[nodiscard]] Number::ptr number(unsigned value);
+        [[nodiscard]] Number::ptr loopVariable(const std::string& name, std::size_t slot);
+
+        /**
+         * Get the access of a variable.
+         * @param var The accessed variable
+         * @param range The optionally accessed range of bits
+         * @param indexes The index of each dimension of the variable
+         * @return The shared variable access
+         */
+        [[nodiscard]] VariableAccess::ptr variableAccess(const Variable::ptr& var, const std::optional<std::pair<Number::ptr, Number::ptr>>& range, const Expression::vec& indexes);
+
+        [[nodiscard]] Expression::ptr numericExpression(const Number::ptr& value, unsigned bitwidth);
+        [[nodiscard]] Expression::ptr variableExpression(const VariableAccess::ptr& var);
+        [[nodiscard]] Expression::ptr binaryExpression(const Expression::ptr& lhs, unsigned op, const Expression::ptr& rhs);
+        [[nodiscard]] Expression::ptr shiftExpression(const Expression::ptr& lhs, unsigned op, const Number::ptr& rhs);
+
+        /**
+         * Create a statement in the arena of the pool.
+         * @param args The arguments passed to the constructor of the statement
+         * @return The created statement
+         */
+        template<typename T, typename... Args>
+        [[nodiscard]] std::shared_ptr<T> statement(Args&&... args) {
+            return std::allocate_shared<T>(NodeArenaAllocator<T>(arena), std::forward<Args>(args)...);
+        }
+
+        /**
+         * Get the ID of a node known to the pool, i.e. created by the pool or used as a child of such a node.
+         * @param node The node
+         * @return The ID of the node or std::nullopt if the node is unknown to the pool
+         */
+        [[nodiscard]] std::optional<std::size_t> getId(const Number& node) const;
+        [[nodiscard]] std::optional<std::size_t> getId(const VariableAccess& node) const;
+        [[nodiscard]] std::optional<std::size_t> getId(const Expression& node) const;
+
+        /**
+         * @brief The number of distinct numbers, variable accesses and expressions known to the pool
+         */
+        [[nodiscard]] std::size_t numNodes() const noexcept {
+            return numberIds.size() + variableAccessIds.size() + expressionIds.size();
+        }
+
+        /**
+         * @brief The number of requested nodes that were resolved to an already existing node
+         */
+        [[nodiscard]] std::size_t numSharedNodes() const noexcept {
+            return nSharedNodes;
+        }
+
+        /**
+         * @brief The number of bytes allocated for the nodes of the pool
+         */
+        [[nodiscard]] std::size_t allocatedBytes() const noexcept {
+            return arena->allocatedBytes();
+        }
+
+    private:
+        using NodeKey = std::vector<std::size_t>;
+
+        struct NodeKeyHash {
+            std::size_t operator()(const NodeKey& key) const noexcept;
+        };
+
+        template<typename T, typename Node, typename... Args>
+        std::shared_ptr<Node> intern(std::unordered_map<NodeKey, std::shared_ptr<Node>, NodeKeyHash>& nodes, std::unordered_map<const Node*, std::size_t>& ids, NodeKey&& key, Args&&... args);
+
+        // Nodes that were not created by the pool are assigned an ID upon their first use and are kept alive so that their address stays unique
+        template<typename Node>
+        std::size_t getOrAssignId(std::unordered_map<const Node*, std::size_t>& ids, const std::shared_ptr<Node>& node);
+
+        std::shared_ptr<NodeArena> arena;
+        std::size_t                nSharedNodes = 0;
+
+        std::vector<std::shared_ptr<const void>> externalNodes;
+
+        std::map<std::string, std::size_t, std::less<>>                           loopVariableIds;
+        std::unordered_map<NodeKey, std::shared_ptr<Number>, NodeKeyHash>         numbers;
+        std::unordered_map<NodeKey, std::shared_ptr<VariableAccess>, NodeKeyHash> variableAccesses;
+        std::unordered_map<NodeKey, std::shared_ptr<Expression>, NodeKeyHash>     expressions;
+        std::unordered_map<const Variable*, std::size_t>                          variableIds;
+        std::unordered_map<const Number*, std::size_t>                            numberIds;
+        std::unordered_map<const VariableAccess*, std::size_t>                    variableAccessIds;
+        std::unordered_map<const Expression*, std::size_t>                        expressionIds;
+    };
+} // namespace syrec
@@ -11,11 +11,12 @@
 #pragma once
 
 #include <cassert>
-#include <map>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 template<class... Ts>
 struct Overloaded: Ts... {
@@ -30,17 +31,26 @@ namespace syrec {
     public:
         using ptr = std::shared_ptr<Number>;
 
-        using loop_variable_mapping = std::map<std::string, unsigned int>;
+        /**
+         * @brief Values of the loop variables indexed by the slot of each loop variable
+         */
+        using loop_variable_values = std::vector<unsigned>;
 
-        explicit Number(std::variant<unsigned, std::string> number):
-            numberVar(std::move(number)) {}
+        explicit Number(std::variant<unsigned, std::string> number, std::size_t slot = 0U):
+            numberVar(std::move(number)), slot(slot) {}
 
         explicit Number(unsigned value):
             numberVar(value) {
         }
 
-        explicit Number(const std::string& value):
-            numberVar(value) {
+        /**
+         * @brief Constructs a loop variable
+         *
+         * @param value Name of the loop variable
+         * @param slot Index of the value of the loop variable in the values passed to evaluate()
+         */
+        explicit Number(const std::string& value, std::size_t slot = 0U):
+            numberVar(value), slot(slot) {
         }
 
         ~Number() = default;
@@ -57,15 +67,26 @@ namespace syrec {
             return std::get<std::string>(numberVar);
         }
 
-        [[nodiscard]] unsigned evaluate(const loop_variable_mapping& map) const {
-            return std::visit(Overloaded{
-                                      [](unsigned arg) { return arg; },
-                                      [&map](const std::string& value) { return map.find(value)->second; }},
-                              numberVar);
+        /**
+         * @brief Index of the value of the loop variable in the values passed to evaluate()
+         *
+         * The parser binds each loop variable to the nesting depth of the loops defining a loop variable in the surrounding module.
+         */
+        [[nodiscard]] std::size_t loopVariableSlot() const {
+            return slot;
+        }
+
+        [[nodiscard]] unsigned evaluate(const loop_variable_values& values) const {
+            if (const auto* value = std::get_if<unsigned>(&numberVar)) {
+                return *value;
+            }
+            assert(slot < values.size());
+            return values[slot];
         }
 
     private:
         std::variant<unsigned, std::string> numberVar;
+        std::size_t                         slot = 0U;
     };
 
 } // namespace syrec
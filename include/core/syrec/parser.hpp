@@ -13,25 +13,29 @@
 #include "core/syrec/expression.hpp"
 #include "core/syrec/grammar.hpp"
 #include "core/syrec/module.hpp"
+#include "core/syrec/node_pool.hpp"
 #include "core/syrec/number.hpp"
 #include "core/syrec/program.hpp"
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace syrec {
 
     struct ParserContext {
-        explicit ParserContext(const ReadProgramSettings& settings):
-            settings(settings) {
+        ParserContext(const ReadProgramSettings& settings, NodePool& nodePool):
+            settings(settings), nodePool(nodePool) {
         }
 
         ast_iterator               begin;
         unsigned                   currentLineNumber{0U};
         const ReadProgramSettings& settings;
+        NodePool&                  nodePool;
         std::string                errorMessage;
-        std::vector<std::string>   loopVariables;
+        std::vector<std::string>   loopVariables; // The position of a loop variable is its slot
     };
 
     bool parseModule(Module& proc, const ast_module& astProc, const Program& prog, ParserContext& context);
@@ -45,4 +49,39 @@ namespace syrec {
     unsigned parseVariableType(const std::string& name);
 
     VariableAccess::ptr parseVariableAccess(const ast_variable& astVar, const Module& proc, ParserContext& context);
+
+    // Semantic checks and constant folding shared by the Boost.Spirit grammar and the recursive-descent parser
+    unsigned parseNumericExpressionOperation(std::string_view astOp);
+
+    Number::ptr foldNumericExpression(const Number::ptr& lhs, unsigned op, const Number::ptr& rhs, ParserContext& context);
+
+    unsigned parseBinaryExpressionOperation(std::string_view astOp);
+
+    unsigned parseShiftExpressionOperation(std::string_view astOp);
+
+    Expression::ptr createShiftExpression(const Expression::ptr& lhs, unsigned op, const Number::ptr& rhs, ParserContext& context);
+
+    Statement::ptr createSwapStatement(const VariableAccess::ptr& va1, const VariableAccess::ptr& va2, ParserContext& context);
+
+    unsigned parseUnaryStatementOperation(std::string_view astOp);
+
+    unsigned parseAssignStatementOperation(char astOp);
+
+    Statement::ptr createAssignStatement(const VariableAccess::ptr& lhs, unsigned op, const Expression::ptr& rhs, ParserContext& context);
+
+    Statement::ptr createCallStatement(bool isCall, const Module::ptr& otherProc, const std::string& procName, const std::vector<std::string>& parameters, const Module& proc, ParserContext& context);
+
+    /**
+     * @brief Parse a SyReC program with the hand-written recursive-descent parser
+     *
+     * The modules are created in a single pass over the tokens of the program without building the abstract syntax tree of the Boost.Spirit grammar.
+     * Both parsers accept the same programs and report the same errors.
+     *
+     * @param prog The program to which the parsed modules are added
+     * @param content The SyReC program
+     * @param context The context of the parser
+     * @param error The error message if parsing failed
+     * @return true if the program was parsed successfully
+     */
+    bool parseProgram(Program& prog, std::string_view content, ParserContext& context, std::string& error);
 } // namespace syrec
@@ -13,19 +13,32 @@
 #include "core/syrec/expression.hpp"
 #include "core/syrec/grammar.hpp"
 #include "core/syrec/module.hpp"
+#include "core/syrec/node_pool.hpp"
 #include "core/syrec/number.hpp"
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 
 #include <fstream>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace syrec {
 
     struct ReadProgramSettings {
-        explicit ReadProgramSettings(unsigned bitwidth = 32U):
-            defaultBitwidth(bitwidth) {};
+        explicit ReadProgramSettings(unsigned bitwidth = 32U, bool useSpiritGrammar = false):
+            defaultBitwidth(bitwidth), useSpiritGrammar(useSpiritGrammar) {};
         unsigned defaultBitwidth;
+        /**
+         * @brief Whether the program is parsed with the Boost.Spirit grammar instead of the recursive-descent parser
+         *
+         * Both parsers create the same modules and report the same errors, the Boost.Spirit grammar is kept for comparison.
+         */
+        bool useSpiritGrammar;
+        /**
+         * @brief The line number of the first line of the program, which differs from 1 if the program is only a part of a larger source
+         */
+        unsigned firstLineNumber = 1U;
     };
 
     class Program {
@@ -52,8 +65,29 @@ namespace syrec {
 
         std::string read(const std::string& filename, ReadProgramSettings settings = ReadProgramSettings{});
 
+        /**
+         * @brief Read a SyReC program from memory
+         *
+         * The program is parsed directly from the given characters without copying them, like the content of a file read with read(...), which is memory-mapped where supported.
+         *
+         * @param content The SyReC program, which does not need to be null-terminated
+         * @param settings Settings
+         * @return The error message if parsing failed, otherwise an empty string
+         */
+        std::string readFromString(std::string_view content, ReadProgramSettings settings = ReadProgramSettings{});
+
+        /**
+         * @brief The pool from which the nodes of the parsed modules were created
+         *
+         * Structurally equal numbers, variable accesses and expressions of the program share the same node.
+         */
+        [[nodiscard]] const NodePool& nodePool() const {
+            return pool;
+        }
+
     private:
         Module::vec modulesVec;
+        NodePool    pool;
 
         /**
         * @brief Parser for a SyReC program
@@ -70,7 +104,7 @@ namespace syrec {
         * @return true if parsing was successful, otherwise false
         */
         bool readFile(const std::string& filename, ReadProgramSettings settings, std::string& error);
-        bool readProgramFromString(const std::string& content, const ReadProgramSettings& settings, std::string& error);
+        bool readProgramFromString(std::string_view content, const ReadProgramSettings& settings, std::string& error);
     };
 
 } // namespace syrec
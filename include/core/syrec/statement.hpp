@@ -13,6 +13,8 @@
 #include "core/syrec/expression.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <utility>
@@ -40,6 +42,22 @@ namespace syrec {
        */
         using vec = std::vector<ptr>;
 
+        /**
+         * @brief Kind of a statement
+         *
+         * Allows to dispatch on the type of a statement without relying on RTTI.
+         */
+        enum class Kind : std::uint8_t {
+            Skip,
+            Swap,
+            Unary,
+            Assign,
+            If,
+            For,
+            Call,
+            Uncall
+        };
+
         /**
        * @brief Standard constructor
        *
@@ -54,6 +72,13 @@ namespace syrec {
 
         unsigned lineNumber{};
 
+        /**
+         * @brief The kind of the statement which determines the type to which the statement can be cast
+         */
+        [[nodiscard]] virtual Kind kind() const {
+            return Kind::Skip;
+        }
+
         virtual Statement::ptr reverse() {
             return std::make_shared<Statement>(*this);
         };
@@ -78,6 +103,15 @@ namespace syrec {
             lhs(std::move(lhs)),
             rhs(std::move(rhs)) {}
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Swap;
+        }
+
+        // a swap is its own inverse
+        Statement::ptr reverse() override {
+            return std::make_shared<SwapStatement>(*this);
+        }
+
         VariableAccess::ptr lhs;
         VariableAccess::ptr rhs;
     };
@@ -120,6 +154,10 @@ namespace syrec {
             op(op),
             var(std::move(var)) {}
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Unary;
+        }
+
         Statement::ptr reverse() override {
             switch (op) {
                 case UnaryStatement::Increment:
@@ -178,6 +216,10 @@ namespace syrec {
             lhs(std::move(lhs)),
             op(op), rhs(std::move(rhs)) {}
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Assign;
+        }
+
         Statement::ptr reverse() override {
             switch (op) {
                 case AssignStatement::Add:
@@ -253,6 +295,10 @@ namespace syrec {
             fiCondition = std::move(fiCond);
         }
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::If;
+        }
+
         Statement::ptr reverse() override {
             auto fi = std::make_shared<IfStatement>();
             fi->setFiCondition(condition);
@@ -294,10 +340,15 @@ namespace syrec {
             statements.emplace_back(statement);
         }
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::For;
+        }
+
         Statement::ptr reverse() override {
-            auto forStat          = std::make_shared<ForStatement>();
-            forStat->loopVariable = loopVariable;
-            forStat->range        = std::make_pair(range.second, range.first);
+            auto forStat              = std::make_shared<ForStatement>();
+            forStat->loopVariable     = loopVariable;
+            forStat->loopVariableSlot = loopVariableSlot;
+            forStat->range            = std::make_pair(range.second, range.first);
             for (auto it = statements.rbegin(); it != statements.rend(); ++it) {
                 forStat->addStatement(*it);
             }
@@ -305,6 +356,7 @@ namespace syrec {
         }
 
         std::string                         loopVariable{};
+        std::size_t                         loopVariableSlot{};
         std::pair<Number::ptr, Number::ptr> range{};
         Number::ptr                         step{};
         Statement::vec                      statements{};
@@ -325,6 +377,10 @@ namespace syrec {
         CallStatement(std::shared_ptr<Module> target, std::vector<std::string> parameters):
             target(std::move(target)), parameters(std::move(parameters)) {}
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Call;
+        }
+
         Statement::ptr reverse() override;
 
         std::shared_ptr<Module>  target{};
@@ -346,6 +402,10 @@ namespace syrec {
         UncallStatement(std::shared_ptr<Module> target, std::vector<std::string> parameters):
             target(std::move(target)), parameters(std::move(parameters)) {}
 
+        [[nodiscard]] Kind kind() const override {
+            return Kind::Uncall;
+        }
+
         Statement::ptr reverse() override {
             return std::make_shared<CallStatement>(target, parameters);
         }
@@ -13,15 +13,21 @@
 #include "dd/Package.hpp"
 
 #include <algorithm>
+#include <array>
 #include <bitset>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <memory>
 #include <optional>
 #include <queue>
+#include <set>
+#include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -29,29 +35,241 @@ namespace syrec {
 
     class TruthTable {
     public:
+        /**
+         * @brief A cube of (possibly don't care) bit values
+         *
+         * The values are stored bit-packed in two bitmasks, a value mask and a care mask whose bit is cleared for a don't care position (in which case the value
+         * bit is cleared as well). Position 0 is stored in the most significant bit of the first word, so that the lexicographical order of the positions equals
+         * the order of the words. Cubes of up to 128 positions are stored inline, wider cubes store their value words followed by their care words on the heap.
+         * Hence, comparisons, hashing, don't care matching and integer conversion are a handful of (auto-vectorizable) word operations per cube.
+         */
         class Cube {
         public:
             using Value  = std::optional<bool>;
             using Vector = std::vector<Cube>;
             using Set    = std::set<Cube>;
+            using Word   = std::uint64_t;
+
+            static constexpr std::size_t WORD_BITS = 64U;
+
+            /**
+             * @brief Proxy to a position of a cube that can be assigned like a Value
+             */
+            class Reference {
+            public:
+                Reference(Cube& cube, const std::size_t pos):
+                    cube(&cube), pos(pos) {}
+
+                Reference(const Reference&) = default;
+                ~Reference()                = default;
+
+                auto operator=(const Value& v) -> Reference& {
+                    cube->set(pos, v);
+                    return *this;
+                }
+
+                auto operator=(const Reference& other) -> Reference& { // NOLINT(bugprone-unhandled-self-assignment,cert-oop54-cpp) assigns the referenced value
+                    return *this = static_cast<Value>(other);
+                }
+
+                operator Value() const { // NOLINT(google-explicit-constructor) behaves like a reference to a Value
+                    return std::as_const(*cube)[pos];
+                }
+
+                [[nodiscard]] auto has_value() const -> bool { // NOLINT(readability-identifier-naming) keeping same Interface as std::optional
+                    return (cube->careWords()[pos / WORD_BITS] & bitMask(pos)) != 0U;
+                }
+
+                [[nodiscard]] auto value() const -> bool {
+                    return static_cast<Value>(*this).value();
+                }
+
+                auto operator*() const -> bool {
+                    return (cube->valueWords()[pos / WORD_BITS] & bitMask(pos)) != 0U;
+                }
+
+                auto operator==(const Value& v) const -> bool {
+                    return static_cast<Value>(*this) == v;
+                }
+
+                auto operator!=(const Value& v) const -> bool {
+                    return static_cast<Value>(*this) != v;
+                }
+
+            private:
+                Cube*       cube;
+                std::size_t pos;
+            };
+
+            /**
+             * @brief Random access iterator over the positions of a cube yielding their Value
+             */
+            class ConstIterator {
+            public:
+                using iterator_category = std::random_access_iterator_tag; // NOLINT(readability-identifier-naming) required by std::iterator_traits
+                using value_type        = Value;                           // NOLINT(readability-identifier-naming) required by std::iterator_traits
+                using difference_type   = std::ptrdiff_t;                  // NOLINT(readability-identifier-naming) required by std::iterator_traits
+                using pointer           = void;                            // NOLINT(readability-identifier-naming) required by std::iterator_traits
+                using reference         = Value;                           // NOLINT(readability-identifier-naming) required by std::iterator_traits
+
+                ConstIterator() = default;
+                ConstIterator(const Cube* cube, const std::size_t pos):
+                    cube(cube), pos(pos) {}
+
+                auto operator*() const -> Value { return (*cube)[pos]; }
+                auto operator[](const difference_type n) const -> Value { return *(*this + n); }
+
+                auto operator++() -> ConstIterator& {
+                    ++pos;
+                    return *this;
+                }
+                auto operator++(int) -> ConstIterator {
+                    auto it = *this;
+                    ++pos;
+                    return it;
+                }
+                auto operator--() -> ConstIterator& {
+                    --pos;
+                    return *this;
+                }
+                auto operator--(int) -> ConstIterator {
+                    auto it = *this;
+                    --pos;
+                    return it;
+                }
+                auto operator+=(const difference_type n) -> ConstIterator& {
+                    pos = static_cast<std::size_t>(static_cast<difference_type>(pos) + n);
+                    return *this;
+                }
+                auto operator-=(const difference_type n) -> ConstIterator& { return *this += -n; }
+
+                friend auto operator+(ConstIterator it, const difference_type n) -> ConstIterator { return it += n; }
+                friend auto operator+(const difference_type n, ConstIterator it) -> ConstIterator { return it += n; }
+                friend auto operator-(ConstIterator it, const difference_type n) -> ConstIterator { return it -= n; }
+                friend auto operator-(const ConstIterator& lhs, const ConstIterator& rhs) -> difference_type {
+                    return static_cast<difference_type>(lhs.pos) - static_cast<difference_type>(rhs.pos);
+                }
+
+                auto operator==(const ConstIterator& other) const -> bool { return pos == other.pos; }
+                auto operator!=(const ConstIterator& other) const -> bool { return pos != other.pos; }
+                auto operator<(const ConstIterator& other) const -> bool { return pos < other.pos; }
+                auto operator>(const ConstIterator& other) const -> bool { return pos > other.pos; }
+                auto operator<=(const ConstIterator& other) const -> bool { return pos <= other.pos; }
+                auto operator>=(const ConstIterator& other) const -> bool { return pos >= other.pos; }
+
+            private:
+                const Cube* cube = nullptr;
+                std::size_t pos  = 0U;
+            };
+
+            /**
+             * @brief Hash functor for cubes, e.g. to use them as keys of unordered containers
+             */
+            struct Hash {
+                auto operator()(const Cube& c) const noexcept -> std::size_t { return c.hash(); }
+            };
 
         private:
-            std::vector<Value> cube{};
+            static constexpr std::size_t INLINE_WORDS = 2U;
+
+            std::size_t                         nBits = 0U;
+            std::array<Word, 2U * INLINE_WORDS> inlineWords{};
+            // value words followed by care words (of equal number) once the cube is wider than the inline words
+            std::vector<Word> heapWords{};
+
+            [[nodiscard]] static constexpr auto nWordsFor(const std::size_t n) -> std::size_t {
+                return (n + WORD_BITS - 1U) / WORD_BITS;
+            }
+
+            [[nodiscard]] static constexpr auto bitMask(const std::size_t pos) -> Word {
+                return Word{1U} << (WORD_BITS - 1U - (pos % WORD_BITS));
+            }
+
+            // mask of the positions of the last word of a cube of the given (non-zero) size
+            [[nodiscard]] static constexpr auto lastWordMask(const std::size_t n) -> Word {
+                return ~Word{0U} << ((WORD_BITS - (n % WORD_BITS)) % WORD_BITS);
+            }
+
+            // isolates the most significant set bit of a word, i.e. the first position at which two cubes differ
+            [[nodiscard]] static constexpr auto highestBit(Word w) -> Word {
+                w |= w >> 1U;
+                w |= w >> 2U;
+                w |= w >> 4U;
+                w |= w >> 8U;
+                w |= w >> 16U;
+                w |= w >> 32U;
+                return w ^ (w >> 1U);
+            }
+
+            [[nodiscard]] auto capacityWords() const -> std::size_t {
+                return heapWords.empty() ? INLINE_WORDS : heapWords.size() / 2U;
+            }
+
+            [[nodiscard]] auto valueWords() -> Word* {
+                return heapWords.empty() ? inlineWords.data() : heapWords.data();
+            }
+
+            [[nodiscard]] auto careWords() -> Word* {
+                return valueWords() + capacityWords();
+            }
+
+            // ensures that the words can store a cube of the given size
+            auto reserveWords(std::size_t n) -> void;
+
+            // clears all positions starting at the given one
+            auto clearFrom(std::size_t pos) -> void;
+
+            auto set(const std::size_t pos, const Value& v) -> void {
+                const auto word = pos / WORD_BITS;
+                const auto mask = bitMask(pos);
+                valueWords()[word] &= ~mask;
+                careWords()[word] &= ~mask;
+                if (v.has_value()) {
+                    careWords()[word] |= mask;
+                    if (*v) {
+                        valueWords()[word] |= mask;
+                    }
+                }
+            }
 
         public:
             Cube() = default;
-            explicit Cube(std::vector<Value> cube):
-                cube(std::move(cube)) {}
+            explicit Cube(const std::vector<Value>& values):
+                Cube(values.cbegin(), values.cend()) {}
 
             Cube(const std::size_t bw, const Value& initializer) {
-                cube.resize(bw, initializer);
+                resize(bw, initializer);
             }
 
             template<class InputIt>
             Cube(InputIt first, InputIt last) {
-                std::copy(first, last, std::back_inserter(cube));
+                for (; first != last; ++first) {
+                    emplace_back(Value(*first));
+                }
+            }
+
+            Cube(const Cube& other)                    = default;
+            auto operator=(const Cube& other) -> Cube& = default;
+
+            Cube(Cube&& other) noexcept:
+                nBits(std::exchange(other.nBits, 0U)),
+                inlineWords(std::exchange(other.inlineWords, std::array<Word, 2U * INLINE_WORDS>{})),
+                heapWords(std::move(other.heapWords)) {
+                other.heapWords.clear();
+            }
+
+            auto operator=(Cube&& other) noexcept -> Cube& {
+                if (this != &other) {
+                    nBits       = std::exchange(other.nBits, 0U);
+                    inlineWords = std::exchange(other.inlineWords, std::array<Word, 2U * INLINE_WORDS>{});
+                    heapWords   = std::move(other.heapWords);
+                    other.heapWords.clear();
+                }
+                return *this;
             }
 
+            ~Cube() = default;
+
             static auto getValue(const char& c) -> Value {
                 switch (c) {
                     case '-':
@@ -74,7 +292,7 @@ namespace syrec {
                 const auto    bitwidth = p1SigVec.begin()->size();
                 std::uint64_t idx      = 0U;
                 while (true) {
-                    if (auto cube = Cube::fromInteger(idx, bitwidth); std::find(p1SigVec.begin(), p1SigVec.end(), cube) == p1SigVec.end()) {
+                    if (auto cube = Cube::fromInteger(idx, bitwidth); p1SigVec.find(cube) == p1SigVec.end()) {
                         return cube;
                     }
                     ++idx;
@@ -85,9 +303,10 @@ namespace syrec {
             static auto fromInteger(const std::uint64_t number, const std::size_t bw) -> Cube {
                 assert(bw <= 64U);
                 Cube cube{};
-                cube.reserve(bw);
-                for (std::size_t i = 0U; i < bw; ++i) {
-                    cube.emplace_back((number & (1ULL << (bw - 1U - i))) != 0U);
+                if (bw != 0U) {
+                    cube.nBits                     = bw;
+                    cube.inlineWords[0U]           = number << (WORD_BITS - bw);
+                    cube.inlineWords[INLINE_WORDS] = lastWordMask(bw);
                 }
                 return cube;
             }
@@ -104,39 +323,30 @@ namespace syrec {
 
             // return integer representation of the cube
             [[nodiscard]] auto toInteger() const -> std::uint64_t {
-                assert(cube.size() <= 64U);
-                assert(std::none_of(cube.cbegin(), cube.cend(), [](auto const& v) { return !v.has_value(); }));
-                std::uint64_t result = 0U;
-                for (std::size_t i = 0U; i < cube.size(); ++i) {
-                    if (*cube[i]) {
-                        result |= (1ULL << (cube.size() - 1U - i));
-                    }
-                }
-                return result;
+                assert(nBits <= 64U);
+                assert(nBits == 0U || careWords()[0U] == lastWordMask(nBits));
+                return nBits == 0U ? 0U : valueWords()[0U] >> (WORD_BITS - nBits);
             }
 
             // return bool vec representation of the cube (order is b0,b1,b2......bn)
             [[nodiscard]] auto toBoolVec() const -> std::vector<bool> {
-                assert(std::all_of(cube.cbegin(), cube.cend(), [](auto const& v) { return v.has_value(); }));
-                const auto        nBits = size();
                 std::vector<bool> result(nBits);
                 for (std::size_t i = 0U; i < nBits; ++i) {
-                    result[nBits - 1 - i] = *cube[i];
+                    assert((careWords()[i / WORD_BITS] & bitMask(i)) != 0U);
+                    result[nBits - 1 - i] = (valueWords()[i / WORD_BITS] & bitMask(i)) != 0U;
                 }
                 return result;
             }
 
             // return string representation of the cube
             [[nodiscard]] auto toString() const -> std::string {
-                std::stringstream ss{};
-                for (const auto& i: cube) {
-                    if (!i.has_value()) {
-                        ss << '-';
-                    } else {
-                        ss << (*i ? '1' : '0');
+                std::string str(nBits, '-');
+                for (std::size_t i = 0U; i < nBits; ++i) {
+                    if ((careWords()[i / WORD_BITS] & bitMask(i)) != 0U) {
+                        str[i] = (valueWords()[i / WORD_BITS] & bitMask(i)) != 0U ? '1' : '0';
                     }
                 }
-                return ss.str();
+                return str;
             }
 
             // checks if 2 Cubes are equal irrespective of don't care
@@ -144,27 +354,25 @@ namespace syrec {
                 if (c1.size() != c2.size()) {
                     return false;
                 }
-                const auto nBits = c1.size();
-                for (auto i = 0U; i < nBits; ++i) {
-                    if (equalityUpToDontCare && (!c1[i].has_value() || !c2[i].has_value())) {
-                        continue;
-                    }
-                    if (*c1[i] != *c2[i]) {
-                        return false;
-                    }
+                const auto* const v1   = c1.valueWords();
+                const auto* const v2   = c2.valueWords();
+                const auto* const m1   = c1.careWords();
+                const auto* const m2   = c2.careWords();
+                Word              diff = 0U;
+                for (std::size_t w = 0U; w < nWordsFor(c1.size()); ++w) {
+                    diff |= equalityUpToDontCare ? ((v1[w] ^ v2[w]) & m1[w] & m2[w]) : ((v1[w] ^ v2[w]) | (m1[w] ^ m2[w]));
                 }
-                return true;
+                return diff == 0U;
             }
 
             [[nodiscard]] auto completeCubes() const -> Vector;
 
-            auto insertZero() -> void {
-                cube.insert(cube.begin(), false);
-            }
+            auto insertZero() -> void;
+
             [[nodiscard]] auto append(const Value& v) const -> Cube {
-                auto c = cube;
+                auto c = *this;
                 c.emplace_back(v);
-                return Cube(c);
+                return c;
             }
             [[nodiscard]] auto appendZero() const -> Cube {
                 return append(false);
@@ -173,50 +381,110 @@ namespace syrec {
                 return append(true);
             }
 
+            // the packed value words of the cube, position 0 is stored in the most significant bit of the first word
+            [[nodiscard]] auto valueWords() const -> const Word* {
+                return heapWords.empty() ? inlineWords.data() : heapWords.data();
+            }
+
+            // the packed care words of the cube, a bit is cleared for a don't care position
+            [[nodiscard]] auto careWords() const -> const Word* {
+                return valueWords() + capacityWords();
+            }
+
+            [[nodiscard]] auto nWords() const -> std::size_t {
+                return nWordsFor(nBits);
+            }
+
+            [[nodiscard]] auto hash() const noexcept -> std::size_t {
+                auto h = static_cast<std::uint64_t>(nBits) * 0x9E3779B97F4A7C15ULL;
+                for (std::size_t w = 0U; w < nWords(); ++w) {
+                    h ^= valueWords()[w] + 0x9E3779B97F4A7C15ULL + (h << 6U) + (h >> 2U);
+                    h ^= careWords()[w] + 0x9E3779B97F4A7C15ULL + (h << 6U) + (h >> 2U);
+                }
+                return static_cast<std::size_t>(h);
+            }
+
             // pass-through functions for underlying vector
 
-            auto operator[](std::size_t pos) -> Value& {
-                return cube[pos];
+            auto operator[](std::size_t pos) -> Reference {
+                assert(pos < nBits);
+                return {*this, pos};
             }
 
-            auto operator[](std::size_t pos) const -> const Value& {
-                return cube[pos];
+            auto operator[](std::size_t pos) const -> Value {
+                assert(pos < nBits);
+                const auto mask = bitMask(pos);
+                if ((careWords()[pos / WORD_BITS] & mask) == 0U) {
+                    return {};
+                }
+                return (valueWords()[pos / WORD_BITS] & mask) != 0U;
             }
 
+            // lexicographical order of the positions with don't care < 0 < 1
             auto operator<(const Cube& cv) const -> bool {
-                return (cube < cv.cube);
+                const auto        common = std::min(nBits, cv.nBits);
+                const auto        words  = nWordsFor(common);
+                const auto* const v1     = valueWords();
+                const auto* const v2     = cv.valueWords();
+                const auto* const m1     = careWords();
+                const auto* const m2     = cv.careWords();
+                for (std::size_t w = 0U; w < words; ++w) {
+                    auto diff = (v1[w] ^ v2[w]) | (m1[w] ^ m2[w]);
+                    if (w + 1U == words) {
+                        diff &= lastWordMask(common);
+                    }
+                    if (diff != 0U) {
+                        const auto first = highestBit(diff);
+                        // a don't care is smaller than a value, otherwise both values differ
+                        return ((m1[w] ^ m2[w]) & first) != 0U ? (m2[w] & first) != 0U : (v2[w] & first) != 0U;
+                    }
+                }
+                return nBits < cv.nBits;
             }
 
             auto operator>(const Cube& cv) const -> bool {
-                return (cube > cv.cube);
+                return cv < *this;
             }
 
             auto operator==(const Cube& cv) const -> bool {
-                return (cube == cv.cube);
+                if (nBits != cv.nBits) {
+                    return false;
+                }
+                return std::equal(valueWords(), valueWords() + nWords(), cv.valueWords()) && std::equal(careWords(), careWords() + nWords(), cv.careWords());
             }
 
             auto operator!=(const Cube& cv) const -> bool {
-                return (cube != cv.cube);
+                return !(*this == cv);
             }
 
             auto reserve(const std::size_t n) -> void {
-                cube.reserve(n);
+                reserveWords(n);
             }
 
-            auto resize(const std::size_t n, Value val = Value()) -> void {
-                cube.resize(n, val);
-            }
-
-            auto resize(const std::size_t n, const Value& val) -> void {
-                cube.resize(n, val);
+            auto resize(const std::size_t n, const Value& val = Value()) -> void {
+                if (n < nBits) {
+                    clearFrom(n);
+                    nBits = n;
+                    return;
+                }
+                reserveWords(n);
+                const auto oldSize = nBits;
+                nBits              = n;
+                if (val.has_value()) {
+                    for (auto i = oldSize; i < n; ++i) {
+                        set(i, val);
+                    }
+                }
             }
 
             auto emplace_back(const Value& v) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-                cube.emplace_back(v);
+                reserveWords(nBits + 1U);
+                set(nBits++, v);
             }
 
             auto pop_back() -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-                cube.pop_back();
+                assert(nBits != 0U);
+                set(--nBits, {});
             }
 
             [[nodiscard]] auto equals(const std::uint64_t num, const std::size_t bw) const -> bool {
@@ -228,34 +496,237 @@ namespace syrec {
             }
 
             [[nodiscard]] auto size() const -> std::size_t {
-                return cube.size();
+                return nBits;
             }
             [[nodiscard]] auto empty() const -> bool {
-                return cube.empty();
+                return nBits == 0U;
             }
-            [[nodiscard]] auto begin() const -> decltype(cube.begin()) {
-                return cube.begin();
+            [[nodiscard]] auto begin() const -> ConstIterator {
+                return {this, 0U};
             }
-            [[nodiscard]] auto cbegin() const -> decltype(cube.cbegin()) {
-                return cube.cbegin();
+            [[nodiscard]] auto cbegin() const -> ConstIterator {
+                return {this, 0U};
             }
-            [[nodiscard]] auto end() const -> decltype(cube.end()) {
-                return cube.end();
+            [[nodiscard]] auto end() const -> ConstIterator {
+                return {this, nBits};
             }
-            [[nodiscard]] auto cend() const -> decltype(cube.cend()) {
-                return cube.cend();
+            [[nodiscard]] auto cend() const -> ConstIterator {
+                return {this, nBits};
             }
         };
 
         using CubeMap      = std::map<Cube, Cube>;
         using CubeMultiMap = std::multimap<Cube, Cube>;
 
+        /**
+         * @brief Dense storage of the outputs of a completely specified truth table
+         *
+         * Each output position is stored column-wise as a bit array indexed by the integer of the input, i.e. the outputs of a table with n inputs and m outputs
+         * take 2^n * m bits. Don't care output values are tracked by a second bit array per position that is only allocated once a don't care value is stored.
+         */
+        class DenseOutputs {
+        public:
+            DenseOutputs() = default;
+
+            /**
+             * @param nInputs The number of inputs (at most 63)
+             * @param nOutputs The number of outputs, all of which are initialized to 0
+             */
+            DenseOutputs(std::size_t nInputs, std::size_t nOutputs);
+
+            [[nodiscard]] auto nInputs() const -> std::size_t {
+                return inputs;
+            }
+
+            [[nodiscard]] auto nOutputs() const -> std::size_t {
+                return outputs;
+            }
+
+            [[nodiscard]] auto nRows() const -> std::uint64_t {
+                return std::uint64_t{1U} << inputs;
+            }
+
+            [[nodiscard]] auto get(const std::uint64_t input, const std::size_t pos) const -> Cube::Value {
+                const auto word = (pos * columnWords) + (input / Cube::WORD_BITS);
+                const auto mask = Cube::Word{1U} << (input % Cube::WORD_BITS);
+                if (!cares.empty() && (cares[word] & mask) == 0U) {
+                    return {};
+                }
+                return (values[word] & mask) != 0U;
+            }
+
+            auto set(std::uint64_t input, std::size_t pos, const Cube::Value& v) -> void;
+
+            [[nodiscard]] auto output(std::uint64_t input) const -> Cube;
+
+            auto setOutput(std::uint64_t input, const Cube& output) -> void;
+
+            // the words of the value bit array of an output position, the value of input x is stored in bit x % 64 of word x / 64
+            [[nodiscard]] auto valueColumn(const std::size_t pos) const -> const Cube::Word* {
+                return values.data() + (pos * columnWords);
+            }
+
+            // the words of the care bit array of an output position or nullptr if no output value is a don't care
+            [[nodiscard]] auto careColumn(const std::size_t pos) const -> const Cube::Word* {
+                return cares.empty() ? nullptr : cares.data() + (pos * columnWords);
+            }
+
+            [[nodiscard]] auto nColumnWords() const -> std::size_t {
+                return columnWords;
+            }
+
+            // the mask of the bits of a column word that store the value of an input
+            [[nodiscard]] auto rowMask(std::size_t word) const -> Cube::Word;
+
+            auto operator==(const DenseOutputs& other) const -> bool;
+
+            auto operator!=(const DenseOutputs& other) const -> bool {
+                return !(*this == other);
+            }
+
+        private:
+            std::size_t             inputs      = 0U;
+            std::size_t             outputs     = 0U;
+            std::size_t             columnWords = 0U;
+            std::vector<Cube::Word> values{}; // the columns one after another
+            std::vector<Cube::Word> cares{};  // empty if no output value is a don't care
+        };
+
+        /**
+         * @brief The storage of the rows of a sparse (i.e. not dense) truth table
+         */
+        enum class SparseStorage : std::uint8_t {
+            Map,         ///< Balanced search tree with a node per row, which supports the mutable access to the rows
+            SortedVector ///< Vector of the rows that is sorted in bulk once the table is read after rows were inserted
+        };
+
+        // a row of the sorted vector storage, whose input is not const to allow the rows to be moved while they are sorted and merged
+        using Row = std::pair<Cube, Cube>;
+
+        /**
+         * @brief Iterator over the rows of a truth table in the order of their inputs
+         *
+         * A row is accessed as a pair of const references to its input and output, since the rows of the map and the sorted vector storage have different
+         * types. The rows of a dense table are materialized one at a time into the iterator, hence a reference to a row is only valid until the iterator is
+         * advanced and two iterators at the same row do not refer to the same object. Therefore, it is only an input iterator.
+         */
+        class ConstIterator {
+        public:
+            using iterator_category = std::input_iterator_tag;             // NOLINT(readability-identifier-naming) required by std::iterator_traits
+            using value_type        = CubeMap::value_type;                 // NOLINT(readability-identifier-naming) required by std::iterator_traits
+            using difference_type   = std::ptrdiff_t;                      // NOLINT(readability-identifier-naming) required by std::iterator_traits
+            using reference         = std::pair<const Cube&, const Cube&>; // NOLINT(readability-identifier-naming) required by std::iterator_traits
+
+            // the result of operator->, which holds the references to the row
+            class ArrowProxy {
+            public:
+                explicit ArrowProxy(reference row):
+                    row(row) {}
+
+                auto operator->() const -> const reference* {
+                    return &row;
+                }
+
+            private:
+                reference row;
+            };
+
+            using pointer = ArrowProxy; // NOLINT(readability-identifier-naming) required by std::iterator_traits
+
+            ConstIterator() = default;
+            explicit ConstIterator(CubeMap::const_iterator it):
+                mapIt(it) {}
+            explicit ConstIterator(const Row* row):
+                sortedRow(row), sorted(true) {}
+            ConstIterator(const DenseOutputs& outputs, const std::uint64_t input):
+                dense(&outputs), input(input) {
+                materialize();
+            }
+
+            auto operator*() const -> reference {
+                if (dense != nullptr) {
+                    return {row->first, row->second};
+                }
+                if (sorted) {
+                    return {sortedRow->first, sortedRow->second};
+                }
+                return {mapIt->first, mapIt->second};
+            }
+
+            auto operator->() const -> pointer {
+                return ArrowProxy(**this);
+            }
+
+            auto operator++() -> ConstIterator& {
+                if (dense != nullptr) {
+                    ++input;
+                    materialize();
+                } else if (sorted) {
+                    ++sortedRow;
+                } else {
+                    ++mapIt;
+                }
+                return *this;
+            }
+
+            auto operator++(int) -> ConstIterator {
+                auto it = *this;
+                ++*this;
+                return it;
+            }
+
+            auto operator==(const ConstIterator& other) const -> bool {
+                if (dense != nullptr) {
+                    return input == other.input;
+                }
+                return sorted ? sortedRow == other.sortedRow : mapIt == other.mapIt;
+            }
+
+            auto operator!=(const ConstIterator& other) const -> bool {
+                return !(*this == other);
+            }
+
+        private:
+            auto materialize() -> void {
+                if (input < dense->nRows()) {
+                    row.emplace(Cube::fromInteger(input, dense->nInputs()), dense->output(input));
+                } else {
+                    row.reset();
+                }
+            }
+
+            CubeMap::const_iterator mapIt{};
+            const Row*              sortedRow = nullptr;
+            bool                    sorted    = false;
+            const DenseOutputs*     dense     = nullptr;
+            std::uint64_t           input     = 0U;
+            std::optional<Row>      row{};
+        };
+
     private:
-        CubeMap           cubeMap{};
-        std::vector<bool> constants;
-        std::vector<bool> garbage;
+        CubeMap       cubeMap{};
+        SparseStorage sparseStorage = SparseStorage::Map;
+        // the sorted rows of the sorted vector storage and the rows inserted since the table was last read, which are merged into the sorted rows by the next read
+        mutable std::vector<Row>    sortedRows{};
+        mutable std::vector<Row>    insertedRows{};
+        std::optional<DenseOutputs> denseOutputs{};
+        std::vector<bool>           constants;
+        std::vector<bool>           garbage;
+
+        // merges the inserted rows into the sorted rows of the sorted vector storage
+        auto mergeInsertedRows() const -> void;
+
+        // converts the table into the map storage, which is required by the mutable access to the rows
+        auto toMap() -> void;
+
+        [[nodiscard]] auto firstRow() const -> std::pair<const Cube*, const Cube*>;
 
     public:
+        TruthTable() = default;
+
+        explicit TruthTable(const SparseStorage storage):
+            sparseStorage(storage) {}
+
         auto setConstants(std::vector<bool> const& c) -> void {
             constants = c;
         }
@@ -296,51 +767,87 @@ namespace syrec {
             return garbage[n];
         }
 
-        auto operator==(const TruthTable& tt) const -> bool {
-            return (cubeMap == tt.cubeMap);
+        // The rows of a sparse table are stored in a map or a sorted vector (see SparseStorage), which is selected per table. The sorted vector avoids an
+        // allocation per row and a lookup per insertion, i.e. it suits tables that are built in bulk and read afterwards, e.g. by the PLA parser. Inserting
+        // into it is not thread-safe and neither is the first read after an insertion, which sorts the inserted rows.
+        //
+        // A completely specified table can be stored densely (see DenseOutputs), e.g. the table resulting from extend(). The const members read a dense table
+        // or the sorted vector storage directly, while the mutable access to the rows (operator[], the non-const begin(), end() and find() as well as the
+        // erasure, insertion and extraction of nodes) converts the table into the map storage first. Hence, such a table should be read through a const
+        // reference.
+
+        [[nodiscard]] auto getSparseStorage() const -> SparseStorage {
+            return sparseStorage;
         }
 
+        // selects the storage of the rows while the table is sparse
+        auto setSparseStorage(SparseStorage storage) -> void;
+
+        [[nodiscard]] auto isDense() const -> bool {
+            return denseOutputs.has_value();
+        }
+
+        [[nodiscard]] auto getDenseOutputs() const -> const DenseOutputs& {
+            assert(isDense());
+            return *denseOutputs;
+        }
+
+        // replaces the rows of the table by the given dense outputs
+        auto setDenseOutputs(DenseOutputs outputs) -> void {
+            cubeMap.clear();
+            sortedRows.clear();
+            insertedRows.clear();
+            denseOutputs = std::move(outputs);
+        }
+
+        // converts a completely specified table into the dense storage and returns whether the table is stored densely
+        auto toDense() -> bool;
+
+        // converts a dense table into the selected sparse storage
+        auto toSparse() -> void;
+
+        auto operator==(const TruthTable& tt) const -> bool;
+
         auto operator[](const Cube& key) -> Cube& {
+            toMap();
             return cubeMap[key];
         }
 
         auto operator[](Cube&& key) -> Cube& {
+            toMap();
             return cubeMap[std::move(key)];
         }
 
         [[nodiscard]] auto begin() -> decltype(cubeMap.begin()) {
+            toMap();
             return cubeMap.begin();
         }
 
         [[nodiscard]] auto end() -> decltype(cubeMap.end()) {
+            toMap();
             return cubeMap.end();
         }
 
-        [[nodiscard]] auto begin() const -> decltype(cubeMap.begin()) {
-            return cubeMap.begin();
-        }
+        [[nodiscard]] auto begin() const -> ConstIterator;
 
-        [[nodiscard]] auto end() const -> decltype(cubeMap.end()) {
-            return cubeMap.end();
-        }
+        [[nodiscard]] auto end() const -> ConstIterator;
 
         [[nodiscard]] auto empty() const -> bool {
-            return cubeMap.empty();
+            return !isDense() && cubeMap.empty() && sortedRows.empty() && insertedRows.empty();
         }
 
-        [[nodiscard]] auto size() const -> std::size_t {
-            return cubeMap.size();
-        }
+        [[nodiscard]] auto size() const -> std::size_t;
 
         [[nodiscard]] auto max_size() const -> std::size_t { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
             return cubeMap.max_size();
         }
 
         [[nodiscard]] auto nInputs() const -> std::size_t {
-            if (cubeMap.empty()) {
-                return 0U;
+            if (isDense()) {
+                return denseOutputs->nInputs();
             }
-            return cubeMap.begin()->first.size();
+            const auto [input, output] = firstRow();
+            return input == nullptr ? 0U : input->size();
         }
 
         [[nodiscard]] auto nPrimaryInputs() const -> std::size_t {
@@ -348,10 +855,11 @@ namespace syrec {
         }
 
         [[nodiscard]] auto nOutputs() const -> std::size_t {
-            if (cubeMap.empty()) {
-                return 0U;
+            if (isDense()) {
+                return denseOutputs->nOutputs();
             }
-            return cubeMap.begin()->second.size();
+            const auto [input, output] = firstRow();
+            return output == nullptr ? 0U : output->size();
         }
 
         [[nodiscard]] auto nPrimaryOutputs() const -> std::size_t {
@@ -359,27 +867,47 @@ namespace syrec {
         }
 
         auto extract(Cube const& key) -> CubeMap::node_type {
+            toMap();
             return cubeMap.extract(key);
         }
 
         auto swap(TruthTable& other) noexcept -> void {
             cubeMap.swap(other.cubeMap);
+            std::swap(sparseStorage, other.sparseStorage);
+            sortedRows.swap(other.sortedRows);
+            insertedRows.swap(other.insertedRows);
+            denseOutputs.swap(other.denseOutputs);
         }
 
         auto find(const std::uint64_t number, const std::size_t bw) -> decltype(cubeMap.cbegin()) {
+            toMap();
             return cubeMap.find(Cube::fromInteger(number, bw));
         }
 
         auto find(const std::string& str) -> decltype(cubeMap.cbegin()) {
+            toMap();
             return cubeMap.find(Cube::fromString(str));
         }
 
         auto find(const Cube& c) -> decltype(cubeMap.cbegin()) {
+            toMap();
             return cubeMap.find(c);
         }
 
+        [[nodiscard]] auto find(const std::uint64_t number, const std::size_t bw) const -> ConstIterator {
+            return find(Cube::fromInteger(number, bw));
+        }
+
+        [[nodiscard]] auto find(const std::string& str) const -> ConstIterator {
+            return find(Cube::fromString(str));
+        }
+
+        // finds the row of an input, which takes constant time for a dense table
+        [[nodiscard]] auto find(const Cube& c) const -> ConstIterator;
+
         template<class It>
         auto erase(It elem) -> It {
+            toMap();
             return cubeMap.erase(elem);
         }
 
@@ -390,15 +918,12 @@ namespace syrec {
         [[nodiscard]] auto filteredOutput(const Cube& output) const -> Cube;
 
         auto try_emplace(const Cube& input, const Cube& output) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-            assert(cubeMap.empty() || (input.size() == nInputs() && output.size() == nOutputs()));
-            cubeMap.try_emplace(input, output);
-        }
-        auto try_emplace(Cube&& input, Cube&& output) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
-            assert(cubeMap.empty() || (input.size() == nInputs() && output.size() == nOutputs()));
-            cubeMap.try_emplace(std::move(input), std::move(output));
+            try_emplace(Cube(input), Cube(output));
         }
+        auto try_emplace(Cube&& input, Cube&& output) -> void; // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
 
         auto insert(CubeMap::node_type nh) -> void {
+            toMap();
             cubeMap.insert(std::move(nh));
         }
 
@@ -408,6 +933,9 @@ namespace syrec {
 
         auto clear() -> void {
             cubeMap.clear();
+            sortedRows.clear();
+            insertedRows.clear();
+            denseOutputs.reset();
         }
     };
 } // namespace syrec
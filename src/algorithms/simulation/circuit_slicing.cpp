@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_slicing.hpp"
+
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "core/properties.hpp"
+#include "core/utils/timer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    bool sliceCircuit(Circuit& slice, std::vector<Gate::Line>& lineMapping, const Circuit& circ, const std::vector<Gate::Line>& lines,
+                      const Properties::ptr& statistics) {
+        Timer<PropertiesTimer> t;
+
+        if (statistics) {
+            const PropertiesTimer rt(statistics);
+            t.start(rt);
+        }
+
+        const std::size_t nLines = circ.getLines();
+        if (std::any_of(lines.cbegin(), lines.cend(), [nLines](const Gate::Line line) { return line >= nLines; })) {
+            if (statistics) {
+                t.stop();
+            }
+            return false;
+        }
+
+        std::vector<bool> isLineInCone(nLines, false);
+        for (const auto line: lines) {
+            isLineInCone[line] = true;
+        }
+
+        // Traverse the gates in reverse order: a gate influences the lines of the cone if it modifies any of them, in which case
+        // the values of all of its lines prior to the gate are also required to determine the output values of the cone.
+        const std::size_t nGates = circ.numGates();
+        std::vector<bool> isGateInCone(nGates, false);
+        std::size_t       gateIdx = nGates;
+        for (auto it = circ.cend(); it != circ.cbegin();) {
+            --it;
+            --gateIdx;
+            const auto& gate = **it;
+            if (std::none_of(gate.targets.cbegin(), gate.targets.cend(), [&isLineInCone](const Gate::Line targetLine) { return isLineInCone[targetLine]; })) {
+                continue;
+            }
+
+            isGateInCone[gateIdx] = true;
+            for (const auto controlLine: gate.controls) {
+                isLineInCone[controlLine] = true;
+            }
+            for (const auto targetLine: gate.targets) {
+                isLineInCone[targetLine] = true;
+            }
+        }
+
+        lineMapping.clear();
+        std::vector<Gate::Line> sliceLineOfCircuitLine(nLines, 0);
+        for (Gate::Line line = 0; line < nLines; ++line) {
+            if (isLineInCone[line]) {
+                sliceLineOfCircuitLine[line] = lineMapping.size();
+                lineMapping.emplace_back(line);
+            }
+        }
+
+        std::vector<std::string> inputs;
+        std::vector<std::string> outputs;
+        std::vector<constant>    constants;
+        std::vector<bool>        garbage;
+        for (const auto line: lineMapping) {
+            inputs.emplace_back(circ.getInput(line));
+            outputs.emplace_back(circ.getOutput(line));
+            constants.emplace_back(circ.getConstants()[line]);
+            garbage.emplace_back(circ.getGarbage()[line]);
+        }
+
+        slice.setLines(static_cast<unsigned>(lineMapping.size()));
+        slice.setInputs(inputs);
+        slice.setOutputs(outputs);
+        slice.setConstants(constants);
+        slice.setGarbage(garbage);
+
+        gateIdx = 0;
+        for (const auto& gate: circ) {
+            if (isGateInCone[gateIdx++]) {
+                const auto gateCopy = slice.createAndAddGateCopy(*gate, sliceLineOfCircuitLine);
+                if (gateCopy == nullptr) {
+                    if (statistics) {
+                        t.stop();
+                    }
+                    return false;
+                }
+                if (const auto& gateAnnotations = circ.getAnnotations(*gate); gateAnnotations.has_value()) {
+                    for (const auto& [annotationKey, annotationValue]: *gateAnnotations) {
+                        slice.annotate(*gateCopy, annotationKey, annotationValue);
+                    }
+                }
+            }
+        }
+
+        if (statistics) {
+            t.stop();
+        }
+        return true;
+    }
+} // namespace syrec
@@ -12,14 +12,44 @@
 
 #include "core/circuit.hpp"
 #include "core/gate.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/n_bit_values_container.hpp"
 #include "core/properties.hpp"
 #include "core/utils/timer.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
+#include <iterator>
 
 namespace syrec {
+    namespace {
+        void simulateDefinition(const HierarchicalCircuit& circ, const HierarchicalCircuit::DefinitionId definitionId, const bool isInverted, NBitValuesContainer& values) {
+            const auto& definition = circ.getDefinition(definitionId);
+            HierarchicalCircuit::forEachElement(
+                    definition, isInverted,
+                    [&](const std::size_t gate) {
+                        coreGateSimulation(**std::next(definition.circuit.cbegin(), static_cast<std::ptrdiff_t>(gate)), values);
+                        return true;
+                    },
+                    [&](const HierarchicalCircuit::Instance& instance) {
+                        if (!std::all_of(instance.controls.cbegin(), instance.controls.cend(), [&values](const Gate::Line controlLine) { return values[controlLine]; })) {
+                            return true;
+                        }
+
+                        NBitValuesContainer valuesOfInstance(instance.lineMapping.size());
+                        for (std::size_t line = 0; line < instance.lineMapping.size(); ++line) {
+                            valuesOfInstance.set(line, values[instance.lineMapping[line]]);
+                        }
+                        simulateDefinition(circ, instance.definition, instance.isInverted != isInverted, valuesOfInstance);
+                        for (std::size_t line = 0; line < instance.lineMapping.size(); ++line) {
+                            values.set(instance.lineMapping[line], valuesOfInstance[line]);
+                        }
+                        return true;
+                    });
+        }
+    } // namespace
+
     void coreGateSimulation(const Gate& g, NBitValuesContainer& input) {
         if (g.type == Gate::Type::Toffoli) {
             NBitValuesContainer cMask(input.size());
@@ -74,4 +104,21 @@ namespace syrec {
             t.stop();
         }
     }
+
+    void simpleSimulation(NBitValuesContainer& output, const HierarchicalCircuit& circ, const NBitValuesContainer& input,
+                          const Properties::ptr& statistics) {
+        Timer<PropertiesTimer> t;
+
+        if (statistics) {
+            const PropertiesTimer rt(statistics);
+            t.start(rt);
+        }
+
+        output = input;
+        simulateDefinition(circ, HierarchicalCircuit::TOP_LEVEL_DEFINITION, false, output);
+
+        if (statistics) {
+            t.stop();
+        }
+    }
 } // namespace syrec
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "core/utils/timer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace syrec {
+    namespace {
+        std::size_t getPeakResidentSetSize() {
+#if defined(__unix__) || defined(__APPLE__)
+            rusage usage{};
+            if (getrusage(RUSAGE_SELF, &usage) != 0) {
+                return 0;
+            }
+#if defined(__APPLE__)
+            // macOS reports the peak resident set size in bytes ...
+            return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+            // ... while it is reported in kilobytes on all other platforms
+            return static_cast<std::size_t>(usage.ru_maxrss) * 1024U;
+#endif
+#else
+            return 0;
+#endif
+        }
+
+        void writeJsonString(std::ostream& os, const std::string_view value) {
+            os << '"';
+            for (const char c: value) {
+                switch (c) {
+                    case '"':
+                        os << "\\\"";
+                        break;
+                    case '\\':
+                        os << "\\\\";
+                        break;
+                    case '\n':
+                        os << "\\n";
+                        break;
+                    case '\t':
+                        os << "\\t";
+                        break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20U) {
+                            os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<unsigned>(c) << std::dec << std::setfill(' ');
+                        } else {
+                            os << c;
+                        }
+                }
+            }
+            os << '"';
+        }
+
+        BatchSynthesisResult processJob(const BatchSynthesisJob& job) {
+            BatchSynthesisResult result;
+            result.name     = job.name;
+            result.filename = job.filename;
+            result.scheme   = job.scheme;
+
+            // Program::read(...) treats a file that cannot be opened like an empty program
+            if (const std::ifstream programFile(job.filename); !programFile.good()) {
+                result.errorMessage = "Could not open file " + job.filename;
+                return result;
+            }
+
+            Program                program;
+            const auto             parsingStatistics = std::make_shared<Properties>();
+            Timer<PropertiesTimer> parsingTimer;
+            parsingTimer.start(PropertiesTimer(parsingStatistics));
+            result.errorMessage = program.read(job.filename);
+            parsingTimer.stop();
+            result.parsingRuntime = parsingStatistics->get<double>("runtime", 0.);
+            if (result.errorMessage.empty() && program.modules().empty()) {
+                result.errorMessage = "Program does not contain any module";
+            }
+
+            if (result.errorMessage.empty()) {
+                Circuit    circ;
+                const auto statistics = std::make_shared<Properties>();
+                const auto settings   = job.settings ? job.settings : std::make_shared<Properties>();
+                result.ok             = job.scheme == SynthesisScheme::CostAware ? CostAwareSynthesis::synthesize(circ, program, settings, statistics) : LineAwareSynthesis::synthesize(circ, program, settings, statistics);
+                if (result.ok) {
+                    result.numGates        = static_cast<unsigned>(circ.numGates());
+                    result.lines           = circ.getLines();
+                    result.quantumCosts    = circ.quantumCost();
+                    result.transistorCosts = circ.transistorCost();
+                } else {
+                    result.errorMessage = "Synthesis of program failed";
+                }
+                result.synthesisRuntime = statistics->get<double>("runtime", 0.);
+            }
+            result.peakMemory = getPeakResidentSetSize();
+            return result;
+        }
+    } // namespace
+
+    std::string_view getNameOfSynthesisScheme(const SynthesisScheme scheme) {
+        return scheme == SynthesisScheme::CostAware ? "cost_aware" : "line_aware";
+    }
+
+    std::optional<SynthesisScheme> getSynthesisSchemeByName(const std::string_view name) {
+        std::string normalizedName(name);
+        std::replace(normalizedName.begin(), normalizedName.end(), '-', '_');
+        for (const auto scheme: {SynthesisScheme::CostAware, SynthesisScheme::LineAware}) {
+            if (normalizedName == getNameOfSynthesisScheme(scheme)) {
+                return scheme;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::vector<BatchSynthesisResult> synthesizeBatch(const std::vector<BatchSynthesisJob>& jobs, const unsigned nThreads) {
+        std::vector<BatchSynthesisResult> results(jobs.size());
+        const std::size_t                 nWorkers = std::min<std::size_t>(std::max(nThreads != 0U ? nThreads : std::thread::hardware_concurrency(), 1U), jobs.size());
+
+        // The workers take the next unprocessed job until all jobs were processed, each result is only written by the worker processing the job
+        std::atomic<std::size_t> nextJobIdx  = 0;
+        const auto               processJobs = [&]() {
+            for (std::size_t jobIdx = nextJobIdx++; jobIdx < jobs.size(); jobIdx = nextJobIdx++) {
+                results[jobIdx] = processJob(jobs[jobIdx]);
+            }
+        };
+
+        if (nWorkers <= 1U) {
+            processJobs();
+            return results;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(nWorkers);
+        for (std::size_t i = 0; i < nWorkers; ++i) {
+            workers.emplace_back(processJobs);
+        }
+        for (auto& worker: workers) {
+            worker.join();
+        }
+        return results;
+    }
+
+    std::vector<std::string> getNamesOfBatchSynthesisPrograms(const std::vector<std::string>& filenames) {
+        std::map<std::string, std::set<std::string>, std::less<>> filenamesPerStem;
+        for (const auto& filename: filenames) {
+            filenamesPerStem[std::filesystem::path(filename).stem().string()].emplace(filename);
+        }
+
+        std::vector<std::string> names;
+        names.reserve(filenames.size());
+        for (const auto& filename: filenames) {
+            std::string stem = std::filesystem::path(filename).stem().string();
+            names.emplace_back(filenamesPerStem.find(stem)->second.size() == 1 ? std::move(stem) : filename);
+        }
+        return names;
+    }
+
+    void writeBatchSynthesisReport(std::ostream& os, const std::vector<BatchSynthesisResult>& results) {
+        os << "{";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const auto& result = results[i];
+            os << (i == 0 ? "\n" : ",\n\n") << "  ";
+            writeJsonString(os, result.name);
+            os << ": {\n";
+            if (result.ok) {
+                os << "    \"num_gates\": " << result.numGates << ",\n";
+                os << "    \"lines\": " << result.lines << ",\n";
+                os << "    \"quantum_costs\": " << result.quantumCosts << ",\n";
+                os << "    \"transistor_costs\": " << result.transistorCosts << ",\n";
+            }
+            os << "    \"synthesis\": ";
+            writeJsonString(os, getNameOfSynthesisScheme(result.scheme));
+            os << ",\n";
+            if (!result.ok) {
+                os << "    \"error\": ";
+                writeJsonString(os, result.errorMessage);
+                os << "\n  }";
+                continue;
+            }
+            os << "    \"runtime\": {\n";
+            os << "      \"parsing\": " << result.parsingRuntime << ",\n";
+            os << "      \"synthesis\": " << result.synthesisRuntime << "\n";
+            os << "    },\n";
+            os << "    \"peak_memory\": " << result.peakMemory << "\n";
+            os << "  }";
+        }
+        os << (results.empty() ? "}\n" : "\n}\n");
+    }
+} // namespace syrec
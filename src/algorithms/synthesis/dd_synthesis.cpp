@@ -12,6 +12,7 @@
 
 #include "algorithms/optimization/esop_minimization.hpp"
 #include "algorithms/synthesis/encoding.hpp"
+#include "core/io/pla_parser.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/DDDefinitions.hpp"
 #include "dd/Node.hpp"
@@ -26,14 +27,390 @@
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <queue>
+#include <stdexcept>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 using namespace qc::literals;
 
 namespace syrec {
+    namespace {
+        // builds the DD of the sub-table of a dense truth table consisting of the given rows, whose inputs only differ in their nBits least significant bits
+        auto buildDenseDD(const TruthTable::DenseOutputs& outputs, const std::size_t nBits, const std::vector<std::uint64_t>& rows, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+            auto edges = std::array<dd::mEdge, 4U>{dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero()};
+
+            // the output position corresponding to the most significant input bit of the sub-table
+            const auto pos = outputs.nOutputs() - nBits;
+
+            // base case
+            if (nBits == 1U) {
+                for (const auto input: rows) {
+                    const auto in = (input & 1U) != 0U;
+                    if (const auto out = outputs.get(input, pos); out.has_value()) {
+                        const auto index = (static_cast<std::size_t>(*out) * 2U) + static_cast<std::size_t>(in);
+                        edges.at(index)  = dd::mEdge::one();
+                    } else {
+                        const auto offset     = in ? 1U : 0U;
+                        edges.at(0U + offset) = dd::mEdge::one();
+                        edges.at(2U + offset) = dd::mEdge::one();
+                    }
+                }
+                return dd->makeDDNode(0, edges);
+            }
+
+            // split the rows into the sub-tables
+            std::array<std::vector<std::uint64_t>, 4U> subRows{};
+            for (const auto input: rows) {
+                const auto in = ((input >> (nBits - 1U)) & 1U) != 0U;
+                if (const auto out = outputs.get(input, pos); out.has_value()) {
+                    const auto index = (static_cast<std::size_t>(*out) * 2U) + static_cast<std::size_t>(in);
+                    subRows.at(index).emplace_back(input);
+                } else {
+                    const auto offset = in ? 1U : 0U;
+                    subRows.at(0U + offset).emplace_back(input);
+                    subRows.at(2U + offset).emplace_back(input);
+                }
+            }
+            // recursively build the DD for each sub-table
+            for (std::size_t i = 0U; i < 4U; ++i) {
+                if (!subRows.at(i).empty()) {
+                    edges.at(i) = buildDenseDD(outputs, nBits - 1U, subRows.at(i), dd);
+                }
+                // free up the memory used by the sub-table as fast as possible.
+                std::vector<std::uint64_t>().swap(subRows.at(i));
+            }
+
+            const auto label = static_cast<dd::Qubit>(nBits - 1U);
+            return dd->makeDDNode(label, edges);
+        }
+
+        // the cubes of a truth table, of which the first cube covering an input determines its output
+        struct CubeRows {
+            std::vector<TruthTable::Cube> inputs;
+            std::vector<TruthTable::Cube> outputs;
+            // the position following the last input bit specified by each cube
+            std::vector<std::size_t> lastCare;
+            // for each position, the index of the first cube equal to each cube at this position and all following positions
+            std::vector<std::vector<std::size_t>> firstEqual;
+            // the DDs of the sub-tables built so far by their entries, for each number of remaining bits
+            std::vector<std::map<std::vector<std::size_t>, dd::mEdge>> computed;
+        };
+
+        // the mask of the bits of the given word corresponding to the given position and all following positions
+        auto suffixMask(const std::size_t word, const std::size_t pos) -> TruthTable::Cube::Word {
+            if (((word + 1U) * TruthTable::Cube::WORD_BITS) <= pos) {
+                return 0U;
+            }
+            if ((word * TruthTable::Cube::WORD_BITS) >= pos) {
+                return ~TruthTable::Cube::Word{0U};
+            }
+            return ~TruthTable::Cube::Word{0U} >> (pos % TruthTable::Cube::WORD_BITS);
+        }
+
+        // checks whether the cube covers all inputs of the other cube, considering the given position and all following positions only
+        auto covers(const TruthTable::Cube& cube, const TruthTable::Cube& other, const std::size_t pos) -> bool {
+            for (std::size_t i = 0U; i < cube.nWords(); ++i) {
+                const auto care = cube.careWords()[i] & suffixMask(i, pos);
+                if (((cube.valueWords()[i] ^ other.valueWords()[i]) & care) != 0U || (care & ~other.careWords()[i]) != 0U) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // checks whether the cubes are equal at the given position and all following positions
+        auto equalFrom(const TruthTable::Cube& lhs, const TruthTable::Cube& rhs, const std::size_t pos) -> bool {
+            for (std::size_t i = 0U; i < lhs.nWords(); ++i) {
+                const auto mask = suffixMask(i, pos);
+                if (((lhs.valueWords()[i] ^ rhs.valueWords()[i]) & mask) != 0U || ((lhs.careWords()[i] ^ rhs.careWords()[i]) & mask) != 0U) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // removes the entries of a sub-table, whose inputs only differ at the given position and all following positions, that do not change its DD.
+        // Thus, sub-tables reached by different paths are more likely to be given by the same entries and to be built only once.
+        auto removeRedundantEntries(const CubeRows& rows, std::vector<std::size_t>& entries, const std::size_t pos) -> void {
+            // no cube covers the inputs of the sub-table
+            if (entries.empty()) {
+                return;
+            }
+
+            // an entry is never the first to cover an input if a preceding cube covers all of its remaining inputs
+            std::vector<std::size_t> reducedEntries;
+            reducedEntries.reserve(entries.size());
+            for (const auto entry: entries) {
+                const auto& input = rows.inputs.at(entry >> 1U);
+                if (std::none_of(reducedEntries.cbegin(), reducedEntries.cend(), [&](const std::size_t previousEntry) { return covers(rows.inputs.at(previousEntry >> 1U), input, pos); })) {
+                    reducedEntries.emplace_back(entry);
+                }
+            }
+
+            // the last entry covers all remaining inputs, hence the preceding entries with the same remaining output are not needed either
+            const auto last = reducedEntries.back();
+            while (reducedEntries.size() > 1U) {
+                const auto entry = reducedEntries.at(reducedEntries.size() - 2U);
+                if ((entry & 1U) != (last & 1U) || ((last & 1U) == 0U && !equalFrom(rows.outputs.at(entry >> 1U), rows.outputs.at(last >> 1U), pos))) {
+                    break;
+                }
+                reducedEntries.erase(reducedEntries.end() - 2);
+            }
+            entries = std::move(reducedEntries);
+        }
+
+        // builds the DD of the sub-table of the given cubes, whose inputs only differ in their nBits least significant bits.
+        // An entry (index << 1U) refers to the cube with the given index, the inputs covered first by an entry with the least significant bit set are not part of the sub-table.
+        auto buildCubeDD(CubeRows& rows, const std::vector<std::size_t>& entries, const std::size_t nBits, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+            if (std::all_of(entries.cbegin(), entries.cend(), [](const std::size_t entry) { return (entry & 1U) != 0U; })) {
+                return dd::mEdge::zero();
+            }
+            // base case, only the entry covering the single input of the sub-table is left
+            if (nBits == 0U) {
+                return dd::mEdge::one();
+            }
+
+            auto& computed = rows.computed.at(nBits);
+            if (const auto it = computed.find(entries); it != computed.end()) {
+                return it->second;
+            }
+
+            // the output position corresponding to the most significant input bit of the sub-table
+            const auto pos = rows.inputs.front().size() - nBits;
+
+            // split the entries into the sub-tables, a cube with a don't care input is part of both halves of the inputs
+            std::array<std::vector<std::size_t>, 4U> subEntries{};
+            for (const auto in: {false, true}) {
+                const auto offset = in ? 1U : 0U;
+                for (const auto entry: entries) {
+                    const auto index = entry >> 1U;
+                    if (const auto input = rows.inputs.at(index)[pos]; input.has_value() && *input != in) {
+                        continue;
+                    }
+                    // the sub-tables only depend on the following positions of the cube
+                    const auto subEntry = (rows.firstEqual.at(pos + 1U).at(index) << 1U) | (entry & 1U);
+                    if (const auto output = rows.outputs.at(index)[pos]; (entry & 1U) == 0U && output.has_value()) {
+                        const auto outOffset = *output ? 2U : 0U;
+                        subEntries.at(outOffset + offset).emplace_back(subEntry);
+                        // the inputs covered by the cube are not part of the sub-table of the other output value
+                        subEntries.at((2U - outOffset) + offset).emplace_back(subEntry | 1U);
+                    } else {
+                        subEntries.at(0U + offset).emplace_back(subEntry);
+                        subEntries.at(2U + offset).emplace_back(subEntry);
+                    }
+                    // the following entries are never the first to cover an input if the cube covers all remaining inputs
+                    if (rows.lastCare.at(index) <= pos + 1U) {
+                        break;
+                    }
+                }
+            }
+
+            auto edges = std::array<dd::mEdge, 4U>{dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero()};
+            for (std::size_t i = 0U; i < 4U; ++i) {
+                removeRedundantEntries(rows, subEntries.at(i), pos + 1U);
+                edges.at(i) = buildCubeDD(rows, subEntries.at(i), nBits - 1U, dd);
+            }
+
+            // the sub-table is empty if all of its inputs are covered first by excluding entries
+            auto result = dd::mEdge::zero();
+            if (std::any_of(edges.cbegin(), edges.cend(), [](const dd::mEdge& e) { return !e.isZeroTerminal(); })) {
+                result = dd->makeDDNode(static_cast<dd::Qubit>(nBits - 1U), edges);
+            }
+            computed.emplace(entries, result);
+            return result;
+        }
+
+        // the position following the last input bit specified by the cube
+        auto lastCarePosition(const TruthTable::Cube& cube) -> std::size_t {
+            auto lastCare = cube.size();
+            while (lastCare > 0U && !cube[lastCare - 1U].has_value()) {
+                --lastCare;
+            }
+            return lastCare;
+        }
+
+        // collects the cubes of a truth table, the inputs of uncoveredInputs that are not covered by any cube are mapped to the zero output.
+        // Returns the entries of the cubes in the order in which they cover inputs.
+        auto collectCubeRows(const TruthTable& tt, const TruthTable::Cube& uncoveredInputs, CubeRows& rows) -> std::vector<std::size_t> {
+            // the complete cubes covered by a previous cube precede all other cubes, since their outputs are merged with the output of the covering cube
+            std::vector<std::size_t> mergedEntries;
+            std::vector<std::size_t> entries;
+            for (const auto& [input, output]: tt) {
+                const auto index    = rows.inputs.size();
+                const auto complete = std::all_of(input.begin(), input.end(), [](const TruthTable::Cube::Value& value) { return value.has_value(); });
+
+                // the cubes are iterated in the order of their inputs, hence all cubes covering a complete cube precede it
+                auto coveringIndex = index;
+                if (complete) {
+                    coveringIndex = static_cast<std::size_t>(std::find_if(rows.inputs.cbegin(), rows.inputs.cend(), [&input = input](const TruthTable::Cube& cube) { return covers(cube, input, 0U); }) - rows.inputs.cbegin());
+                }
+
+                rows.inputs.emplace_back(input);
+                rows.lastCare.emplace_back(lastCarePosition(input));
+                if (coveringIndex == index) {
+                    rows.outputs.emplace_back(output);
+                    entries.emplace_back(index << 1U);
+                    continue;
+                }
+
+                // clubbing the 1's of the output with the output of the covering cube
+                auto mergedOutput = rows.outputs.at(coveringIndex);
+                for (std::size_t i = 0U; i < output.size(); ++i) {
+                    if (output[i].has_value() && mergedOutput[i].has_value() && *output[i]) {
+                        mergedOutput[i] = true;
+                    }
+                }
+                rows.outputs.emplace_back(std::move(mergedOutput));
+                mergedEntries.emplace_back(index << 1U);
+            }
+
+            entries.emplace_back(rows.inputs.size() << 1U);
+            rows.inputs.emplace_back(uncoveredInputs);
+            rows.outputs.emplace_back(tt.nOutputs(), false);
+            rows.lastCare.emplace_back(lastCarePosition(uncoveredInputs));
+
+            mergedEntries.insert(mergedEntries.end(), entries.cbegin(), entries.cend());
+            return mergedEntries;
+        }
+
+        // builds the DD of a truth table with the same number of inputs and outputs given by its cubes, the inputs of uncoveredInputs that are not covered by any cube are mapped to the zero output
+        auto buildDDFromCubeRows(const TruthTable& tt, const TruthTable::Cube& uncoveredInputs, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+            if (tt.empty()) {
+                return dd::mEdge::zero();
+            }
+
+            const auto nBits = tt.nInputs();
+
+            CubeRows rows;
+            rows.computed.resize(nBits + 1U);
+            auto entries = collectCubeRows(tt, uncoveredInputs, rows);
+
+            // cubes that are equal at the remaining positions of a sub-table are referred to by the same entry
+            rows.firstEqual.resize(nBits + 1U);
+            for (std::size_t pos = 0U; pos <= nBits; ++pos) {
+                std::map<std::pair<TruthTable::Cube, TruthTable::Cube>, std::size_t> firstIndices;
+                for (std::size_t i = 0U; i < rows.inputs.size(); ++i) {
+                    auto key = std::make_pair(TruthTable::Cube(rows.inputs.at(i).begin() + static_cast<std::ptrdiff_t>(pos), rows.inputs.at(i).end()), TruthTable::Cube(rows.outputs.at(i).begin() + static_cast<std::ptrdiff_t>(pos), rows.outputs.at(i).end()));
+                    rows.firstEqual.at(pos).emplace_back(firstIndices.try_emplace(std::move(key), i).first->second);
+                }
+            }
+
+            removeRedundantEntries(rows, entries, 0U);
+            return buildCubeDD(rows, entries, nBits, dd);
+        }
+
+        // the number of inputs mapped to each output, which is given by the index of the first cube with this output
+        using OutputCounts = std::map<std::size_t, std::uint64_t>;
+
+        // the cubes of a truth table, whose inputs mapped to each output are counted
+        struct CubeCounts {
+            CubeRows rows;
+            // the index of the first cube with the same output as each cube
+            std::vector<std::size_t> outputIndices;
+            // for each position, the index of the first cube with the same output as each cube and an equal input at this position and all following positions
+            std::vector<std::vector<std::size_t>> firstEqual;
+            // the counts of the sub-tables computed so far by their cubes, for each position
+            std::vector<std::map<std::vector<std::size_t>, OutputCounts>> computed;
+        };
+
+        // counts the inputs mapped to each output of the sub-table of the given cubes, whose inputs only differ at the given position and all following positions.
+        // As in buildCubeDD, the first cube covering an input determines its output and the sub-tables are split recursively, but only by their inputs.
+        auto countOutputs(CubeCounts& counts, const std::vector<std::size_t>& cubes, const std::size_t pos) -> OutputCounts {
+            const auto& rows = counts.rows;
+
+            // base case, the first cube covers all remaining inputs
+            if (rows.lastCare.at(cubes.front()) <= pos) {
+                return {{counts.outputIndices.at(cubes.front()), std::uint64_t{1U} << (rows.inputs.front().size() - pos)}};
+            }
+
+            auto& computed = counts.computed.at(pos);
+            if (const auto it = computed.find(cubes); it != computed.end()) {
+                return it->second;
+            }
+
+            OutputCounts result;
+            for (const auto in: {false, true}) {
+                std::vector<std::size_t> subCubes;
+                for (const auto cube: cubes) {
+                    if (const auto input = rows.inputs.at(cube)[pos]; input.has_value() && *input != in) {
+                        continue;
+                    }
+                    // a cube is never the first to cover an input if a preceding cube covers all of its remaining inputs
+                    const auto subCube = counts.firstEqual.at(pos + 1U).at(cube);
+                    if (std::none_of(subCubes.cbegin(), subCubes.cend(), [&](const std::size_t previousCube) { return covers(rows.inputs.at(previousCube), rows.inputs.at(subCube), pos + 1U); })) {
+                        subCubes.emplace_back(subCube);
+                    }
+                    // the following cubes are never the first to cover an input if the cube covers all remaining inputs
+                    if (rows.lastCare.at(cube) <= pos + 1U) {
+                        break;
+                    }
+                }
+                if (subCubes.empty()) {
+                    continue;
+                }
+                for (const auto& [output, count]: countOutputs(counts, subCubes, pos + 1U)) {
+                    result[output] += count;
+                }
+            }
+            computed.emplace(cubes, result);
+            return result;
+        }
+
+        // the minimum number of additional lines required (see TruthTable::minimumAdditionalLinesRequired) by the truth table extended from the given cubes, without extending it
+        auto minimumAdditionalLinesOfCubes(const TruthTable& tt) -> std::size_t {
+            if (tt.empty()) {
+                return 0U;
+            }
+            // the number of inputs mapped to an output is counted by an unsigned 64 bit integer
+            if (tt.nInputs() > 63U) {
+                throw std::invalid_argument("Overflow!, Number of inputs is greater than maximum capacity (63)");
+            }
+
+            const auto nBits = tt.nInputs();
+
+            // all inputs not covered by a cube are mapped to the zero output
+            CubeCounts  counts;
+            const auto  entries = collectCubeRows(tt, TruthTable::Cube(nBits, TruthTable::Cube::Value()), counts.rows);
+            const auto& rows    = counts.rows;
+
+            std::map<TruthTable::Cube, std::size_t> firstOutputIndices;
+            for (std::size_t i = 0U; i < rows.outputs.size(); ++i) {
+                counts.outputIndices.emplace_back(firstOutputIndices.try_emplace(rows.outputs.at(i), i).first->second);
+            }
+
+            counts.firstEqual.resize(nBits + 1U);
+            for (std::size_t pos = 0U; pos <= nBits; ++pos) {
+                std::map<std::pair<TruthTable::Cube, std::size_t>, std::size_t> firstIndices;
+                for (std::size_t i = 0U; i < rows.inputs.size(); ++i) {
+                    auto key = std::make_pair(TruthTable::Cube(rows.inputs.at(i).begin() + static_cast<std::ptrdiff_t>(pos), rows.inputs.at(i).end()), counts.outputIndices.at(i));
+                    counts.firstEqual.at(pos).emplace_back(firstIndices.try_emplace(std::move(key), i).first->second);
+                }
+            }
+            counts.computed.resize(nBits + 1U);
+
+            std::vector<std::size_t> cubes;
+            cubes.reserve(entries.size());
+            for (const auto entry: entries) {
+                cubes.emplace_back(entry >> 1U);
+            }
+            const auto outputCounts = countOutputs(counts, cubes, 0U);
+
+            // the inputs mapped to the most frequent output are distinguished by the additional lines
+            const auto  maxCount        = std::max_element(outputCounts.cbegin(), outputCounts.cend(), [](const auto& lhs, const auto& rhs) { return lhs.second < rhs.second; })->second;
+            std::size_t additionalLines = 0U;
+            while ((std::uint64_t{1U} << additionalLines) < maxCount) {
+                ++additionalLines;
+            }
+            return additionalLines;
+        }
+    } // namespace
+
     auto buildDD(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
         // truth table has to have the same number of inputs and outputs
         assert(tt.nInputs() == tt.nOutputs());
@@ -42,6 +419,13 @@ namespace syrec {
             return dd::mEdge::zero();
         }
 
+        // a dense truth table is split by the integers of its inputs without constructing the sub-tables
+        if (tt.isDense()) {
+            std::vector<std::uint64_t> rows(static_cast<std::size_t>(tt.getDenseOutputs().nRows()));
+            std::iota(rows.begin(), rows.end(), std::uint64_t{0U});
+            return buildDenseDD(tt.getDenseOutputs(), tt.nInputs(), rows, dd);
+        }
+
         auto edges = std::array<dd::mEdge, 4U>{dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero()};
 
         // base case
@@ -90,6 +474,18 @@ namespace syrec {
         return dd->makeDDNode(label, edges);
     }
 
+    auto buildDDFromCubes(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+        // truth table has to have the same number of inputs and outputs
+        assert(tt.nInputs() == tt.nOutputs());
+
+        if (tt.nInputs() == 0U || tt.isDense()) {
+            return buildDD(tt, dd);
+        }
+
+        // all inputs not covered by a cube are mapped to the zero output
+        return buildDDFromCubeRows(tt, TruthTable::Cube(tt.nInputs(), TruthTable::Cube::Value()), dd);
+    }
+
     // This algorithm provides all paths with their signatures from the `src` node to the `current` node.
     // Refer to the control path section of http://www.informatik.uni-bremen.de/agra/doc/konf/12aspdac_qmdd_synth_rev.pdf
     auto DDSynthesizer::pathFromSrcDst(dd::mEdge const& src, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec) -> void {
@@ -752,6 +1148,85 @@ namespace syrec {
         return qc;
     }
 
+    auto DDSynthesizer::synthesizeCubesTT(TruthTable const& tt) -> std::shared_ptr<qc::QuantumComputation> {
+        reset();
+        n = tt.nInputs();
+        m = tt.nOutputs();
+
+        // The lines are added like in the one-pass synthesis (see synthesizeOnePassTT), but to the cubes instead of the rows of the extended truth table.
+        const auto k1 = minimumAdditionalLinesOfCubes(tt);
+
+        totalNoBits = std::max(n, m + k1);
+
+        r = (m + k1) - std::max(n, m);
+
+        // construct ddSynth only if it is pointing to null
+        if (ddSynth == nullptr) {
+            ddSynth = std::make_unique<dd::Package>(totalNoBits);
+        }
+
+        // construct qc only if it is pointing to null
+        if (qc == nullptr) {
+            qc = std::make_shared<qc::QuantumComputation>(totalNoBits, totalNoBits);
+        }
+
+        // zeros are inserted to the inputs to match the length of the output patterns, then zeros are appended to the inputs and the outputs up to totalNoBits
+        const auto nInsertedConstants = m > n ? m - n : 0U;
+        const auto nAppendedConstants = totalNoBits - (n + nInsertedConstants);
+
+        for (qc::Qubit i = 0U; i < nInsertedConstants; i++) {
+            // corresponding bits are considered as ancillary bits.
+            qc->setLogicalQubitAncillary(static_cast<qc::Qubit>((totalNoBits - 1) - i));
+        }
+        for (qc::Qubit i = 0U; i < nAppendedConstants; i++) {
+            // corresponding bits are considered as ancillary bits.
+            qc->setLogicalQubitAncillary(i);
+        }
+        for (qc::Qubit i = 0U; i < totalNoBits - m; i++) {
+            // corresponding bits are considered as garbage bits.
+            qc->setLogicalQubitGarbage(i);
+        }
+
+        TruthTable augmentedTT;
+        for (const auto& [input, output]: tt) {
+            TruthTable::Cube augmentedInput(nInsertedConstants, false);
+            augmentedInput.reserve(totalNoBits);
+            for (const auto& value: input) {
+                augmentedInput.emplace_back(value);
+            }
+            augmentedInput.resize(totalNoBits, false);
+
+            auto augmentedOutput = output;
+            augmentedOutput.resize(totalNoBits, false);
+            augmentedTT.try_emplace(std::move(augmentedInput), std::move(augmentedOutput));
+        }
+
+        // the inputs with a constant set to one do not belong to the function, all other inputs not covered by a cube are mapped to the zero output
+        TruthTable::Cube uncoveredInputs(nInsertedConstants, false);
+        uncoveredInputs.resize(nInsertedConstants + n);
+        uncoveredInputs.resize(totalNoBits, false);
+
+        // the appended garbage bits need not be considered during the synthesis process.
+        garbageFlag = true;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto src = buildDDFromCubeRows(augmentedTT, uncoveredInputs, ddSynth);
+        synthesize(src, ddSynth);
+
+        runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
+        return qc;
+    }
+
+    auto DDSynthesizer::synthesizePla(TruthTable tt, const DdSynthesisMethod method) -> std::shared_ptr<qc::QuantumComputation> {
+        if (method == DdSynthesisMethod::OnePass) {
+            return synthesizeCubes(tt);
+        }
+        // the coding techniques encode the outputs of all rows of the truth table
+        extend(tt);
+        return synthesizeTruthTable(tt, method);
+    }
+
     // explicitly instantiate the template function decoder.
     template void DDSynthesizer::decoder(TruthTable::CubeMap const& codewords);
 
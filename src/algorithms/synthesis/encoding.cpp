@@ -214,6 +214,11 @@ namespace syrec {
         const auto requiredOutConstants = nBits - tt.nOutputs();
         const auto requiredInConstants  = nBits - tt.nInputs();
 
+        // nothing needs to be added, which keeps a dense truth table dense
+        if (tt.nInputs() == nBits && tt.nOutputs() == nBits) {
+            return;
+        }
+
         for (auto& [input, output]: tt) {
             const auto currentGarbageVecSize = tt.getGarbage().size();
 
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_cache.hpp"
+
+#include "core/circuit.hpp"
+#include "core/io/binary_circuit.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <map>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    namespace {
+        constexpr std::string_view SYNTHESIS_CACHE_MAGIC   = "SYCE";
+        constexpr std::uint8_t     SYNTHESIS_CACHE_VERSION = 1U;
+        // Upper bounds for the statistics of an entry to prevent huge allocations when reading corrupted files
+        constexpr std::uint32_t MAX_STATISTICS            = 1U << 8U;
+        constexpr std::uint32_t MAX_STATISTIC_NAME_LENGTH = 1U << 8U;
+
+        // 64-bit FNV-1a hash, which unlike std::hash is stable across platforms and processes
+        std::uint64_t computeFnv1aHash(const std::string_view data) {
+            std::uint64_t hash = 0xcbf29ce484222325ULL;
+            for (const char c: data) {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 0x100000001b3ULL;
+            }
+            return hash;
+        }
+
+        std::string toHex(const std::uint64_t value) {
+            std::ostringstream os;
+            os << std::hex << std::setw(16) << std::setfill('0') << value;
+            return os.str();
+        }
+
+        // Serializes the abstract syntax tree of a module into a canonical string, in which each (un)called module is represented by its hash
+        class ModuleSerializer {
+        public:
+            std::string hashOf(const Module& module) {
+                if (const auto it = hashes.find(&module); it != hashes.cend()) {
+                    return it->second;
+                }
+
+                std::string previousData = std::move(data);
+                data.clear();
+                append(module.name);
+                for (const auto& parameter: module.parameters) {
+                    append(*parameter);
+                }
+                append('|');
+                for (const auto& variable: module.variables) {
+                    append(*variable);
+                }
+                append(module.statements);
+                std::string hash = toHex(computeFnv1aHash(data));
+                data             = std::move(previousData);
+                return hashes.emplace(&module, std::move(hash)).first->second;
+            }
+
+        private:
+            void append(const char tag) {
+                data.push_back(tag);
+            }
+
+            void append(const std::uint64_t value) {
+                data += std::to_string(value);
+                data.push_back(',');
+            }
+
+            void append(const std::string_view value) {
+                append(static_cast<std::uint64_t>(value.size()));
+                data += value;
+            }
+
+            void append(const Variable& variable) {
+                append(static_cast<std::uint64_t>(variable.type));
+                append(variable.name);
+                append(static_cast<std::uint64_t>(variable.dimensions.size()));
+                for (const auto dimension: variable.dimensions) {
+                    append(static_cast<std::uint64_t>(dimension));
+                }
+                append(static_cast<std::uint64_t>(variable.bitwidth));
+            }
+
+            void append(const Number::ptr& number) {
+                if (!number) {
+                    append('_');
+                } else if (number->isLoopVariable()) {
+                    append('$');
+                    append(static_cast<std::uint64_t>(number->loopVariableSlot()));
+                } else {
+                    append('#');
+                    append(static_cast<std::uint64_t>(number->evaluate({})));
+                }
+            }
+
+            void append(const VariableAccess& access) {
+                append(access.var->name);
+                if (access.range.has_value()) {
+                    append(':');
+                    append(access.range->first);
+                    append(access.range->second);
+                }
+                append('[');
+                for (const auto& index: access.indexes) {
+                    append(*index);
+                }
+                append(']');
+            }
+
+            void append(const Expression& expression) {
+                switch (expression.kind()) {
+                    case Expression::Kind::Numeric: {
+                        const auto& numericExpression = static_cast<const NumericExpression&>(expression);
+                        append('N');
+                        append(numericExpression.value);
+                        append(static_cast<std::uint64_t>(numericExpression.bwidth));
+                    } break;
+                    case Expression::Kind::Variable:
+                        append('V');
+                        append(*static_cast<const VariableExpression&>(expression).var);
+                        break;
+                    case Expression::Kind::Binary: {
+                        const auto& binaryExpression = static_cast<const BinaryExpression&>(expression);
+                        append('B');
+                        append(static_cast<std::uint64_t>(binaryExpression.op));
+                        append(*binaryExpression.lhs);
+                        append(*binaryExpression.rhs);
+                    } break;
+                    case Expression::Kind::Shift: {
+                        const auto& shiftExpression = static_cast<const ShiftExpression&>(expression);
+                        append('S');
+                        append(static_cast<std::uint64_t>(shiftExpression.op));
+                        append(*shiftExpression.lhs);
+                        append(shiftExpression.rhs);
+                    } break;
+                }
+            }
+
+            void appendCall(const std::string_view callee, const Module& target, const std::vector<std::string>& parameters) {
+                append(callee);
+                append(hashOf(target));
+                for (const auto& parameter: parameters) {
+                    append(parameter);
+                }
+                append(';');
+            }
+
+            void append(const Statement::vec& statements) {
+                append('{');
+                for (const auto& statement: statements) {
+                    switch (statement->kind()) {
+                        case Statement::Kind::Skip:
+                            append('k');
+                            break;
+                        case Statement::Kind::Swap: {
+                            const auto& swapStatement = static_cast<const SwapStatement&>(*statement);
+                            append('w');
+                            append(*swapStatement.lhs);
+                            append(*swapStatement.rhs);
+                        } break;
+                        case Statement::Kind::Unary: {
+                            const auto& unaryStatement = static_cast<const UnaryStatement&>(*statement);
+                            append('u');
+                            append(static_cast<std::uint64_t>(unaryStatement.op));
+                            append(*unaryStatement.var);
+                        } break;
+                        case Statement::Kind::Assign: {
+                            const auto& assignStatement = static_cast<const AssignStatement&>(*statement);
+                            append('a');
+                            append(static_cast<std::uint64_t>(assignStatement.op));
+                            append(*assignStatement.lhs);
+                            append(*assignStatement.rhs);
+                        } break;
+                        case Statement::Kind::If: {
+                            const auto& ifStatement = static_cast<const IfStatement&>(*statement);
+                            append('i');
+                            append(*ifStatement.condition);
+                            append(ifStatement.thenStatements);
+                            append(ifStatement.elseStatements);
+                            append(*ifStatement.fiCondition);
+                        } break;
+                        case Statement::Kind::For: {
+                            const auto& forStatement = static_cast<const ForStatement&>(*statement);
+                            append('f');
+                            append(static_cast<std::uint64_t>(forStatement.loopVariableSlot));
+                            append(forStatement.range.first);
+                            append(forStatement.range.second);
+                            append(forStatement.step);
+                            append(forStatement.statements);
+                        } break;
+                        case Statement::Kind::Call: {
+                            const auto& callStatement = static_cast<const CallStatement&>(*statement);
+                            appendCall("call", *callStatement.target, callStatement.parameters);
+                        } break;
+                        case Statement::Kind::Uncall: {
+                            const auto& uncallStatement = static_cast<const UncallStatement&>(*statement);
+                            appendCall("uncall", *uncallStatement.target, uncallStatement.parameters);
+                        } break;
+                    }
+                }
+                append('}');
+            }
+
+            std::string                          data;
+            std::map<const Module*, std::string> hashes;
+        };
+
+        void writeUnsigned(std::ostream& os, std::uint32_t value) {
+            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                os.put(static_cast<char>(value & 0xFFU));
+                value >>= 8U;
+            }
+        }
+
+        std::optional<std::uint32_t> readUnsigned(std::istream& is) {
+            std::uint32_t value = 0;
+            for (std::size_t i = 0; i < sizeof(value); ++i) {
+                const auto byte = is.get();
+                if (byte == std::istream::traits_type::eof()) {
+                    return std::nullopt;
+                }
+                value |= static_cast<std::uint32_t>(byte) << (8U * i);
+            }
+            return value;
+        }
+    } // namespace
+
+    std::string SynthesisCache::computeKey(const Module& mainModule, const std::string_view configuration) {
+        ModuleSerializer serializer;
+        std::string      data = serializer.hashOf(mainModule);
+        data += configuration;
+        // circuits synthesized by previous versions of the synthesis algorithms are not reused
+        data += " " + std::to_string(SYNTHESIS_ALGORITHM_VERSION);
+        return toHex(computeFnv1aHash(data));
+    }
+
+    bool SynthesisCache::load(const std::string& key, Circuit& circ, Statistics& statistics) const {
+        std::ifstream file(getFilenameOfEntry(key), std::ios::binary);
+        if (!file) {
+            return false;
+        }
+
+        std::string magic(SYNTHESIS_CACHE_MAGIC.size() + 1U, '\0');
+        if (!file.read(magic.data(), static_cast<std::streamsize>(magic.size())) || magic.substr(0, SYNTHESIS_CACHE_MAGIC.size()) != SYNTHESIS_CACHE_MAGIC || static_cast<std::uint8_t>(magic.back()) != SYNTHESIS_CACHE_VERSION) {
+            return false;
+        }
+
+        const auto nStatistics = readUnsigned(file);
+        if (!nStatistics.has_value() || *nStatistics > MAX_STATISTICS) {
+            return false;
+        }
+        Statistics cachedStatistics;
+        for (std::uint32_t i = 0; i < *nStatistics; ++i) {
+            const auto nameLength = readUnsigned(file);
+            if (!nameLength.has_value() || *nameLength > MAX_STATISTIC_NAME_LENGTH) {
+                return false;
+            }
+            std::string name(*nameLength, '\0');
+            if (!file.read(name.data(), static_cast<std::streamsize>(name.size()))) {
+                return false;
+            }
+            const auto value = readUnsigned(file);
+            if (!value.has_value()) {
+                return false;
+            }
+            cachedStatistics.emplace_back(std::move(name), *value);
+        }
+
+        Circuit cachedCirc;
+        if (!readBinaryCircuit(cachedCirc, file)) {
+            return false;
+        }
+        circ       = std::move(cachedCirc);
+        statistics = std::move(cachedStatistics);
+        return true;
+    }
+
+    bool SynthesisCache::store(const std::string& key, const Circuit& circ, const Statistics& statistics) const {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error) {
+            return false;
+        }
+
+        // The random suffix of the temporary file prevents collisions with concurrent writers of the same entry
+        std::random_device randomDevice;
+        const std::string  temporaryFilename = getFilenameOfEntry(key) + "." + toHex((static_cast<std::uint64_t>(randomDevice()) << 32U) | randomDevice()) + ".tmp";
+        {
+            std::ofstream file(temporaryFilename, std::ios::binary);
+            file.write(SYNTHESIS_CACHE_MAGIC.data(), static_cast<std::streamsize>(SYNTHESIS_CACHE_MAGIC.size()));
+            file.put(static_cast<char>(SYNTHESIS_CACHE_VERSION));
+            writeUnsigned(file, static_cast<std::uint32_t>(statistics.size()));
+            for (const auto& [name, value]: statistics) {
+                writeUnsigned(file, static_cast<std::uint32_t>(name.size()));
+                file.write(name.data(), static_cast<std::streamsize>(name.size()));
+                writeUnsigned(file, value);
+            }
+            if (!writeBinaryCircuit(circ, file) || !file.flush()) {
+                file.close();
+                std::filesystem::remove(temporaryFilename, error);
+                return false;
+            }
+        }
+
+        // Renaming the complete temporary file atomically replaces the entry
+        std::filesystem::rename(temporaryFilename, getFilenameOfEntry(key), error);
+        if (error) {
+            std::filesystem::remove(temporaryFilename, error);
+            return false;
+        }
+        return true;
+    }
+
+    std::string SynthesisCache::getFilenameOfEntry(const std::string& key) const {
+        return (std::filesystem::path(directory) / (key + ".bin")).string();
+    }
+} // namespace syrec
@@ -0,0 +1,683 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_server.hpp"
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_session.hpp"
+#include "core/circuit.hpp"
+#include "core/io/binary_circuit.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/io/quantum_computation_import.hpp"
+#include "core/properties.hpp"
+#include "core/real/parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "core/utils/timer.hpp"
+
+#include <algorithm>
+#include <any>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <variant>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace syrec {
+    namespace {
+        constexpr std::uint8_t PROTOCOL_VERSION = 1U;
+        // Upper bound for the payload of a frame to prevent huge allocations when receiving corrupted frames
+        constexpr std::uint32_t MAX_FRAME_SIZE = 1U << 26U;
+        // The payload of a frame is received in chunks, so that memory is only allocated for the data actually sent by the peer
+        constexpr std::size_t FRAME_CHUNK_SIZE = std::size_t{1U} << 20U;
+        // Number of idle synthesis sessions and of responses to recent requests kept by the server
+        constexpr std::size_t MAX_IDLE_SESSIONS    = 32U;
+        constexpr std::size_t MAX_RECENT_RESPONSES = 64U;
+        // Interval in which blocked threads of the server check whether it was stopped
+        constexpr int POLL_INTERVAL_MS = 100;
+
+        template<typename T>
+        void append(std::string& payload, T value) {
+            for (std::size_t i = 0; i < sizeof(T); ++i) {
+                payload.push_back(static_cast<char>(value & 0xFFU));
+                value = static_cast<T>(value >> 8U);
+            }
+        }
+
+        void append(std::string& payload, const std::string_view value) {
+            append(payload, static_cast<std::uint32_t>(value.size()));
+            payload += value;
+        }
+
+        // Reads the values of a payload in the order in which they were appended, all reads fail once the end of the payload was reached
+        class PayloadReader {
+        public:
+            explicit PayloadReader(const std::string_view payload):
+                remaining(payload) {}
+
+            template<typename T>
+            std::optional<T> read() {
+                if (remaining.size() < sizeof(T)) {
+                    return std::nullopt;
+                }
+                T value = 0;
+                for (std::size_t i = 0; i < sizeof(T); ++i) {
+                    value = static_cast<T>(value | static_cast<T>(static_cast<T>(static_cast<unsigned char>(remaining[i])) << (8U * i)));
+                }
+                remaining.remove_prefix(sizeof(T));
+                return value;
+            }
+
+            std::optional<std::string> readString() {
+                const auto length = read<std::uint32_t>();
+                if (!length.has_value() || remaining.size() < *length) {
+                    return std::nullopt;
+                }
+                std::string value(remaining.substr(0, *length));
+                remaining.remove_prefix(*length);
+                return value;
+            }
+
+            // Reads an enumerator whose underlying value must not exceed the one of the last enumerator
+            template<typename Enum>
+            std::optional<Enum> readEnum(const Enum last) {
+                const auto value = read<std::uint8_t>();
+                if (!value.has_value() || *value > static_cast<std::uint8_t>(last)) {
+                    return std::nullopt;
+                }
+                return static_cast<Enum>(*value);
+            }
+
+            [[nodiscard]] bool atEnd() const {
+                return remaining.empty();
+            }
+
+        private:
+            std::string_view remaining;
+        };
+
+        // The statistics of a synthesis that can be sent to the client
+        void addStatistics(SynthesisResponse& response, const Properties& statistics) {
+            for (const auto& [name, value]: statistics) {
+                if (const auto* boolValue = std::any_cast<bool>(&value)) {
+                    response.statistics[name] = *boolValue;
+                } else if (const auto* unsignedValue = std::any_cast<unsigned>(&value)) {
+                    response.statistics[name] = static_cast<std::uint64_t>(*unsignedValue);
+                } else if (const auto* doubleValue = std::any_cast<double>(&value)) {
+                    response.statistics[name] = *doubleValue;
+                }
+            }
+        }
+
+        void addCircuit(SynthesisResponse& response, const Circuit& circ, const bool returnCircuit) {
+            response.statistics["lines"]            = static_cast<std::uint64_t>(circ.getLines());
+            response.statistics["gates"]            = static_cast<std::uint64_t>(circ.numGates());
+            response.statistics["quantum_costs"]    = static_cast<std::uint64_t>(circ.quantumCost());
+            response.statistics["transistor_costs"] = static_cast<std::uint64_t>(circ.transistorCost());
+            // The gates of a circuit created by a dry run are only counted
+            if (returnCircuit && !circ.isInCostEstimationMode()) {
+                std::ostringstream os;
+                if (!writeBinaryCircuit(circ, os)) {
+                    response.error = "Could not write the synthesized circuit";
+                    return;
+                }
+                response.circuit = os.str();
+            }
+        }
+
+#if !defined(_WIN32)
+        void disableSigpipe([[maybe_unused]] const int fd) {
+#if defined(SO_NOSIGPIPE)
+            const int enabled = 1;
+            ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+        }
+
+        bool sendAll(const int fd, std::string_view data) {
+#if defined(MSG_NOSIGNAL)
+            constexpr int flags = MSG_NOSIGNAL;
+#else
+            constexpr int flags = 0;
+#endif
+            while (!data.empty()) {
+                const auto nSent = ::send(fd, data.data(), data.size(), flags);
+                if (nSent < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (nSent <= 0) {
+                    return false;
+                }
+                data.remove_prefix(static_cast<std::size_t>(nSent));
+            }
+            return true;
+        }
+
+        // Receives exactly the requested number of bytes, if given, the flag is checked while waiting for data and the reception fails if no data is
+        // received within the idle timeout
+        bool receiveAll(const int fd, char* data, std::size_t size, const std::atomic<bool>* stopped, const std::chrono::milliseconds idleTimeout) {
+            auto lastReception = std::chrono::steady_clock::now();
+            while (size > 0) {
+                if (stopped != nullptr) {
+                    pollfd     pollRequest{fd, POLLIN, 0};
+                    const auto nReady = ::poll(&pollRequest, 1, POLL_INTERVAL_MS);
+                    if (stopped->load()) {
+                        return false;
+                    }
+                    if (nReady == 0 && std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - lastReception) >= idleTimeout) {
+                        return false;
+                    }
+                    if (nReady == 0 || (nReady < 0 && errno == EINTR)) {
+                        continue;
+                    }
+                    if (nReady < 0) {
+                        return false;
+                    }
+                }
+                const auto nReceived = ::recv(fd, data, size, 0);
+                if (nReceived < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (nReceived <= 0) {
+                    return false;
+                }
+                data += nReceived;
+                size -= static_cast<std::size_t>(nReceived);
+                lastReception = std::chrono::steady_clock::now();
+            }
+            return true;
+        }
+
+        bool sendFrame(const int fd, const std::string& payload) {
+            if (payload.size() > MAX_FRAME_SIZE) {
+                return false;
+            }
+            std::string frame;
+            frame.reserve(sizeof(std::uint32_t) + payload.size());
+            append(frame, std::string_view(payload));
+            return sendAll(fd, frame);
+        }
+
+        std::optional<std::string> receiveFrame(const int fd, const std::atomic<bool>* stopped, const std::chrono::milliseconds idleTimeout = std::chrono::milliseconds::max()) {
+            std::string header(sizeof(std::uint32_t), '\0');
+            if (!receiveAll(fd, header.data(), header.size(), stopped, idleTimeout)) {
+                return std::nullopt;
+            }
+            const auto size = PayloadReader(header).read<std::uint32_t>();
+            if (!size.has_value() || *size > MAX_FRAME_SIZE) {
+                return std::nullopt;
+            }
+            std::string payload;
+            while (payload.size() < *size) {
+                const std::size_t nReceived = payload.size();
+                payload.resize(nReceived + std::min(FRAME_CHUNK_SIZE, *size - nReceived));
+                if (!receiveAll(fd, payload.data() + nReceived, payload.size() - nReceived, stopped, idleTimeout)) {
+                    return std::nullopt;
+                }
+            }
+            return payload;
+        }
+
+        std::optional<sockaddr_un> getSocketAddress(const std::string& socketPath) {
+            sockaddr_un address{};
+            if (socketPath.empty() || socketPath.size() >= sizeof(address.sun_path)) {
+                return std::nullopt;
+            }
+            address.sun_family = AF_UNIX;
+            std::copy(socketPath.cbegin(), socketPath.cend(), static_cast<char*>(address.sun_path));
+            return address;
+        }
+
+        int connectToSocket(const sockaddr_un& address) {
+            const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (fd < 0) {
+                return -1;
+            }
+            if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+                ::close(fd);
+                return -1;
+            }
+            disableSigpipe(fd);
+            return fd;
+        }
+#endif
+    } // namespace
+
+    std::string SynthesisRequest::encode() const {
+        std::string payload;
+        append(payload, PROTOCOL_VERSION);
+        append(payload, static_cast<std::uint8_t>(format));
+        append(payload, static_cast<std::uint8_t>(scheme));
+        append(payload, static_cast<std::uint8_t>(ddMethod));
+        append(payload, static_cast<std::uint8_t>(returnCircuit ? 1U : 0U));
+        append(payload, static_cast<std::uint32_t>(settings.size()));
+        for (const auto& [key, value]: settings) {
+            append(payload, std::string_view(key));
+            append(payload, static_cast<std::uint8_t>(value.index()));
+            if (const auto* boolValue = std::get_if<bool>(&value)) {
+                append(payload, static_cast<std::uint8_t>(*boolValue ? 1U : 0U));
+            } else if (const auto* unsignedValue = std::get_if<unsigned>(&value)) {
+                append(payload, static_cast<std::uint32_t>(*unsignedValue));
+            } else {
+                append(payload, std::string_view(std::get<std::string>(value)));
+            }
+        }
+        append(payload, std::string_view(content));
+        return payload;
+    }
+
+    std::optional<SynthesisRequest> SynthesisRequest::decode(const std::string_view payload) {
+        PayloadReader reader(payload);
+        if (reader.read<std::uint8_t>() != PROTOCOL_VERSION) {
+            return std::nullopt;
+        }
+
+        SynthesisRequest request;
+        const auto       format        = reader.readEnum(Format::Real);
+        const auto       scheme        = reader.readEnum(SynthesisScheme::LineAware);
+        const auto       ddMethod      = reader.readEnum(DdSynthesisMethod::CodingWithoutAdditionalLine);
+        const auto       returnCircuit = reader.read<std::uint8_t>();
+        const auto       nSettings     = reader.read<std::uint32_t>();
+        if (!format.has_value() || !scheme.has_value() || !ddMethod.has_value() || !returnCircuit.has_value() || *returnCircuit > 1U || !nSettings.has_value()) {
+            return std::nullopt;
+        }
+        request.format        = *format;
+        request.scheme        = *scheme;
+        request.ddMethod      = *ddMethod;
+        request.returnCircuit = *returnCircuit == 1U;
+
+        for (std::uint32_t i = 0; i < *nSettings; ++i) {
+            auto       key  = reader.readString();
+            const auto type = reader.read<std::uint8_t>();
+            if (!key.has_value() || !type.has_value()) {
+                return std::nullopt;
+            }
+            if (*type == 0U) {
+                const auto value = reader.read<std::uint8_t>();
+                if (!value.has_value() || *value > 1U) {
+                    return std::nullopt;
+                }
+                request.settings[*key] = *value == 1U;
+            } else if (*type == 1U) {
+                const auto value = reader.read<std::uint32_t>();
+                if (!value.has_value()) {
+                    return std::nullopt;
+                }
+                request.settings[*key] = static_cast<unsigned>(*value);
+            } else {
+                auto value = reader.readString();
+                if (*type != 2U || !value.has_value()) {
+                    return std::nullopt;
+                }
+                request.settings[*key] = std::move(*value);
+            }
+        }
+
+        auto content = reader.readString();
+        if (!content.has_value() || !reader.atEnd()) {
+            return std::nullopt;
+        }
+        request.content = std::move(*content);
+        return request;
+    }
+
+    std::string SynthesisResponse::encode() const {
+        std::string payload;
+        append(payload, PROTOCOL_VERSION);
+        append(payload, std::string_view(error));
+        append(payload, static_cast<std::uint32_t>(statistics.size()));
+        for (const auto& [name, value]: statistics) {
+            append(payload, std::string_view(name));
+            append(payload, static_cast<std::uint8_t>(value.index()));
+            if (const auto* boolValue = std::get_if<bool>(&value)) {
+                append(payload, static_cast<std::uint8_t>(*boolValue ? 1U : 0U));
+            } else if (const auto* unsignedValue = std::get_if<std::uint64_t>(&value)) {
+                append(payload, *unsignedValue);
+            } else {
+                // Doubles are sent as their IEEE 754 bit pattern
+                std::uint64_t bits        = 0;
+                const double  doubleValue = std::get<double>(value);
+                std::memcpy(&bits, &doubleValue, sizeof(bits));
+                append(payload, bits);
+            }
+        }
+        append(payload, std::string_view(circuit));
+        return payload;
+    }
+
+    std::optional<SynthesisResponse> SynthesisResponse::decode(const std::string_view payload) {
+        PayloadReader reader(payload);
+        if (reader.read<std::uint8_t>() != PROTOCOL_VERSION) {
+            return std::nullopt;
+        }
+
+        SynthesisResponse response;
+        auto              error       = reader.readString();
+        const auto        nStatistics = reader.read<std::uint32_t>();
+        if (!error.has_value() || !nStatistics.has_value()) {
+            return std::nullopt;
+        }
+        response.error = std::move(*error);
+
+        for (std::uint32_t i = 0; i < *nStatistics; ++i) {
+            auto       name = reader.readString();
+            const auto type = reader.read<std::uint8_t>();
+            if (!name.has_value() || !type.has_value()) {
+                return std::nullopt;
+            }
+            if (*type == 0U) {
+                const auto value = reader.read<std::uint8_t>();
+                if (!value.has_value() || *value > 1U) {
+                    return std::nullopt;
+                }
+                response.statistics[*name] = *value == 1U;
+            } else {
+                const auto value = reader.read<std::uint64_t>();
+                if (*type > 2U || !value.has_value()) {
+                    return std::nullopt;
+                }
+                if (*type == 1U) {
+                    response.statistics[*name] = *value;
+                } else {
+                    double doubleValue = 0.;
+                    std::memcpy(&doubleValue, &*value, sizeof(doubleValue));
+                    response.statistics[*name] = doubleValue;
+                }
+            }
+        }
+
+        auto circuit = reader.readString();
+        if (!circuit.has_value() || !reader.atEnd()) {
+            return std::nullopt;
+        }
+        response.circuit = std::move(*circuit);
+        return response;
+    }
+
+    SynthesisServer::SynthesisServer(std::string socketPath, const std::size_t nWorkers, const std::chrono::milliseconds idleTimeout):
+        socketPath(std::move(socketPath)), nWorkers(std::max<std::size_t>(nWorkers != 0U ? nWorkers : std::thread::hardware_concurrency(), 1U)), idleTimeout(idleTimeout) {}
+
+    SynthesisServer::~SynthesisServer() {
+        stop();
+    }
+
+    std::string SynthesisServer::start() {
+#if defined(_WIN32)
+        return "Unix domain sockets are not supported on this platform";
+#else
+        if (!stopped.load()) {
+            return "Server is already running";
+        }
+        const auto address = getSocketAddress(socketPath);
+        if (!address.has_value()) {
+            return "Invalid socket path " + socketPath;
+        }
+
+        // A socket file that does not accept any connections was left by a terminated server
+        if (const int fd = connectToSocket(*address); fd >= 0) {
+            ::close(fd);
+            return "Socket " + socketPath + " is used by a running server";
+        }
+        if (struct stat status{}; ::stat(socketPath.c_str(), &status) == 0) {
+            if (!S_ISSOCK(status.st_mode)) {
+                return "File " + socketPath + " is not a socket";
+            }
+            ::unlink(socketPath.c_str());
+        }
+
+        listeningSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listeningSocket < 0) {
+            return "Could not create socket";
+        }
+        if (::bind(listeningSocket, reinterpret_cast<const sockaddr*>(&*address), sizeof(*address)) != 0 || ::listen(listeningSocket, SOMAXCONN) != 0) {
+            ::close(listeningSocket);
+            listeningSocket = -1;
+            return "Could not listen on socket " + socketPath;
+        }
+
+        stopped.store(false);
+        acceptor = std::thread(&SynthesisServer::acceptConnections, this);
+        for (std::size_t i = 0; i < nWorkers; ++i) {
+            workers.emplace_back(&SynthesisServer::serveConnections, this);
+        }
+        return "";
+#endif
+    }
+
+    void SynthesisServer::stop() {
+#if !defined(_WIN32)
+        if (stopped.exchange(true)) {
+            return;
+        }
+        {
+            // Prevents that a worker misses the notification between checking the flag and waiting
+            const std::lock_guard lock(connectionsMutex);
+        }
+        connectionAvailable.notify_all();
+        acceptor.join();
+        for (auto& worker: workers) {
+            worker.join();
+        }
+        workers.clear();
+
+        for (; !pendingConnections.empty(); pendingConnections.pop()) {
+            ::close(pendingConnections.front());
+        }
+        ::close(listeningSocket);
+        listeningSocket = -1;
+        ::unlink(socketPath.c_str());
+#endif
+    }
+
+    void SynthesisServer::acceptConnections() {
+#if !defined(_WIN32)
+        while (!stopped.load()) {
+            pollfd pollRequest{listeningSocket, POLLIN, 0};
+            if (::poll(&pollRequest, 1, POLL_INTERVAL_MS) <= 0) {
+                continue;
+            }
+            const int connection = ::accept(listeningSocket, nullptr, nullptr);
+            if (connection < 0) {
+                continue;
+            }
+            disableSigpipe(connection);
+            {
+                const std::lock_guard lock(connectionsMutex);
+                pendingConnections.push(connection);
+            }
+            connectionAvailable.notify_one();
+        }
+#endif
+    }
+
+    void SynthesisServer::serveConnections() {
+#if !defined(_WIN32)
+        while (true) {
+            int connection = -1;
+            {
+                std::unique_lock lock(connectionsMutex);
+                connectionAvailable.wait(lock, [this]() { return stopped.load() || !pendingConnections.empty(); });
+                if (stopped.load()) {
+                    return;
+                }
+                connection = pendingConnections.front();
+                pendingConnections.pop();
+            }
+            serveConnection(connection);
+            ::close(connection);
+        }
+#endif
+    }
+
+    void SynthesisServer::serveConnection([[maybe_unused]] const int connection) {
+#if !defined(_WIN32)
+        for (auto payload = receiveFrame(connection, &stopped, idleTimeout); payload.has_value(); payload = receiveFrame(connection, &stopped, idleTimeout)) {
+            const auto request = SynthesisRequest::decode(*payload);
+            if (!request.has_value()) {
+                SynthesisResponse response;
+                response.error = "Invalid request";
+                sendFrame(connection, response.encode());
+                return;
+            }
+            if (!sendFrame(connection, handle(*request).encode())) {
+                return;
+            }
+        }
+#endif
+    }
+
+    SynthesisResponse SynthesisServer::handle(const SynthesisRequest& request) {
+        auto encodedRequest = request.encode();
+        {
+            const std::lock_guard lock(responsesMutex);
+            if (const auto recentResponse = recentResponses.find(encodedRequest); recentResponse != recentResponses.cend()) {
+                auto response                          = recentResponse->second;
+                response.statistics["reused_response"] = true;
+                return response;
+            }
+        }
+
+        SynthesisResponse response;
+        try {
+            if (request.format == SynthesisRequest::Format::SyReC) {
+                response = handleSyrecRequest(request);
+            } else {
+                const auto             statistics = std::make_shared<Properties>();
+                Timer<PropertiesTimer> timer;
+                timer.start(PropertiesTimer(statistics));
+
+                Circuit circ;
+                if (request.format == SynthesisRequest::Format::Pla) {
+                    TruthTable         tt;
+                    std::istringstream is(request.content);
+                    parsePla(tt, is);
+                    const auto qc = DDSynthesizer::synthesizePla(std::move(tt), request.ddMethod);
+                    if (qc == nullptr || !importQuantumComputation(circ, *qc)) {
+                        response.error = "DD-based synthesis of truth table failed";
+                    }
+                } else if (!importQuantumComputation(circ, RealParser::imports(request.content))) {
+                    response.error = "Circuit contains unsupported operations";
+                }
+
+                timer.stop();
+                if (response.error.empty()) {
+                    addStatistics(response, *statistics);
+                    addCircuit(response, circ, request.returnCircuit);
+                }
+            }
+        } catch (const std::exception& e) {
+            response       = SynthesisResponse();
+            response.error = e.what();
+        }
+        if (!response.error.empty()) {
+            response.statistics.clear();
+            response.circuit.clear();
+            return response;
+        }
+
+        response.statistics["reused_response"] = false;
+        const std::lock_guard lock(responsesMutex);
+        if (recentResponses.emplace(encodedRequest, response).second) {
+            recentRequests.push(std::move(encodedRequest));
+            if (recentRequests.size() > MAX_RECENT_RESPONSES) {
+                recentResponses.erase(recentRequests.front());
+                recentRequests.pop();
+            }
+        }
+        return response;
+    }
+
+    SynthesisResponse SynthesisServer::handleSyrecRequest(const SynthesisRequest& request) {
+        // Sessions can only be reused for requests with the same scheme and settings
+        SynthesisRequest sessionRequest;
+        sessionRequest.scheme   = request.scheme;
+        sessionRequest.settings = request.settings;
+        auto sessionKey         = sessionRequest.encode();
+
+        std::unique_ptr<SynthesisSession> session;
+        {
+            const std::lock_guard lock(sessionsMutex);
+            if (const auto idleSession = std::find_if(idleSessions.begin(), idleSessions.end(), [&](const auto& entry) { return entry.first == sessionKey; }); idleSession != idleSessions.end()) {
+                session = std::move(idleSession->second);
+                idleSessions.erase(idleSession);
+            }
+        }
+        if (!session) {
+            const auto settings = std::make_shared<Properties>();
+            for (const auto& [key, value]: request.settings) {
+                std::visit([&settings, &key = key](const auto& settingValue) { settings->set(key, settingValue); }, value);
+            }
+            session = std::make_unique<SynthesisSession>(request.scheme, settings);
+        }
+
+        SynthesisResponse response;
+        const auto        statistics = std::make_shared<Properties>();
+        if (response.error = session->parse(request.content, statistics); response.error.empty()) {
+            if (session->synthesize(statistics)) {
+                addStatistics(response, *statistics);
+                addCircuit(response, session->circuit(), request.returnCircuit);
+            } else {
+                response.error = "Synthesis of program failed";
+            }
+        }
+
+        const std::lock_guard lock(sessionsMutex);
+        idleSessions.emplace_front(std::move(sessionKey), std::move(session));
+        if (idleSessions.size() > MAX_IDLE_SESSIONS) {
+            idleSessions.pop_back();
+        }
+        return response;
+    }
+
+    SynthesisResponse sendSynthesisRequest([[maybe_unused]] const std::string& socketPath, [[maybe_unused]] const SynthesisRequest& request) {
+        SynthesisResponse response;
+#if defined(_WIN32)
+        response.error = "Unix domain sockets are not supported on this platform";
+#else
+        const auto address = getSocketAddress(socketPath);
+        const int  fd      = address.has_value() ? connectToSocket(*address) : -1;
+        if (fd < 0) {
+            response.error = "Could not connect to synthesis server at " + socketPath;
+            return response;
+        }
+
+        std::optional<std::string> payload;
+        if (sendFrame(fd, request.encode())) {
+            payload = receiveFrame(fd, nullptr);
+        }
+        ::close(fd);
+
+        if (auto receivedResponse = payload.has_value() ? SynthesisResponse::decode(*payload) : std::nullopt; receivedResponse.has_value()) {
+            response = std::move(*receivedResponse);
+        } else {
+            response.error = "Invalid response of synthesis server at " + socketPath;
+        }
+#endif
+        return response;
+    }
+} // namespace syrec
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/synthesis_session.hpp"
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/lexer.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    namespace {
+        struct SourceOfModule {
+            std::string_view source;
+            unsigned         firstLineNumber;
+        };
+
+        // Splits the program at the keywords introducing its modules, any characters preceding the first module belong to the first module
+        std::vector<SourceOfModule> splitIntoModules(const std::string_view source) {
+            std::vector<SourceOfModule> modules;
+            std::size_t                 moduleBegin = 0;
+            Lexer                       lexer(source);
+            for (Token token = lexer.next(); token.kind != Token::Kind::EndOfInput && token.kind != Token::Kind::Invalid; token = lexer.next()) {
+                if (token.kind != Token::Kind::Identifier || token.text != "module") {
+                    continue;
+                }
+                if (modules.empty()) {
+                    modules.push_back({{}, 1U});
+                } else {
+                    modules.back().source = source.substr(moduleBegin, token.offset - moduleBegin);
+                    modules.push_back({{}, token.lineNumber});
+                    moduleBegin = token.offset;
+                }
+            }
+            if (!modules.empty()) {
+                modules.back().source = source.substr(moduleBegin);
+            }
+            return modules;
+        }
+
+        void collectCallees(const Statement::vec& statements, std::vector<Module::ptr>& callees) {
+            for (const auto& statement: statements) {
+                switch (statement->kind()) {
+                    case Statement::Kind::If: {
+                        const auto& ifStatement = static_cast<const IfStatement&>(*statement);
+                        collectCallees(ifStatement.thenStatements, callees);
+                        collectCallees(ifStatement.elseStatements, callees);
+                    } break;
+                    case Statement::Kind::For:
+                        collectCallees(static_cast<const ForStatement&>(*statement).statements, callees);
+                        break;
+                    case Statement::Kind::Call:
+                        callees.emplace_back(static_cast<const CallStatement&>(*statement).target);
+                        break;
+                    case Statement::Kind::Uncall:
+                        callees.emplace_back(static_cast<const UncallStatement&>(*statement).target);
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        std::vector<Module::ptr> getCallees(const Module& module) {
+            std::vector<Module::ptr> callees;
+            collectCallees(module.statements, callees);
+            std::sort(callees.begin(), callees.end());
+            callees.erase(std::unique(callees.begin(), callees.end()), callees.end());
+            return callees;
+        }
+    } // namespace
+
+    SynthesisSession::SynthesisSession(const SynthesisScheme scheme, Properties::ptr settings, const ReadProgramSettings& readSettings):
+        scheme(scheme), settings(std::move(settings)), readSettings(readSettings) {}
+
+    std::string SynthesisSession::parse(const std::string_view source, const Properties::ptr& statistics) {
+        std::unordered_map<std::string_view, const ParsedModule*> previousModules;
+        for (const auto& parsedModule: parsedModules) {
+            previousModules.emplace(parsedModule.source, &parsedModule);
+        }
+
+        auto                      newProg = std::make_unique<Program>();
+        std::vector<ParsedModule> newParsedModules;
+        unsigned                  nReusedModules   = 0U;
+        bool                      parsedSeparately = true;
+        for (const auto& [moduleSource, firstLineNumber]: splitIntoModules(source)) {
+            // A module is reused if its source did not change and it still calls the same modules
+            if (const auto previousModule = previousModules.find(moduleSource); previousModule != previousModules.cend() && previousModule->second->firstLineNumber == firstLineNumber) {
+                const auto& callees = previousModule->second->callees;
+                if (std::all_of(callees.cbegin(), callees.cend(), [&](const Module::ptr& callee) { return newProg->findModule(callee->name) == callee; })) {
+                    newProg->addModule(previousModule->second->module);
+                    newParsedModules.emplace_back(*previousModule->second);
+                    ++nReusedModules;
+                    continue;
+                }
+            }
+
+            ReadProgramSettings moduleReadSettings = readSettings;
+            moduleReadSettings.firstLineNumber     = firstLineNumber;
+            const std::size_t nModules             = newProg->modules().size();
+            if (!newProg->readFromString(moduleSource, moduleReadSettings).empty() || newProg->modules().size() != nModules + 1U) {
+                parsedSeparately = false;
+                break;
+            }
+            const auto& module = newProg->modules().back();
+            newParsedModules.push_back({std::string(moduleSource), firstLineNumber, module, getCallees(*module)});
+        }
+
+        if (!parsedSeparately || newParsedModules.empty()) {
+            newProg = std::make_unique<Program>();
+            if (auto error = newProg->readFromString(source, readSettings); !error.empty()) {
+                return error;
+            }
+
+            // Since the modules could not be parsed separately, their sources are unknown and the modules cannot be reused
+            newParsedModules.clear();
+            nReusedModules = 0U;
+            for (const auto& module: newProg->modules()) {
+                newParsedModules.push_back({std::string(), 0U, module, getCallees(*module)});
+            }
+        }
+
+        // The cached syntheses of the replaced modules are removed before the modules are destroyed, since a module parsed later could be allocated at the address
+        // of a destroyed module and would then be identified with its cached syntheses
+        std::set<const Module*> modulesOfProgram;
+        for (const auto& module: newProg->modules()) {
+            modulesOfProgram.emplace(module.get());
+        }
+        moduleSynthesisCache->retainModules(modulesOfProgram);
+
+        prog          = std::move(newProg);
+        parsedModules = std::move(newParsedModules);
+        if (statistics) {
+            statistics->set("reparsed_modules", static_cast<unsigned>(parsedModules.size()) - nReusedModules);
+            statistics->set("reused_modules", nReusedModules);
+        }
+        return {};
+    }
+
+    bool SynthesisSession::synthesize(const Properties::ptr& statistics) {
+        if (prog->modules().empty()) {
+            return false;
+        }
+
+        // The main module is chosen like by the synthesis schemes
+        Module::ptr main;
+        if (const auto mainModule = get<std::string>(settings, "main_module", std::string()); !mainModule.empty()) {
+            main = prog->findModule(mainModule);
+        } else {
+            main = prog->findModule("main");
+            if (!main) {
+                main = prog->modules().front();
+            }
+        }
+
+        std::map<const Module*, const ParsedModule*> parsedModulesByModule;
+        for (const auto& parsedModule: parsedModules) {
+            parsedModulesByModule.emplace(parsedModule.module.get(), &parsedModule);
+        }
+        std::vector<Module::ptr> modulesOfCircuit;
+        if (main) {
+            modulesOfCircuit.emplace_back(main);
+            std::set<const Module*> visitedModules{main.get()};
+            for (std::size_t i = 0; i < modulesOfCircuit.size(); ++i) {
+                for (const auto& callee: parsedModulesByModule.at(modulesOfCircuit[i].get())->callees) {
+                    if (visitedModules.emplace(callee.get()).second) {
+                        modulesOfCircuit.emplace_back(callee);
+                    }
+                }
+            }
+        }
+
+        if (modulesOfCircuit == synthesizedModules) {
+            if (statistics) {
+                statistics->set("reused_circuit", true);
+            }
+            return true;
+        }
+
+        auto synthesisSettings = settings ? std::make_shared<Properties>(*settings) : std::make_shared<Properties>();
+        synthesisSettings->set("memoize_module_synthesis", true);
+        synthesisSettings->set("module_synthesis_cache", moduleSynthesisCache);
+
+        Circuit    newCirc;
+        const bool synthesisOk = scheme == SynthesisScheme::CostAware ? CostAwareSynthesis::synthesize(newCirc, *prog, synthesisSettings, statistics) : LineAwareSynthesis::synthesize(newCirc, *prog, synthesisSettings, statistics);
+        if (statistics) {
+            statistics->set("reused_circuit", false);
+        }
+        if (!synthesisOk) {
+            circ = Circuit();
+            synthesizedModules.reset();
+            return false;
+        }
+        circ               = std::move(newCirc);
+        synthesizedModules = std::move(modulesOfCircuit);
+        return true;
+    }
+} // namespace syrec
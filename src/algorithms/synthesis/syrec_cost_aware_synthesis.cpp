@@ -12,6 +12,7 @@
 
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/circuit.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/program.hpp"
 
@@ -40,4 +41,9 @@ namespace syrec {
         CostAwareSynthesis synthesizer(circ);
         return SyrecSynthesis::synthesize(&synthesizer, circ, program, settings, statistics);
     }
+
+    bool CostAwareSynthesis::synthesize(HierarchicalCircuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics) {
+        CostAwareSynthesis synthesizer(circ.getTopLevelCircuit());
+        return SyrecSynthesis::synthesize(&synthesizer, circ, program, settings, statistics);
+    }
 } // namespace syrec
@@ -12,6 +12,7 @@
 
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 #include "core/circuit.hpp"
+#include "core/hierarchical_circuit.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/program.hpp"
@@ -24,16 +25,15 @@
 
 namespace syrec {
     bool LineAwareSynthesis::processStatement(Circuit& circuit, const Statement::ptr& statement) {
-        const auto* const stmtCastedAsAssignmentStmt = dynamic_cast<const AssignStatement*>(statement.get());
-        if (stmtCastedAsAssignmentStmt == nullptr) {
+        if (statement->kind() != Statement::Kind::Assign) {
             return SyrecSynthesis::onStatement(circuit, statement);
         }
 
-        const AssignStatement& assignmentStmt = *stmtCastedAsAssignmentStmt;
-        std::vector<unsigned>  d;
-        std::vector<unsigned>  dd;
-        std::vector<unsigned>  ddd;
-        std::vector<unsigned>  statLhs;
+        const auto&           assignmentStmt = static_cast<const AssignStatement&>(*statement);
+        std::vector<unsigned> d;
+        std::vector<unsigned> dd;
+        std::vector<unsigned> ddd;
+        std::vector<unsigned> statLhs;
         getVariables(assignmentStmt.lhs, statLhs);
 
         // The line aware synthesis of an assignment can only be performed when the rhs input signals are repeated (since the results are stored in the rhs)
@@ -149,13 +149,16 @@ namespace syrec {
     }
 
     bool LineAwareSynthesis::flow(const Expression::ptr& expression, std::vector<unsigned>& v) {
-        if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
-            return (binary->op == BinaryExpression::Add || binary->op == BinaryExpression::Subtract || binary->op == BinaryExpression::Exor) && flow(*binary, v);
-        }
-        if (auto const* var = dynamic_cast<VariableExpression*>(expression.get())) {
-            return flow(*var, v);
+        switch (expression->kind()) {
+            case Expression::Kind::Binary: {
+                const auto& binary = static_cast<const BinaryExpression&>(*expression);
+                return (binary.op == BinaryExpression::Add || binary.op == BinaryExpression::Subtract || binary.op == BinaryExpression::Exor) && flow(binary, v);
+            }
+            case Expression::Kind::Variable:
+                return flow(static_cast<const VariableExpression&>(*expression), v);
+            default:
+                return false;
         }
-        return false;
     }
 
     bool LineAwareSynthesis::flow(const VariableExpression& expression, std::vector<unsigned>& v) {
@@ -191,13 +194,15 @@ namespace syrec {
             }
         } else {
             std::vector<unsigned> lines;
-            subFlag     = true;
-            synthesisOk = expEvaluate(circuit, lines, expOp, expLhs, statLhs);
-            subFlag     = false;
+            subFlag                                 = true;
+            Circuit::GateRange gatesOfExpEvaluation = circuit.beginGateRange();
+            synthesisOk                             = expEvaluate(circuit, lines, expOp, expLhs, statLhs);
+            circuit.endGateRange(gatesOfExpEvaluation);
+            subFlag = false;
             synthesisOk &= expEvaluate(circuit, lines, statOp, lines, expRhs);
             subFlag = true;
-            if (expOp < 3) {
-                synthesisOk &= expressionOpInverse(circuit, expOp, expLhs, statLhs);
+            if (isEvaluatedInPlace(expOp)) {
+                synthesisOk &= circuit.appendInverseOfGateRange(circuit, gatesOfExpEvaluation);
             }
         }
         subFlag = false;
@@ -205,13 +210,14 @@ namespace syrec {
     }
 
     bool LineAwareSynthesis::opRhsLhsExpression(const Expression::ptr& expression, std::vector<unsigned>& v) {
-        if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
-            return opRhsLhsExpression(*binary, v);
-        }
-        if (auto const* var = dynamic_cast<VariableExpression*>(expression.get())) {
-            return opRhsLhsExpression(*var, v);
+        switch (expression->kind()) {
+            case Expression::Kind::Binary:
+                return opRhsLhsExpression(static_cast<const BinaryExpression&>(*expression), v);
+            case Expression::Kind::Variable:
+                return opRhsLhsExpression(static_cast<const VariableExpression&>(*expression), v);
+            default:
+                return false;
         }
-        return false;
     }
 
     bool LineAwareSynthesis::opRhsLhsExpression(const VariableExpression& expression, std::vector<unsigned>& v) {
@@ -235,10 +241,12 @@ namespace syrec {
         expOpp.pop();
         expLhss.pop();
         expRhss.pop();
+        expGateRanges.pop();
     }
 
     bool LineAwareSynthesis::inverse(Circuit& circuit) {
-        const bool synthesisOfInversionOk = expressionOpInverse(circuit, expOpp.top(), expLhss.top(), expRhss.top());
+        // Only the operations evaluated in-place on the lines of their operands are reverted
+        const bool synthesisOfInversionOk = !isEvaluatedInPlace(expOpp.top()) || circuit.appendInverseOfGateRange(circuit, expGateRanges.top());
         subFlag                           = false;
         popExp();
         return synthesisOfInversionOk;
@@ -351,23 +359,17 @@ namespace syrec {
         }
     }
 
-    bool LineAwareSynthesis::expressionOpInverse(Circuit& circuit, const unsigned op, const std::vector<unsigned>& expLhs, const std::vector<unsigned>& expRhs) const {
-        // With the return value we only propagate an error if the defined 'synthesis' operation for any of the handled operations fails. In all other cases, we assume that
-        // no synthesis should be performed and simply return OK.
-        switch (op) {
-            case BinaryExpression::Add: // +
-                return decrease(circuit, expRhs, expLhs);
-            case BinaryExpression::Subtract: // -
-                return decreaseNewAssign(circuit, expRhs, expLhs);
-            case BinaryExpression::Exor: // ^
-                return bitwiseCnot(circuit, expRhs, expLhs);
-            default:
-                return true;
-        }
+    bool LineAwareSynthesis::isEvaluatedInPlace(const unsigned op) {
+        return op == BinaryExpression::Add || op == BinaryExpression::Subtract || op == BinaryExpression::Exor;
     }
 
     bool LineAwareSynthesis::synthesize(Circuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics) {
         LineAwareSynthesis synthesizer(circ);
         return SyrecSynthesis::synthesize(&synthesizer, circ, program, settings, statistics);
     }
+
+    bool LineAwareSynthesis::synthesize(HierarchicalCircuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics) {
+        LineAwareSynthesis synthesizer(circ.getTopLevelCircuit());
+        return SyrecSynthesis::synthesize(&synthesizer, circ, program, settings, statistics);
+    }
 } // namespace syrec
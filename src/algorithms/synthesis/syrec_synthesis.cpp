@@ -10,10 +10,13 @@
 
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 
+#include "algorithms/synthesis/synthesis_cache.hpp"
 #include "core/circuit.hpp"
 #include "core/gate.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
 #include "core/syrec/program.hpp"
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
@@ -23,11 +26,118 @@
 #include <cassert>
 #include <cstddef>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <sstream>
 #include <stack>
 #include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace syrec {
+    namespace {
+        bool isLoopVariable(const Number& number, const std::string& loopVariable) {
+            return number.isLoopVariable() && number.variableName() == loopVariable;
+        }
+
+        // The value of the loop variable may only be used to determine the lines of a variable access, either as the index of a dimension
+        // (which are only evaluated when determining the accessed lines) or as a single accessed bit
+        bool isLoopVariableOnlyUsedToAccessLines(const VariableAccess& variableAccess, const std::string& loopVariable) {
+            if (!variableAccess.range.has_value()) {
+                return true;
+            }
+            const auto& [first, second] = *variableAccess.range;
+            return isLoopVariable(*first, loopVariable) == isLoopVariable(*second, loopVariable);
+        }
+
+        bool isLoopVariableOnlyUsedToAccessLines(const Expression& expression, const std::string& loopVariable) {
+            switch (expression.kind()) {
+                case Expression::Kind::Numeric:
+                    return !isLoopVariable(*static_cast<const NumericExpression&>(expression).value, loopVariable);
+                case Expression::Kind::Variable:
+                    return isLoopVariableOnlyUsedToAccessLines(*static_cast<const VariableExpression&>(expression).var, loopVariable);
+                case Expression::Kind::Binary: {
+                    const auto& binaryExpression = static_cast<const BinaryExpression&>(expression);
+                    return isLoopVariableOnlyUsedToAccessLines(*binaryExpression.lhs, loopVariable) && isLoopVariableOnlyUsedToAccessLines(*binaryExpression.rhs, loopVariable);
+                }
+                case Expression::Kind::Shift: {
+                    const auto& shiftExpression = static_cast<const ShiftExpression&>(expression);
+                    return isLoopVariableOnlyUsedToAccessLines(*shiftExpression.lhs, loopVariable) && !isLoopVariable(*shiftExpression.rhs, loopVariable);
+                }
+            }
+            return false;
+        }
+
+        bool isLoopVariableOnlyUsedToAccessLines(const Statement::vec& statements, const std::string& loopVariable);
+
+        bool isLoopVariableOnlyUsedToAccessLines(const Statement& statement, const std::string& loopVariable) {
+            switch (statement.kind()) {
+                case Statement::Kind::Swap: {
+                    const auto& swapStatement = static_cast<const SwapStatement&>(statement);
+                    return isLoopVariableOnlyUsedToAccessLines(*swapStatement.lhs, loopVariable) && isLoopVariableOnlyUsedToAccessLines(*swapStatement.rhs, loopVariable);
+                }
+                case Statement::Kind::Unary:
+                    return isLoopVariableOnlyUsedToAccessLines(*static_cast<const UnaryStatement&>(statement).var, loopVariable);
+                case Statement::Kind::Assign: {
+                    const auto& assignStatement = static_cast<const AssignStatement&>(statement);
+                    return isLoopVariableOnlyUsedToAccessLines(*assignStatement.lhs, loopVariable) && isLoopVariableOnlyUsedToAccessLines(*assignStatement.rhs, loopVariable);
+                }
+                case Statement::Kind::If: {
+                    const auto& ifStatement = static_cast<const IfStatement&>(statement);
+                    return isLoopVariableOnlyUsedToAccessLines(*ifStatement.condition, loopVariable) && isLoopVariableOnlyUsedToAccessLines(*ifStatement.fiCondition, loopVariable) && isLoopVariableOnlyUsedToAccessLines(ifStatement.thenStatements, loopVariable) && isLoopVariableOnlyUsedToAccessLines(ifStatement.elseStatements, loopVariable);
+                }
+                case Statement::Kind::For: {
+                    const auto& forStatement = static_cast<const ForStatement&>(statement);
+                    const auto& [from, to]   = forStatement.range;
+                    return (!from || !isLoopVariable(*from, loopVariable)) && !isLoopVariable(*to, loopVariable) && (!forStatement.step || !isLoopVariable(*forStatement.step, loopVariable)) && isLoopVariableOnlyUsedToAccessLines(forStatement.statements, loopVariable);
+                }
+                default:
+                    // The remaining statements are either skip statements or (un)calls whose modules cannot access the loop variable
+                    return true;
+            }
+        }
+
+        bool isLoopVariableOnlyUsedToAccessLines(const Statement::vec& statements, const std::string& loopVariable) {
+            return std::all_of(statements.cbegin(), statements.cend(), [&loopVariable](const Statement::ptr& statement) { return isLoopVariableOnlyUsedToAccessLines(*statement, loopVariable); });
+        }
+
+        bool usesLocalVariables(const Statement::vec& statements, std::set<const Module*>& visitedModules);
+
+        // Whether the module or any module (un)called by it declares local variables, which keep the lines of their first (un)call in all later (un)calls
+        bool usesLocalVariables(const Module& module, std::set<const Module*>& visitedModules) {
+            if (!visitedModules.emplace(&module).second) {
+                return false;
+            }
+            return !module.variables.empty() || usesLocalVariables(module.statements, visitedModules);
+        }
+
+        bool usesLocalVariables(const Statement::vec& statements, std::set<const Module*>& visitedModules) {
+            return std::any_of(statements.cbegin(), statements.cend(), [&visitedModules](const Statement::ptr& statement) {
+                switch (statement->kind()) {
+                    case Statement::Kind::If: {
+                        const auto& ifStatement = static_cast<const IfStatement&>(*statement);
+                        return usesLocalVariables(ifStatement.thenStatements, visitedModules) || usesLocalVariables(ifStatement.elseStatements, visitedModules);
+                    }
+                    case Statement::Kind::For:
+                        return usesLocalVariables(static_cast<const ForStatement&>(*statement).statements, visitedModules);
+                    case Statement::Kind::Call:
+                        return usesLocalVariables(*static_cast<const CallStatement&>(*statement).target, visitedModules);
+                    case Statement::Kind::Uncall:
+                        return usesLocalVariables(*static_cast<const UncallStatement&>(*statement).target, visitedModules);
+                    default:
+                        return false;
+                }
+            });
+        }
+    } // namespace
+
     // Helper Functions for the synthesis methods
     SyrecSynthesis::SyrecSynthesis(Circuit& circ):
         circ(circ) {
@@ -91,24 +201,44 @@ namespace syrec {
         circuit.setOrUpdateGlobalGateAnnotation(GATE_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER, std::to_string(static_cast<std::size_t>(statement->lineNumber)));
 
         bool okay = true;
-        if (auto const* swapStat = dynamic_cast<SwapStatement*>(statement.get())) {
-            okay = onStatement(circuit, *swapStat);
-        } else if (auto const* unaryStat = dynamic_cast<UnaryStatement*>(statement.get())) {
-            okay = onStatement(circuit, *unaryStat);
-        } else if (auto const* assignStat = dynamic_cast<AssignStatement*>(statement.get())) {
-            okay = onStatement(circuit, *assignStat);
-        } else if (auto const* ifStat = dynamic_cast<IfStatement*>(statement.get())) {
-            okay = onStatement(circuit, *ifStat);
-        } else if (auto const* forStat = dynamic_cast<ForStatement*>(statement.get())) {
-            okay = onStatement(circuit, *forStat);
-        } else if (auto const* callStat = dynamic_cast<CallStatement*>(statement.get())) {
-            okay = onStatement(circuit, *callStat);
-        } else if (auto const* uncallStat = dynamic_cast<UncallStatement*>(statement.get())) {
-            okay = onStatement(circuit, *uncallStat);
-        } else if (auto const* skipStat = statement.get()) {
-            okay = onStatement(*skipStat);
-        } else {
-            okay = false;
+        switch (statement->kind()) {
+            case Statement::Kind::Swap:
+                okay = onStatement(circuit, static_cast<const SwapStatement&>(*statement));
+                break;
+            case Statement::Kind::Unary:
+                okay = onStatement(circuit, static_cast<const UnaryStatement&>(*statement));
+                break;
+            case Statement::Kind::Assign:
+                okay = onStatement(circuit, static_cast<const AssignStatement&>(*statement));
+                break;
+            case Statement::Kind::If:
+                okay = onStatement(circuit, static_cast<const IfStatement&>(*statement));
+                break;
+            case Statement::Kind::For:
+                okay = onStatement(circuit, static_cast<const ForStatement&>(*statement));
+                break;
+            case Statement::Kind::Call: {
+                const auto& callStat = static_cast<const CallStatement&>(*statement);
+                okay                 = onStatement(circuit, callStat);
+                // The variables bound to the parameters of the called module may have been modified
+                if (eliminateCommonSubexpressions) {
+                    const auto parameterLines = getParameterLines(*callStat.target);
+                    invalidateCommonSubexpressions({parameterLines.cbegin(), parameterLines.cend()});
+                }
+                break;
+            }
+            case Statement::Kind::Uncall: {
+                const auto& uncallStat = static_cast<const UncallStatement&>(*statement);
+                okay                   = onStatement(circuit, uncallStat);
+                if (eliminateCommonSubexpressions) {
+                    const auto parameterLines = getParameterLines(*uncallStat.target);
+                    invalidateCommonSubexpressions({parameterLines.cbegin(), parameterLines.cend()});
+                }
+                break;
+            }
+            case Statement::Kind::Skip:
+                okay = onStatement(*statement);
+                break;
         }
 
         stmts.pop();
@@ -124,6 +254,8 @@ namespace syrec {
 
         assert(lhs.size() == rhs.size());
 
+        invalidateCommonSubexpressions(lhs);
+        invalidateCommonSubexpressions(rhs);
         return swap(circuit, lhs, rhs);
     }
 
@@ -132,6 +264,7 @@ namespace syrec {
         std::vector<unsigned> var;
         getVariables(statement.var, var);
 
+        invalidateCommonSubexpressions(var);
         switch (statement.op) {
             case UnaryStatement::Invert:
                 return bitwiseNegation(circuit, var);
@@ -152,7 +285,9 @@ namespace syrec {
         getVariables(statement.lhs, lhs);
         opRhsLhsExpression(statement.rhs, d);
 
-        bool synthesisOfAssignmentOk = SyrecSynthesis::onExpression(circuit, statement.rhs, rhs, lhs, statement.op);
+        Computation rhsComputation          = beginComputation(circuit);
+        bool        synthesisOfAssignmentOk = SyrecSynthesis::onExpression(circuit, statement.rhs, rhs, lhs, statement.op);
+        endComputation(circuit, rhsComputation);
         opVec.clear();
 
         switch (statement.op) {
@@ -171,6 +306,17 @@ namespace syrec {
             default:
                 return false;
         }
+        invalidateCommonSubexpressions(lhs);
+
+        // The lines storing the intermediate results of the right-hand side expression are no longer needed after the assignment
+        // and can be reused by later statements once the expression evaluation was reverted.
+        if (synthesisOfAssignmentOk && (recycleConstantLines || exceedsConstantLineBudget())) {
+            // Any constant line acquired after the evaluation of the right-hand side would also be released by the uncomputation
+            rhsComputation.acquiredConstantLinesEnd = acquiredConstantLines.size();
+            if (canUncompute(circuit, rhsComputation, {})) {
+                synthesisOfAssignmentOk = uncomputeAndReleaseConstantLines(circuit, rhsComputation);
+            }
+        }
         return synthesisOfAssignmentOk;
     }
 
@@ -201,6 +347,7 @@ namespace syrec {
         circuit.deregisterControlLineFromPropagationInCurrentScope(helperLine);
         circuit.createAndAddNotGate(helperLine);
         circuit.registerControlLineForPropagationInCurrentAndNestedScopes(helperLine);
+        invalidateCommonSubexpressions({helperLine});
 
         for (const Statement::ptr& stat: statement.elseStatements) {
             if (!processStatement(circuit, stat)) {
@@ -219,17 +366,29 @@ namespace syrec {
     bool SyrecSynthesis::onStatement(Circuit& circuit, const ForStatement& statement) {
         const auto& [nfrom, nTo] = statement.range;
 
-        const unsigned     from         = nfrom ? nfrom->evaluate(loopMap) : 1U; // default value is 1u
-        const unsigned     to           = nTo->evaluate(loopMap);
-        const unsigned     step         = statement.step ? statement.step->evaluate(loopMap) : 1U; // default step is +1
+        const unsigned     from         = nfrom ? nfrom->evaluate(loopVariableValues) : 1U; // default value is 1u
+        const unsigned     to           = nTo->evaluate(loopVariableValues);
+        const unsigned     step         = statement.step ? statement.step->evaluate(loopVariableValues) : 1U; // default step is +1
         const std::string& loopVariable = statement.loopVariable;
+        if (!loopVariable.empty() && statement.loopVariableSlot >= loopVariableValues.size()) {
+            loopVariableValues.resize(statement.loopVariableSlot + 1U);
+        }
+
+        // A loop of an (un)called module redefining the loop variable of the recorded template would be mistaken for the latter
+        if (loopBodyTemplateRecording.has_value() && !loopVariable.empty() && loopVariable == loopBodyTemplateRecording->loopVariable) {
+            loopBodyTemplateRecording->isInstantiable = false;
+        }
+
+        if (instantiateLoopBodyTemplates && step != 0U && !loopBodyTemplateRecording.has_value() && isLoopBodyTemplatable(statement)) {
+            return synthesizeForStatementUsingLoopBodyTemplate(circuit, statement, from, to, step);
+        }
 
         if (from <= to) {
             for (unsigned i = from; i <= to; i += step) {
                 // adjust loop variable if necessary
 
                 if (!loopVariable.empty()) {
-                    loopMap[loopVariable] = i;
+                    loopVariableValues[statement.loopVariableSlot] = i;
                 }
 
                 for (const auto& stat: statement.statements) {
@@ -245,7 +404,7 @@ namespace syrec {
                 // adjust loop variable if necessary
 
                 if (!loopVariable.empty()) {
-                    loopMap[loopVariable] = static_cast<unsigned>(i);
+                    loopVariableValues[statement.loopVariableSlot] = static_cast<unsigned>(i);
                 }
 
                 for (const auto& stat: statement.statements) {
@@ -255,11 +414,6 @@ namespace syrec {
                 }
             }
         }
-        // clear loop variable if necessary
-        if (!loopVariable.empty()) {
-            assert(loopMap.erase(loopVariable) == 1U);
-        }
-
         return true;
     }
 
@@ -272,9 +426,26 @@ namespace syrec {
             moduleParameter->setReference(modules.top()->findParameterOrVariable(parameter));
         }
 
+        ModuleSynthesisCacheKey cacheKey;
+        if (memoizeModuleSynthesis) {
+            cacheKey = createModuleSynthesisCacheKey(*statement.target, false);
+            if (const auto replayOk = replayCachedModuleSynthesis(circuit, cacheKey, *statement.target); replayOk.has_value()) {
+                return *replayOk;
+            }
+        }
+        const auto        freeConstLinesBegin          = memoizeModuleSynthesis ? freeConstLinesMap : std::map<bool, std::vector<unsigned>>();
+        const std::size_t linesBegin                   = circuit.getLines();
+        const std::size_t nRequestedConstantLinesBegin = nRequestedConstantLines;
+        const std::size_t nAddedConstantLinesBegin     = nAddedConstantLines;
+        Computation       moduleSynthesis              = beginComputation(circuit);
+
         // 2. Create new lines for the module's variables
         addVariables(circuit, statement.target->variables);
 
+        // The loop variables of the called module are bound to slots independent of the loop variables of the caller
+        Number::loop_variable_values loopVariableValuesOfCaller;
+        std::swap(loopVariableValues, loopVariableValuesOfCaller);
+
         modules.push(statement.target);
         for (const Statement::ptr& stat: statement.target->statements) {
             if (!processStatement(circuit, stat)) {
@@ -282,7 +453,15 @@ namespace syrec {
             }
         }
         modules.pop();
+        loopVariableValues = std::move(loopVariableValuesOfCaller);
 
+        if (memoizeModuleSynthesis) {
+            endComputation(circuit, moduleSynthesis);
+            cacheModuleSynthesis(circuit, cacheKey, *statement.target, moduleSynthesis, freeConstLinesBegin, linesBegin, nRequestedConstantLinesBegin, nAddedConstantLinesBegin);
+            if (hierarchy != nullptr) {
+                return outlineModuleSynthesis(circuit, cacheKey, *statement.target, moduleSynthesis, linesBegin);
+            }
+        }
         return true;
     }
 
@@ -295,9 +474,25 @@ namespace syrec {
             moduleParameter->setReference(modules.top()->findParameterOrVariable(parameter));
         }
 
+        ModuleSynthesisCacheKey cacheKey;
+        if (memoizeModuleSynthesis) {
+            cacheKey = createModuleSynthesisCacheKey(*statement.target, true);
+            if (const auto replayOk = replayCachedModuleSynthesis(circuit, cacheKey, *statement.target); replayOk.has_value()) {
+                return *replayOk;
+            }
+        }
+        const auto        freeConstLinesBegin          = memoizeModuleSynthesis ? freeConstLinesMap : std::map<bool, std::vector<unsigned>>();
+        const std::size_t linesBegin                   = circuit.getLines();
+        const std::size_t nRequestedConstantLinesBegin = nRequestedConstantLines;
+        const std::size_t nAddedConstantLinesBegin     = nAddedConstantLines;
+        Computation       moduleSynthesis              = beginComputation(circuit);
+
         // 2. Create new lines for the module's variables
         addVariables(circuit, statement.target->variables);
 
+        Number::loop_variable_values loopVariableValuesOfCaller;
+        std::swap(loopVariableValues, loopVariableValuesOfCaller);
+
         modules.push(statement.target);
 
         const auto statements = statement.target->statements;
@@ -309,7 +504,15 @@ namespace syrec {
         }
 
         modules.pop();
+        loopVariableValues = std::move(loopVariableValuesOfCaller);
 
+        if (memoizeModuleSynthesis) {
+            endComputation(circuit, moduleSynthesis);
+            cacheModuleSynthesis(circuit, cacheKey, *statement.target, moduleSynthesis, freeConstLinesBegin, linesBegin, nRequestedConstantLinesBegin, nAddedConstantLinesBegin);
+            if (hierarchy != nullptr) {
+                return outlineModuleSynthesis(circuit, cacheKey, *statement.target, moduleSynthesis, linesBegin);
+            }
+        }
         return true;
     }
 
@@ -318,42 +521,60 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::onExpression(Circuit& circuit, const Expression::ptr& expression, std::vector<unsigned>& lines, std::vector<unsigned> const& lhsStat, unsigned op) {
-        if (auto const* numeric = dynamic_cast<NumericExpression*>(expression.get())) {
-            return onExpression(circuit, *numeric, lines);
-        }
-        if (auto const* variable = dynamic_cast<VariableExpression*>(expression.get())) {
-            return onExpression(*variable, lines);
-        }
-        if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
-            return onExpression(circuit, *binary, lines, lhsStat, op);
-        }
-        if (auto const* shift = dynamic_cast<ShiftExpression*>(expression.get())) {
-            return onExpression(circuit, *shift, lines, lhsStat, op);
+        switch (expression->kind()) {
+            case Expression::Kind::Numeric:
+                return onExpression(circuit, static_cast<const NumericExpression&>(*expression), lines);
+            case Expression::Kind::Variable:
+                return onExpression(static_cast<const VariableExpression&>(*expression), lines);
+            case Expression::Kind::Binary:
+                return onExpression(circuit, static_cast<const BinaryExpression&>(*expression), lines, lhsStat, op);
+            case Expression::Kind::Shift:
+                return onExpression(circuit, static_cast<const ShiftExpression&>(*expression), lines, lhsStat, op);
         }
         return false;
     }
 
     bool SyrecSynthesis::onExpression(Circuit& circuit, const ShiftExpression& expression, std::vector<unsigned>& lines, std::vector<unsigned> const& lhsStat, unsigned op) {
         std::vector<unsigned> lhs;
+        Computation           lhsComputation = beginComputation(circuit);
         if (!onExpression(circuit, expression.lhs, lhs, lhsStat, op)) {
             return false;
         }
+        endComputation(circuit, lhsComputation);
 
-        const unsigned rhs = expression.rhs->evaluate(loopMap);
+        const unsigned               rhs = expression.rhs->evaluate(loopVariableValues);
+        const CommonSubexpressionKey key = {SubexpressionKind::Shift, expression.op, expression.bitwidth(), rhs, lhs, {}};
+        if (reuseCommonSubexpression(circuit, key, lines)) {
+            return true;
+        }
+
+        bool synthesisOfExprOk = true;
         switch (expression.op) {
             case ShiftExpression::Left: // <<
                 getConstantLines(circuit, expression.bitwidth(), 0U, lines);
-                return leftShift(circuit, lines, lhs, rhs);
+                synthesisOfExprOk = leftShift(circuit, lines, lhs, rhs);
+                break;
             case ShiftExpression::Right: // <<
                 getConstantLines(circuit, expression.bitwidth(), 0U, lines);
-                return rightShift(circuit, lines, lhs, rhs);
+                synthesisOfExprOk = rightShift(circuit, lines, lhs, rhs);
+                break;
             default:
                 return false;
         }
+        if (synthesisOfExprOk) {
+            recordCommonSubexpression(circuit, key, lines);
+        }
+        return synthesisOfExprOk && uncomputeOperandsExceedingConstantLineBudget(circuit, {lhsComputation}, lines);
     }
 
     bool SyrecSynthesis::onExpression(Circuit& circuit, const NumericExpression& expression, std::vector<unsigned>& lines) {
-        getConstantLines(circuit, expression.bitwidth(), expression.value->evaluate(loopMap), lines);
+        const unsigned               value = expression.value->evaluate(loopVariableValues);
+        const CommonSubexpressionKey key   = {SubexpressionKind::Numeric, 0U, expression.bitwidth(), value, {}, {}};
+        if (reuseCommonSubexpression(circuit, key, lines)) {
+            return true;
+        }
+        getConstantLines(circuit, expression.bitwidth(), value, lines);
+        recordCommonSubexpression(circuit, key, lines);
         return true;
     }
 
@@ -366,13 +587,37 @@ namespace syrec {
         std::vector<unsigned> lhs;
         std::vector<unsigned> rhs;
 
-        if (!onExpression(circuit, expression.lhs, lhs, lhsStat, op) || !onExpression(circuit, expression.rhs, rhs, lhsStat, op)) {
+        Computation lhsComputation = beginComputation(circuit);
+        if (!onExpression(circuit, expression.lhs, lhs, lhsStat, op)) {
+            return false;
+        }
+        endComputation(circuit, lhsComputation);
+
+        // The operations assume that the lines of both operands are distinct, thus the lines of the left operand may not be reused as the right operand
+        const std::size_t nLinesOfPendingOperands = linesOfPendingOperands.size();
+        if (eliminateCommonSubexpressions) {
+            linesOfPendingOperands.insert(linesOfPendingOperands.end(), lhs.cbegin(), lhs.cend());
+        }
+        Computation rhsComputation   = beginComputation(circuit);
+        const bool  synthesisOfRhsOk = onExpression(circuit, expression.rhs, rhs, lhsStat, op);
+        linesOfPendingOperands.resize(nLinesOfPendingOperands);
+        if (!synthesisOfRhsOk) {
             return false;
         }
+        endComputation(circuit, rhsComputation);
+
+        // The operands of commutative operations are ordered to also reuse the result of the expression with swapped operands
+        const bool             isCommutative      = expression.op == BinaryExpression::Add || expression.op == BinaryExpression::Exor || expression.op == BinaryExpression::Multiply || expression.op == BinaryExpression::LogicalAnd || expression.op == BinaryExpression::LogicalOr || expression.op == BinaryExpression::BitwiseAnd || expression.op == BinaryExpression::BitwiseOr || expression.op == BinaryExpression::Equals || expression.op == BinaryExpression::NotEquals;
+        const bool             areOperandsSwapped = isCommutative && rhs < lhs;
+        CommonSubexpressionKey key                = {SubexpressionKind::Binary, expression.op, expression.bitwidth(), 0U, areOperandsSwapped ? rhs : lhs, areOperandsSwapped ? lhs : rhs};
+        if (reuseCommonSubexpression(circuit, key, lines)) {
+            return true;
+        }
 
         expLhss.push(lhs);
         expRhss.push(rhs);
         expOpp.push(expression.op);
+        expGateRanges.push(circuit.beginGateRange());
 
         if ((expOpp.size() == opVec.size()) && (expOpp.top() == op)) {
             return true;
@@ -448,8 +693,19 @@ namespace syrec {
             default:
                 return false;
         }
+        circuit.endGateRange(expGateRanges.top());
 
-        return synthesisOfExprOk;
+        // The division modifies both of its operands while the modulo operation modifies its right operand, thus the result of both operations cannot be reused
+        if (expression.op == BinaryExpression::Divide || expression.op == BinaryExpression::Modulo) {
+            invalidateCommonSubexpressions(rhs);
+            if (expression.op == BinaryExpression::Divide) {
+                invalidateCommonSubexpressions(lhs);
+            }
+        } else if (synthesisOfExprOk) {
+            recordCommonSubexpression(circuit, key, lines);
+        }
+
+        return synthesisOfExprOk && uncomputeOperandsExceedingConstantLineBudget(circuit, {lhsComputation, rhsComputation}, lines);
     }
 
     /// Function when the assignment statements consist of binary expressions and does not include repeated input signals
@@ -874,34 +1130,41 @@ namespace syrec {
         return true;
     }
 
-    bool SyrecSynthesis::expressionOpInverse([[maybe_unused]] Circuit& circuit, [[maybe_unused]] unsigned op, [[maybe_unused]] const std::vector<unsigned>& expLhs, [[maybe_unused]] const std::vector<unsigned>& expRhs) const {
-        return true;
-    }
-
     void SyrecSynthesis::getVariables(const VariableAccess::ptr& var, std::vector<unsigned>& lines) {
         const auto&       referenceVariableData           = var->getVar();
         unsigned          offset                          = varLines[referenceVariableData];
         const std::size_t numDeclaredDimensionsOfVariable = referenceVariableData->dimensions.size();
+        const std::size_t numLinesBefore                  = lines.size();
+        // The change of the accessed lines per increment of the loop variable whose loop body template is currently recorded
+        std::ptrdiff_t lineOffsetPerLoopVariableIncrement = 0;
 
         if (!var->indexes.empty()) {
             // check if it is all numeric_expressions
-            if (static_cast<std::size_t>(std::count_if(var->indexes.cbegin(), var->indexes.cend(), [&](const auto& p) { return dynamic_cast<NumericExpression*>(p.get()); })) == numDeclaredDimensionsOfVariable) {
+            if (static_cast<std::size_t>(std::count_if(var->indexes.cbegin(), var->indexes.cend(), [&](const auto& p) { return p->kind() == Expression::Kind::Numeric; })) == numDeclaredDimensionsOfVariable) {
                 for (std::size_t i = 0U; i < numDeclaredDimensionsOfVariable; ++i) {
-                    const auto   evaluatedDimensionIndexValue = dynamic_cast<NumericExpression*>(var->indexes.at(i).get())->value->evaluate(loopMap);
-                    unsigned int aggregateValue               = evaluatedDimensionIndexValue;
+                    const auto&  dimensionIndex               = static_cast<const NumericExpression&>(*var->indexes.at(i)).value;
+                    const auto   evaluatedDimensionIndexValue = dimensionIndex->evaluate(loopVariableValues);
+                    unsigned int aggregateFactor              = 1U;
                     for (std::size_t j = i + 1; j < numDeclaredDimensionsOfVariable; ++j) {
-                        aggregateValue *= referenceVariableData->dimensions[i];
+                        aggregateFactor *= referenceVariableData->dimensions[i];
+                    }
+                    offset += evaluatedDimensionIndexValue * aggregateFactor * referenceVariableData->bitwidth;
+                    if (loopBodyTemplateRecording.has_value() && isLoopVariable(*dimensionIndex, loopBodyTemplateRecording->loopVariable)) {
+                        lineOffsetPerLoopVariableIncrement += static_cast<std::ptrdiff_t>(aggregateFactor) * static_cast<std::ptrdiff_t>(referenceVariableData->bitwidth);
                     }
-                    offset += aggregateValue * referenceVariableData->bitwidth;
                 }
             }
         }
 
         if (var->range) {
             auto [nfirst, nsecond] = *var->range;
+            // A bit range depending on the loop variable is only templatable if it accesses a single bit
+            if (loopBodyTemplateRecording.has_value() && isLoopVariable(*nfirst, loopBodyTemplateRecording->loopVariable)) {
+                ++lineOffsetPerLoopVariableIncrement;
+            }
 
-            const unsigned first  = nfirst->evaluate(loopMap);
-            const unsigned second = nsecond->evaluate(loopMap);
+            const unsigned first  = nfirst->evaluate(loopVariableValues);
+            const unsigned second = nsecond->evaluate(loopVariableValues);
 
             if (first < second) {
                 for (unsigned i = first; i <= second; ++i) {
@@ -917,10 +1180,17 @@ namespace syrec {
                 lines.emplace_back(offset + i);
             }
         }
+
+        if (loopBodyTemplateRecording.has_value()) {
+            for (std::size_t i = numLinesBefore; i < lines.size(); ++i) {
+                recordLineOfLoopBodyTemplate(lines[i], lineOffsetPerLoopVariableIncrement);
+            }
+        }
     }
 
     unsigned SyrecSynthesis::getConstantLine(Circuit& circuit, bool value) {
-        unsigned constLine = 0U;
+        unsigned constLine        = 0U;
+        bool     valueOfConstLine = value;
 
         if (!freeConstLinesMap[value].empty()) {
             constLine = freeConstLinesMap[value].back();
@@ -928,11 +1198,17 @@ namespace syrec {
         } else if (!freeConstLinesMap[!value].empty()) {
             constLine = freeConstLinesMap[!value].back();
             freeConstLinesMap[!value].pop_back();
+            valueOfConstLine = !value;
             circuit.createAndAddNotGate(constLine);
         } else {
             constLine = circuit.addLine((std::string("const_") + std::to_string(static_cast<int>(value))), "garbage", value, true);
+            ++nAddedConstantLines;
         }
 
+        ++nRequestedConstantLines;
+        if (recycleConstantLines || constantLineBudget.has_value()) {
+            acquiredConstantLines.emplace_back(constLine, valueOfConstLine);
+        }
         return constLine;
     }
 
@@ -943,21 +1219,591 @@ namespace syrec {
         }
     }
 
-    void SyrecSynthesis::addVariable(Circuit& circ, const std::vector<unsigned>& dimensions, const Variable::ptr& var,
-                                     const constant constant, bool garbage, const std::string& arraystr) {
-        if (dimensions.empty()) {
-            for (unsigned i = 0U; i < var->bitwidth; ++i) {
-                const std::string name = var->name + arraystr + "." + std::to_string(i);
-                circ.addLine(name, name, constant, garbage);
+    SyrecSynthesis::Computation SyrecSynthesis::beginComputation(const Circuit& circuit) const {
+        Computation computation;
+        computation.gates                      = circuit.beginGateRange();
+        computation.acquiredConstantLinesBegin = acquiredConstantLines.size();
+        computation.acquiredConstantLinesEnd   = computation.acquiredConstantLinesBegin;
+        computation.instancesBegin             = hierarchy != nullptr ? hierarchy->getDefinition(HierarchicalCircuit::TOP_LEVEL_DEFINITION).instances.size() : 0U;
+        return computation;
+    }
+
+    void SyrecSynthesis::endComputation(const Circuit& circuit, Computation& computation) const {
+        circuit.endGateRange(computation.gates);
+        computation.acquiredConstantLinesEnd = acquiredConstantLines.size();
+    }
+
+    bool SyrecSynthesis::canUncompute(const Circuit& circuit, const Computation& computation, const std::vector<unsigned>& linesToKeep) const {
+        Gate::LinesLookup linesOfComputation;
+        for (std::size_t i = computation.acquiredConstantLinesBegin; i < computation.acquiredConstantLinesEnd; ++i) {
+            const unsigned constLine = acquiredConstantLines[i].first;
+            if (std::find(linesToKeep.cbegin(), linesToKeep.cend(), constLine) != linesToKeep.cend()) {
+                return false;
+            }
+            linesOfComputation.emplace(constLine);
+        }
+
+        auto gateIt = std::next(circuit.cbegin(), static_cast<std::ptrdiff_t>(computation.gates.begin));
+        for (std::size_t i = computation.gates.begin; i < computation.gates.end; ++i, ++gateIt) {
+            linesOfComputation.insert((*gateIt)->controls.cbegin(), (*gateIt)->controls.cend());
+            linesOfComputation.insert((*gateIt)->targets.cbegin(), (*gateIt)->targets.cend());
+        }
+
+        // The inverse of the computation can only be appended if the values of the lines used by the computation were not changed afterward
+        return std::none_of(gateIt, circuit.cend(), [&linesOfComputation](const Gate::ptr& gate) {
+            return std::any_of(gate->targets.cbegin(), gate->targets.cend(), [&linesOfComputation](const Gate::Line targetLine) { return linesOfComputation.count(targetLine) != 0; });
+        });
+    }
+
+    bool SyrecSynthesis::uncomputeAndReleaseConstantLines(Circuit& circuit, const Computation& computation) {
+        if (!circuit.appendInverseOfGateRange(circuit, computation.gates)) {
+            return false;
+        }
+
+        const auto releasedConstantLinesBegin = std::next(acquiredConstantLines.begin(), static_cast<std::ptrdiff_t>(computation.acquiredConstantLinesBegin));
+        const auto releasedConstantLinesEnd   = std::next(acquiredConstantLines.begin(), static_cast<std::ptrdiff_t>(computation.acquiredConstantLinesEnd));
+        for (auto it = releasedConstantLinesBegin; it != releasedConstantLinesEnd; ++it) {
+            const auto [constLine, valueOfConstLine] = *it;
+            freeConstLinesMap[valueOfConstLine].emplace_back(constLine);
+        }
+        acquiredConstantLines.erase(releasedConstantLinesBegin, releasedConstantLinesEnd);
+        return true;
+    }
+
+    bool SyrecSynthesis::uncomputeOperandsExceedingConstantLineBudget(Circuit& circuit, const std::vector<Computation>& operandComputations, const std::vector<unsigned>& result) {
+        // The operands are uncomputed in the reverse order of their computation so that the bookkeeping of the acquired constant lines of the not yet uncomputed operands remains valid
+        for (auto it = operandComputations.crbegin(); it != operandComputations.crend() && exceedsConstantLineBudget(); ++it) {
+            if (it->acquiredConstantLinesBegin == it->acquiredConstantLinesEnd || !canUncompute(circuit, *it, result)) {
+                continue;
+            }
+            if (!uncomputeAndReleaseConstantLines(circuit, *it)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SyrecSynthesis::reuseCommonSubexpression(const Circuit& circuit, const CommonSubexpressionKey& key, std::vector<unsigned>& lines) {
+        if (!eliminateCommonSubexpressions || loopBodyTemplateRecording.has_value()) {
+            return false;
+        }
+
+        const auto recordedSubexpression = commonSubexpressions.find(key);
+        if (recordedSubexpression == commonSubexpressions.cend()) {
+            return false;
+        }
+
+        const auto& [resultLines, propagatedControlLines, versionsOfUsedLines] = recordedSubexpression->second;
+        const auto& currentPropagatedControlLines                              = circuit.getPropagatedControlLines();
+        if (!std::includes(currentPropagatedControlLines.cbegin(), currentPropagatedControlLines.cend(), propagatedControlLines.cbegin(), propagatedControlLines.cend())) {
+            return false;
+        }
+        const bool wasAnyUsedLineModified = std::any_of(versionsOfUsedLines.cbegin(), versionsOfUsedLines.cend(), [&](const std::pair<unsigned, std::size_t>& versionOfUsedLine) {
+            return versionOfUsedLine.first >= lineVersions.size() ? versionOfUsedLine.second != 0 : lineVersions[versionOfUsedLine.first] != versionOfUsedLine.second;
+        });
+        const bool overlapsPendingOperand = std::any_of(resultLines.cbegin(), resultLines.cend(), [&](const unsigned line) {
+            return std::find(linesOfPendingOperands.cbegin(), linesOfPendingOperands.cend(), line) != linesOfPendingOperands.cend();
+        });
+        if (wasAnyUsedLineModified || overlapsPendingOperand) {
+            return false;
+        }
+
+        lines.insert(lines.end(), resultLines.cbegin(), resultLines.cend());
+        ++nReusedSubexpressions;
+        return true;
+    }
+
+    void SyrecSynthesis::recordCommonSubexpression(const Circuit& circuit, const CommonSubexpressionKey& key, const std::vector<unsigned>& lines) {
+        if (!eliminateCommonSubexpressions) {
+            return;
+        }
+
+        CommonSubexpression subexpression;
+        subexpression.lines                  = lines;
+        subexpression.propagatedControlLines = circuit.getPropagatedControlLines();
+
+        Gate::LinesLookup usedLines(lines.cbegin(), lines.cend());
+        usedLines.insert(std::get<4>(key).cbegin(), std::get<4>(key).cend());
+        usedLines.insert(std::get<5>(key).cbegin(), std::get<5>(key).cend());
+        usedLines.insert(subexpression.propagatedControlLines.cbegin(), subexpression.propagatedControlLines.cend());
+        for (const auto usedLine: usedLines) {
+            subexpression.versionsOfUsedLines.emplace_back(static_cast<unsigned>(usedLine), usedLine < lineVersions.size() ? lineVersions[usedLine] : 0U);
+        }
+        commonSubexpressions.insert_or_assign(key, std::move(subexpression));
+    }
+
+    void SyrecSynthesis::invalidateCommonSubexpressions(const std::vector<unsigned>& modifiedLines) {
+        if (!eliminateCommonSubexpressions) {
+            return;
+        }
+
+        for (const auto modifiedLine: modifiedLines) {
+            if (modifiedLine >= lineVersions.size()) {
+                lineVersions.resize(static_cast<std::size_t>(modifiedLine) + 1U, 0U);
+            }
+            ++lineVersions[modifiedLine];
+        }
+    }
+
+    SyrecSynthesis::ModuleSynthesisCacheKey SyrecSynthesis::createModuleSynthesisCacheKey(const Module& module, const bool isUncall) const {
+        std::vector<Variable::ptr> referencedVariables;
+        std::vector<unsigned>      parameterBindings;
+        for (const auto& parameter: module.parameters) {
+            const auto& referencedVariable  = parameter->reference ? parameter->reference : parameter;
+            const auto  aliasedParameterIdx = std::distance(referencedVariables.cbegin(), std::find(referencedVariables.cbegin(), referencedVariables.cend(), referencedVariable));
+            referencedVariables.emplace_back(referencedVariable);
+
+            parameterBindings.emplace_back(static_cast<unsigned>(aliasedParameterIdx));
+            parameterBindings.emplace_back(referencedVariable->bitwidth);
+            parameterBindings.emplace_back(static_cast<unsigned>(referencedVariable->dimensions.size()));
+            parameterBindings.insert(parameterBindings.end(), referencedVariable->dimensions.cbegin(), referencedVariable->dimensions.cend());
+        }
+        return {&module, isUncall, parameterBindings};
+    }
+
+    std::vector<Gate::Line> SyrecSynthesis::getParameterLines(const Module& module) {
+        std::vector<Gate::Line> parameterLines;
+        for (const auto& parameter: module.parameters) {
+            const auto& referencedVariable = parameter->reference ? parameter->reference : parameter;
+            std::size_t nLinesOfVariable   = referencedVariable->bitwidth;
+            for (const auto dimension: referencedVariable->dimensions) {
+                nLinesOfVariable *= dimension;
+            }
+
+            const unsigned firstLineOfVariable = varLines[referencedVariable];
+            for (std::size_t i = 0; i < nLinesOfVariable; ++i) {
+                parameterLines.emplace_back(firstLineOfVariable + i);
+            }
+        }
+        return parameterLines;
+    }
+
+    void SyrecSynthesis::cacheModuleSynthesis(const Circuit& circuit, const ModuleSynthesisCacheKey& cacheKey, const Module& module, const Computation& synthesis, const std::map<bool, std::vector<unsigned>>& freeConstLinesBegin, const std::size_t linesBegin, const std::size_t nRequestedConstantLinesBegin, const std::size_t nAddedConstantLinesBegin) {
+        // Unlike a replay, which adds new lines for the local variables, a synthesis of a later (un)call uses the lines of the local variables of the first (un)call
+        if (std::set<const Module*> visitedModules; usesLocalVariables(module, visitedModules)) {
+            return;
+        }
+        const std::vector<Gate::Line> parameterLines = getParameterLines(module);
+
+        std::map<Gate::Line, Gate::Line> cachedLineOfCircuitLine;
+        for (std::size_t i = 0; i < parameterLines.size(); ++i) {
+            // Lines of aliased parameters are mapped to the lines of the first parameter referencing the same variable
+            cachedLineOfCircuitLine.try_emplace(parameterLines[i], i);
+        }
+        for (std::size_t line = linesBegin; line < circuit.getLines(); ++line) {
+            cachedLineOfCircuitLine.try_emplace(line, parameterLines.size() + (line - linesBegin));
+        }
+
+        // A propagated control line that is also bound to a module parameter (e.g. the condition of an if statement passed to the (un)call) cannot be told apart
+        // from the controls of the gates of the module and would thus become a control of every replayed gate
+        const auto& propagatedControlLines = circuit.getPropagatedControlLines();
+        if (std::any_of(propagatedControlLines.cbegin(), propagatedControlLines.cend(), [&](const Gate::Line line) { return cachedLineOfCircuitLine.count(line) != 0; })) {
+            return;
+        }
+
+        CachedModuleSynthesis cachedSynthesis;
+        for (const auto& [valueOfConstLines, freeConstLines]: freeConstLinesMap) {
+            // The free constant lines available prior to the synthesis must not have been used since the replay of the synthesis would not reuse them
+            const auto        freeConstLinesBeforeSynthesis  = freeConstLinesBegin.find(valueOfConstLines);
+            const std::size_t nFreeConstLinesBeforeSynthesis = freeConstLinesBeforeSynthesis != freeConstLinesBegin.cend() ? freeConstLinesBeforeSynthesis->second.size() : 0;
+            if (freeConstLines.size() < nFreeConstLinesBeforeSynthesis || (nFreeConstLinesBeforeSynthesis > 0 && !std::equal(freeConstLinesBeforeSynthesis->second.cbegin(), freeConstLinesBeforeSynthesis->second.cend(), freeConstLines.cbegin()))) {
+                return;
+            }
+
+            auto& releasedConstLines = cachedSynthesis.releasedConstLines[valueOfConstLines];
+            for (auto releasedConstLine = std::next(freeConstLines.cbegin(), static_cast<std::ptrdiff_t>(nFreeConstLinesBeforeSynthesis)); releasedConstLine != freeConstLines.cend(); ++releasedConstLine) {
+                const auto cachedLine = cachedLineOfCircuitLine.find(*releasedConstLine);
+                if (cachedLine == cachedLineOfCircuitLine.cend()) {
+                    return;
+                }
+                releasedConstLines.emplace_back(cachedLine->second);
+            }
+        }
+        cachedSynthesis.globalGateAnnotations   = circuit.getGlobalGateAnnotations();
+        cachedSynthesis.nParameterLines         = parameterLines.size();
+        cachedSynthesis.nRequestedConstantLines = nRequestedConstantLines - nRequestedConstantLinesBegin;
+        cachedSynthesis.nAddedConstantLines     = nAddedConstantLines - nAddedConstantLinesBegin;
+        cachedSynthesis.gates.setLines(static_cast<unsigned>(parameterLines.size() + (circuit.getLines() - linesBegin)));
+
+        std::vector<std::string> inputs(parameterLines.size());
+        std::vector<std::string> outputs(parameterLines.size());
+        std::vector<constant>    constants(parameterLines.size());
+        std::vector<bool>        garbage(parameterLines.size());
+        for (std::size_t line = linesBegin; line < circuit.getLines(); ++line) {
+            inputs.emplace_back(circuit.getInput(line));
+            outputs.emplace_back(circuit.getOutput(line));
+        }
+        constants.insert(constants.end(), std::next(circuit.getConstants().cbegin(), static_cast<std::ptrdiff_t>(linesBegin)), circuit.getConstants().cend());
+        garbage.insert(garbage.end(), std::next(circuit.getGarbage().cbegin(), static_cast<std::ptrdiff_t>(linesBegin)), circuit.getGarbage().cend());
+        cachedSynthesis.gates.setInputs(inputs);
+        cachedSynthesis.gates.setOutputs(outputs);
+        cachedSynthesis.gates.setConstants(constants);
+        cachedSynthesis.gates.setGarbage(garbage);
+
+        auto gateIt = std::next(circuit.cbegin(), static_cast<std::ptrdiff_t>(synthesis.gates.begin));
+        for (std::size_t i = synthesis.gates.begin; i < synthesis.gates.end; ++i, ++gateIt) {
+            const auto& gate = **gateIt;
+            Gate        cachedGate;
+            cachedGate.type = gate.type;
+            for (const auto controlLine: gate.controls) {
+                if (const auto cachedLine = cachedLineOfCircuitLine.find(controlLine); cachedLine != cachedLineOfCircuitLine.cend()) {
+                    cachedGate.controls.emplace(cachedLine->second);
+                } else if (propagatedControlLines.count(controlLine) == 0) {
+                    return;
+                }
+            }
+            for (const auto targetLine: gate.targets) {
+                const auto cachedLine = cachedLineOfCircuitLine.find(targetLine);
+                if (cachedLine == cachedLineOfCircuitLine.cend()) {
+                    return;
+                }
+                cachedGate.targets.emplace(cachedLine->second);
+            }
+
+            const auto cachedGateCopy = cachedSynthesis.gates.createAndAddGateCopy(cachedGate);
+            if (cachedGateCopy == nullptr) {
+                return;
+            }
+            if (const auto& gateAnnotations = circuit.getAnnotations(gate); gateAnnotations.has_value()) {
+                for (const auto& [annotationKey, annotationValue]: *gateAnnotations) {
+                    cachedSynthesis.gates.annotate(*cachedGateCopy, annotationKey, annotationValue);
+                }
+            }
+        }
+
+        if (hierarchy != nullptr) {
+            // The module instances created during the synthesis of the (un)call become instances of the definition of the cached synthesis
+            std::vector<std::pair<std::size_t, HierarchicalCircuit::Instance>> cachedInstances;
+            const auto&                                                        instancesOfCircuit = hierarchy->getDefinition(HierarchicalCircuit::TOP_LEVEL_DEFINITION).instances;
+            for (auto instanceIt = std::next(instancesOfCircuit.cbegin(), static_cast<std::ptrdiff_t>(synthesis.instancesBegin)); instanceIt != instancesOfCircuit.cend(); ++instanceIt) {
+                const auto& [nPrecedingGates, instance] = *instanceIt;
+
+                HierarchicalCircuit::Instance cachedInstance;
+                cachedInstance.definition = instance.definition;
+                cachedInstance.isInverted = instance.isInverted;
+                for (const auto line: instance.lineMapping) {
+                    const auto cachedLine = cachedLineOfCircuitLine.find(line);
+                    if (cachedLine == cachedLineOfCircuitLine.cend()) {
+                        return;
+                    }
+                    cachedInstance.lineMapping.emplace_back(cachedLine->second);
+                }
+                for (const auto controlLine: instance.controls) {
+                    if (const auto cachedLine = cachedLineOfCircuitLine.find(controlLine); cachedLine != cachedLineOfCircuitLine.cend()) {
+                        cachedInstance.controls.emplace(cachedLine->second);
+                    } else if (propagatedControlLines.count(controlLine) == 0) {
+                        return;
+                    }
+                }
+                cachedInstances.emplace_back(nPrecedingGates - synthesis.gates.begin, std::move(cachedInstance));
+            }
+
+            const auto definition = hierarchy->addDefinition(module.name, std::move(cachedSynthesis.gates), std::move(cachedInstances));
+            if (!definition.has_value()) {
+                return;
+            }
+            cachedSynthesis.gates      = Circuit();
+            cachedSynthesis.definition = *definition;
+        }
+        moduleSynthesisCache->entries.insert_or_assign(cacheKey, std::move(cachedSynthesis));
+    }
+
+    void SyrecSynthesis::ModuleSynthesisCache::retainModules(const std::set<const Module*>& modules) {
+        for (auto cachedSynthesis = entries.begin(); cachedSynthesis != entries.end();) {
+            if (modules.count(std::get<0>(cachedSynthesis->first)) == 0) {
+                cachedSynthesis = entries.erase(cachedSynthesis);
+            } else {
+                ++cachedSynthesis;
+            }
+        }
+    }
+
+    bool SyrecSynthesis::isUncallInverseOfCall(const Module& module) {
+        // The reversal of if and for statements does not reverse the nested statements
+        return std::all_of(module.statements.cbegin(), module.statements.cend(), [](const Statement::ptr& statement) {
+            switch (statement->kind()) {
+                case Statement::Kind::Swap:
+                case Statement::Kind::Unary:
+                case Statement::Kind::Assign:
+                    return true;
+                case Statement::Kind::Call:
+                    return isUncallInverseOfCall(*static_cast<const CallStatement&>(*statement).target);
+                case Statement::Kind::Uncall:
+                    return isUncallInverseOfCall(*static_cast<const UncallStatement&>(*statement).target);
+                default:
+                    return false;
+            }
+        });
+    }
+
+    std::optional<bool> SyrecSynthesis::replayCachedModuleSynthesis(Circuit& circuit, const ModuleSynthesisCacheKey& cacheKey, const Module& module) {
+        bool replayInReverseOrder = false;
+        auto cachedSynthesis      = moduleSynthesisCache->entries.find(cacheKey);
+        if (cachedSynthesis == moduleSynthesisCache->entries.end()) {
+            if (!supportsInverseReplayOfModuleSynthesis() || !isUncallInverseOfCall(module)) {
+                return std::nullopt;
+            }
+            // The synthesis of the opposite direction can only be inverted if it did not require any additional lines whose values would need to be restored
+            const ModuleSynthesisCacheKey cacheKeyOfOppositeDirection = {std::get<0>(cacheKey), !std::get<1>(cacheKey), std::get<2>(cacheKey)};
+            cachedSynthesis                                           = moduleSynthesisCache->entries.find(cacheKeyOfOppositeDirection);
+            if (cachedSynthesis == moduleSynthesisCache->entries.end() || cachedSynthesis->second.gates.getLines() != cachedSynthesis->second.nParameterLines) {
+                return std::nullopt;
+            }
+            replayInReverseOrder = true;
+        }
+
+        const auto& cachedGates = getCachedGates(cachedSynthesis->second);
+        auto        lineMapping = getParameterLines(module);
+        if (lineMapping.size() != cachedSynthesis->second.nParameterLines) {
+            return false;
+        }
+        // The lines of the variables bound to the module parameters are not determined by getVariables(...) when replaying the synthesis and thus need to be recorded explicitly
+        if (loopBodyTemplateRecording.has_value()) {
+            for (const auto parameterLine: lineMapping) {
+                recordLineOfLoopBodyTemplate(parameterLine, 0);
+            }
+        }
+        for (std::size_t line = lineMapping.size(); line < cachedGates.getLines(); ++line) {
+            lineMapping.emplace_back(circuit.addLineCopy(cachedGates, line));
+        }
+        nRequestedConstantLines += cachedSynthesis->second.nRequestedConstantLines;
+        nAddedConstantLines += cachedSynthesis->second.nAddedConstantLines;
+        ++nReplayedModuleSyntheses;
+
+        if (const auto& definition = cachedSynthesis->second.definition; definition.has_value()) {
+            // The gates of the definition only need to be copied if any of the propagated control lines is used by the instance
+            HierarchicalCircuit::Instance instance{*definition, lineMapping, replayInReverseOrder, circuit.getPropagatedControlLines()};
+            if (!hierarchy->addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, instance)) {
+                instance.controls.clear();
+                if (!hierarchy->appendFlattenedInstance(circuit, instance)) {
+                    return false;
+                }
+            }
+            if (replayInReverseOrder) {
+                return true;
             }
         } else {
-            const unsigned              len = dimensions.front();
-            const std::vector<unsigned> newDimensions(dimensions.begin() + 1U, dimensions.end());
+            const Circuit::GateRange allCachedGates = {0, cachedGates.numGates()};
+            if (replayInReverseOrder) {
+                // The gates of the inverted synthesis are only annotated with the global gate annotations of the (un)call since the annotations of the cached gates refer to the statements of the opposite direction
+                return circuit.appendInverseOfGateRange(cachedGates, allCachedGates, lineMapping);
+            }
+            if (!circuit.appendGateRange(cachedGates, allCachedGates, lineMapping)) {
+                return false;
+            }
+        }
+        for (const auto& [valueOfConstLines, releasedConstLines]: cachedSynthesis->second.releasedConstLines) {
+            for (const auto releasedConstLine: releasedConstLines) {
+                freeConstLinesMap[valueOfConstLines].emplace_back(lineMapping[releasedConstLine]);
+            }
+        }
+        for (const auto& [annotationKey, annotationValue]: cachedSynthesis->second.globalGateAnnotations) {
+            circuit.setOrUpdateGlobalGateAnnotation(annotationKey, annotationValue);
+        }
+        return true;
+    }
+
+    const Circuit& SyrecSynthesis::getCachedGates(const CachedModuleSynthesis& cachedSynthesis) const {
+        if (cachedSynthesis.definition.has_value()) {
+            return hierarchy->getDefinition(*cachedSynthesis.definition).circuit;
+        }
+        return cachedSynthesis.gates;
+    }
+
+    bool SyrecSynthesis::outlineModuleSynthesis(Circuit& circuit, const ModuleSynthesisCacheKey& cacheKey, const Module& module, const Computation& synthesis, const std::size_t linesBegin) {
+        const auto cachedSynthesis = moduleSynthesisCache->entries.find(cacheKey);
+        if (cachedSynthesis == moduleSynthesisCache->entries.cend() || !cachedSynthesis->second.definition.has_value()) {
+            return true;
+        }
+
+        // The lines of the definition are the lines of the variables bound to the module parameters followed by the lines added during the synthesis of the (un)call
+        HierarchicalCircuit::Instance instance{*cachedSynthesis->second.definition, getParameterLines(module), false, circuit.getPropagatedControlLines()};
+        for (std::size_t line = linesBegin; line < circuit.getLines(); ++line) {
+            instance.lineMapping.emplace_back(line);
+        }
+        if (!hierarchy->isValidInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, instance)) {
+            return true;
+        }
+        return hierarchy->truncate(HierarchicalCircuit::TOP_LEVEL_DEFINITION, synthesis.gates.begin, synthesis.instancesBegin) && hierarchy->addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, std::move(instance));
+    }
+
+    bool SyrecSynthesis::isLoopBodyTemplatable(const ForStatement& statement) {
+        return isLoopVariableOnlyUsedToAccessLines(statement.statements, statement.loopVariable);
+    }
+
+    void SyrecSynthesis::recordLineOfLoopBodyTemplate(const unsigned line, const std::ptrdiff_t lineOffsetPerLoopVariableIncrement) {
+        if (const auto [recordedLine, wasInserted] = loopBodyTemplateRecording->lineOffsetsPerLoopVariableIncrement.try_emplace(line, lineOffsetPerLoopVariableIncrement); !wasInserted && recordedLine->second != lineOffsetPerLoopVariableIncrement) {
+            loopBodyTemplateRecording->isInstantiable = false;
+        }
+    }
+
+    bool SyrecSynthesis::synthesizeForStatementUsingLoopBodyTemplate(Circuit& circuit, const ForStatement& statement, const unsigned from, const unsigned to, const unsigned step) {
+        const bool        isLoopVariableIncremented = from <= to;
+        const std::size_t nIterations               = (isLoopVariableIncremented ? to - from : from - to) / step + 1U;
+        const auto        synthesizeIteration       = [&](const std::size_t iteration) {
+            if (!statement.loopVariable.empty()) {
+                const auto changeOfLoopVariable                = static_cast<unsigned>(iteration) * step;
+                loopVariableValues[statement.loopVariableSlot] = isLoopVariableIncremented ? from + changeOfLoopVariable : from - changeOfLoopVariable;
+            }
+            return std::all_of(statement.statements.cbegin(), statement.statements.cend(), [&](const Statement::ptr& stat) { return processStatement(circuit, stat); });
+        };
+
+        // 1. Record the gates of the first iteration as the template of the loop body
+        const std::size_t linesBegin                   = circuit.getLines();
+        const std::size_t nRequestedConstantLinesBegin = nRequestedConstantLines;
+        const std::size_t nAddedConstantLinesBegin     = nAddedConstantLines;
+        loopBodyTemplateRecording                      = LoopBodyTemplateRecording{statement.loopVariable, {}, true};
+
+        Circuit::GateRange loopBodyTemplate      = circuit.beginGateRange();
+        const bool         synthesisOfTemplateOk = synthesizeIteration(0);
+        circuit.endGateRange(loopBodyTemplate);
+        const LoopBodyTemplateRecording recording = std::move(*loopBodyTemplateRecording);
+        loopBodyTemplateRecording.reset();
+        if (!synthesisOfTemplateOk) {
+            return false;
+        }
+
+        // 2. Determine the change of each line of the template per iteration. The lines added during an iteration are appended to the circuit while the change of
+        // all other lines is determined by the recorded accesses. Since the gates of an iteration are only mapped to the lines of another iteration, the instantiation of
+        // the template is not possible if the synthesis of the first iteration modified the free constant lines or if a propagated control line depends on the loop variable.
+        bool isTemplateInstantiable = recording.isInstantiable && std::all_of(freeConstLinesMap.cbegin(), freeConstLinesMap.cend(), [](const auto& freeConstLines) { return freeConstLines.second.empty(); });
+        for (const auto propagatedControlLine: circuit.getPropagatedControlLines()) {
+            const auto recordedLine = recording.lineOffsetsPerLoopVariableIncrement.find(propagatedControlLine);
+            isTemplateInstantiable &= recordedLine == recording.lineOffsetsPerLoopVariableIncrement.cend() || recordedLine->second == 0;
+        }
+
+        const std::size_t       nLinesPerIteration = circuit.getLines() - linesBegin;
+        std::vector<Gate::Line> linesOfTemplate;
+        for (auto gateIt = std::next(circuit.cbegin(), static_cast<std::ptrdiff_t>(loopBodyTemplate.begin)); gateIt != std::next(circuit.cbegin(), static_cast<std::ptrdiff_t>(loopBodyTemplate.end)); ++gateIt) {
+            linesOfTemplate.insert(linesOfTemplate.end(), (*gateIt)->controls.cbegin(), (*gateIt)->controls.cend());
+            linesOfTemplate.insert(linesOfTemplate.end(), (*gateIt)->targets.cbegin(), (*gateIt)->targets.cend());
+        }
+        std::sort(linesOfTemplate.begin(), linesOfTemplate.end());
+        linesOfTemplate.erase(std::unique(linesOfTemplate.begin(), linesOfTemplate.end()), linesOfTemplate.end());
+
+        const std::ptrdiff_t                               stepOfLoopVariable = isLoopVariableIncremented ? static_cast<std::ptrdiff_t>(step) : -static_cast<std::ptrdiff_t>(step);
+        std::vector<std::pair<Gate::Line, std::ptrdiff_t>> lineOffsetsPerIteration;
+        for (const auto line: linesOfTemplate) {
+            const auto recordedLine           = recording.lineOffsetsPerLoopVariableIncrement.find(line);
+            const auto lineOffsetPerIncrement = recordedLine != recording.lineOffsetsPerLoopVariableIncrement.cend() ? recordedLine->second : 0;
+            if (line >= linesBegin) {
+                isTemplateInstantiable &= lineOffsetPerIncrement == 0;
+            } else if (lineOffsetPerIncrement != 0) {
+                lineOffsetsPerIteration.emplace_back(line, lineOffsetPerIncrement * stepOfLoopVariable);
+            }
+        }
+
+        if (!isTemplateInstantiable) {
+            for (std::size_t iteration = 1; iteration < nIterations; ++iteration) {
+                if (!synthesizeIteration(iteration)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // 3. Instantiate the template for the remaining iterations. The lines added by consecutive instantiated iterations are added upfront which allows the gates of
+        // these iterations to be created concurrently before being appended to the circuit in the order of the iterations.
+        const std::size_t nRequestedConstantLinesPerIteration = nRequestedConstantLines - nRequestedConstantLinesBegin;
+        const std::size_t nAddedConstantLinesPerIteration     = nAddedConstantLines - nAddedConstantLinesBegin;
+
+        // Map the lines of the template to the lines of an iteration whose added lines start at the given line and return whether all mapped lines are lines of the circuit
+        const auto mapLinesOfTemplate = [&](std::vector<Gate::Line>& lineMapping, const std::size_t iteration, const std::size_t iterationLinesBegin) {
+            for (std::size_t line = 0; line < nLinesPerIteration; ++line) {
+                lineMapping[linesBegin + line] = static_cast<Gate::Line>(iterationLinesBegin + line);
+            }
+
+            bool areMappedLinesWithinCircuit = true;
+            for (const auto& [line, lineOffset]: lineOffsetsPerIteration) {
+                const std::ptrdiff_t mappedLine = static_cast<std::ptrdiff_t>(line) + static_cast<std::ptrdiff_t>(iteration) * lineOffset;
+                areMappedLinesWithinCircuit &= mappedLine >= 0 && static_cast<std::size_t>(mappedLine) < iterationLinesBegin + nLinesPerIteration;
+                lineMapping[line] = static_cast<Gate::Line>(mappedLine);
+            }
+            return areMappedLinesWithinCircuit;
+        };
+
+        std::vector<Gate::Line> lineMapping(linesBegin + nLinesPerIteration);
+        std::iota(lineMapping.begin(), lineMapping.end(), 0U);
+        // The instantiated iterations whose gates were not yet added to the circuit with the first line added by each iteration
+        std::vector<std::pair<std::size_t, std::size_t>> pendingIterations;
+        const auto                                       appendGatesOfPendingIterations = [&]() {
+            // The instantiated iterations modify lines without processing the statements of the loop body
+            if (!pendingIterations.empty()) {
+                commonSubexpressions.clear();
+            }
+            // Only enough gates per thread amortize the creation of the threads
+            const std::size_t nThreads = std::min({nSynthesisThreads, pendingIterations.size(), pendingIterations.size() * loopBodyTemplate.size() / MIN_GATES_PER_SYNTHESIS_THREAD});
+            if (nThreads <= 1U) {
+                const bool appendOk = std::all_of(pendingIterations.cbegin(), pendingIterations.cend(), [&](const auto& pendingIteration) {
+                    mapLinesOfTemplate(lineMapping, pendingIteration.first, pendingIteration.second);
+                    return circuit.appendGateRange(circuit, loopBodyTemplate, lineMapping);
+                });
+                pendingIterations.clear();
+                return appendOk;
+            }
+
+            // Each thread creates the gates of a contiguous chunk of the pending iterations in a separate circuit while the circuit containing the template is only read
+            const std::size_t          nIterationsPerThread = (pendingIterations.size() + nThreads - 1U) / nThreads;
+            std::vector<Circuit>       gatesOfThreads(nThreads);
+            std::vector<unsigned char> isInstantiationOfThreadOk(nThreads, 0U);
+            std::vector<std::thread>   threads;
+            threads.reserve(nThreads);
+            for (std::size_t threadIdx = 0; threadIdx < nThreads; ++threadIdx) {
+                threads.emplace_back([&, threadIdx]() {
+                    Circuit& gatesOfThread = gatesOfThreads[threadIdx];
+                    gatesOfThread.setLines(circuit.getLines());
+                    std::vector<Gate::Line> lineMappingOfThread = lineMapping;
+
+                    const std::size_t firstIterationIdx = threadIdx * nIterationsPerThread;
+                    const std::size_t lastIterationIdx  = std::min(firstIterationIdx + nIterationsPerThread, pendingIterations.size());
+                    bool              instantiationOk   = true;
+                    for (std::size_t i = firstIterationIdx; i < lastIterationIdx && instantiationOk; ++i) {
+                        mapLinesOfTemplate(lineMappingOfThread, pendingIterations[i].first, pendingIterations[i].second);
+                        instantiationOk = gatesOfThread.appendGateRange(circuit, loopBodyTemplate, lineMappingOfThread);
+                    }
+                    isInstantiationOfThreadOk[threadIdx] = instantiationOk ? 1U : 0U;
+                });
+            }
+            for (auto& thread: threads) {
+                thread.join();
+            }
+            pendingIterations.clear();
+
+            if (std::find(isInstantiationOfThreadOk.cbegin(), isInstantiationOfThreadOk.cend(), 0U) != isInstantiationOfThreadOk.cend()) {
+                return false;
+            }
+            return std::all_of(gatesOfThreads.begin(), gatesOfThreads.end(), [&circuit](Circuit& gatesOfThread) { return circuit.appendGatesMovedFrom(gatesOfThread); });
+        };
+
+        std::vector<Gate::Line> mappedLinesOfTemplate;
+        for (std::size_t iteration = 1; iteration < nIterations; ++iteration) {
+            // The lines added during the iteration are appended to the lines of the circuit
+            const std::size_t iterationLinesBegin = circuit.getLines();
+            bool              areMappedLinesValid = mapLinesOfTemplate(lineMapping, iteration, iterationLinesBegin);
+
+            // If two lines of the template are mapped to the same line, the synthesis of the iteration would create a different set of gates
+            mappedLinesOfTemplate.clear();
+            std::transform(linesOfTemplate.cbegin(), linesOfTemplate.cend(), std::back_inserter(mappedLinesOfTemplate), [&lineMapping](const Gate::Line line) { return lineMapping[line]; });
+            std::sort(mappedLinesOfTemplate.begin(), mappedLinesOfTemplate.end());
+            areMappedLinesValid &= std::adjacent_find(mappedLinesOfTemplate.cbegin(), mappedLinesOfTemplate.cend()) == mappedLinesOfTemplate.cend();
+
+            if (!areMappedLinesValid) {
+                if (!appendGatesOfPendingIterations() || !synthesizeIteration(iteration)) {
+                    return false;
+                }
+                continue;
+            }
 
-            for (unsigned i = 0U; i < len; ++i) {
-                addVariable(circ, newDimensions, var, constant, garbage, arraystr + "[" + std::to_string(i) + "]");
+            // The added lines are copies of the lines added by the first iteration
+            for (std::size_t line = 0; line < nLinesPerIteration; ++line) {
+                circuit.addLineCopy(circuit, linesBegin + line);
             }
+            nRequestedConstantLines += nRequestedConstantLinesPerIteration;
+            nAddedConstantLines += nAddedConstantLinesPerIteration;
+            ++nInstantiatedLoopIterations;
+            pendingIterations.emplace_back(iteration, iterationLinesBegin);
         }
+        return appendGatesOfPendingIterations();
     }
 
     void SyrecSynthesis::addVariables(Circuit& circVar, const Variable::vec& variables) {
@@ -969,13 +1815,40 @@ namespace syrec {
             const constant constVar = (var->type == Variable::Out || var->type == Variable::Wire) ? constant(false) : constant();
             const bool     garbage  = (var->type == Variable::In || var->type == Variable::Wire);
 
-            addVariable(circVar, var->dimensions, var, constVar, garbage, std::string());
+            circVar.addLinesOfVariable(var->name, var->dimensions, var->bitwidth, constVar, garbage);
         }
     }
 
     bool SyrecSynthesis::synthesize(SyrecSynthesis* synthesizer, Circuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics) {
         // Settings parsing
         auto mainModule = get<std::string>(settings, "main_module", std::string());
+        // In a dry run, the gates are only counted which prevents the features below that inspect or cache the synthesized gates
+        const bool isDryRun = get<bool>(settings, "dry_run", false);
+        if (isDryRun && !circ.enableCostEstimationMode()) {
+            std::cerr << "Cost estimation mode requires a circuit without any gates\n";
+            return false;
+        }
+        synthesizer->recycleConstantLines = get<bool>(settings, "recycle_constant_lines", false) && synthesizer->supportsConstantLineRecycling() && !isDryRun;
+        // The lines required by a cached module synthesis are always added to the circuit, which would bypass the recycling of constant lines
+        // The (un)calls of modules are only synthesized as instances of the hierarchical circuit if their syntheses are cached
+        synthesizer->memoizeModuleSynthesis = (get<bool>(settings, "memoize_module_synthesis", false) || synthesizer->hierarchy != nullptr) && !synthesizer->recycleConstantLines && !isDryRun;
+        // Without a constant line budget, all intermediate results are kept
+        if (const auto constantLineBudget = get<unsigned>(settings, "constant_line_budget", std::numeric_limits<unsigned>::max()); constantLineBudget != std::numeric_limits<unsigned>::max() && synthesizer->supportsConstantLineRecycling() && !isDryRun) {
+            synthesizer->constantLineBudget     = constantLineBudget;
+            synthesizer->memoizeModuleSynthesis = false;
+        }
+        // The definitions of cached syntheses moved to a hierarchical circuit only exist in this circuit
+        if (auto moduleSynthesisCache = get<std::shared_ptr<ModuleSynthesisCache>>(settings, "module_synthesis_cache", nullptr); moduleSynthesisCache && synthesizer->memoizeModuleSynthesis && synthesizer->hierarchy == nullptr) {
+            synthesizer->moduleSynthesisCache = std::move(moduleSynthesisCache);
+        }
+        // The instantiation of a loop body template requires that the synthesis of an iteration does not depend on the free constant lines
+        // Since the loop body templates only copy the gates of the circuit, they would miss the module instances of a synthesized hierarchical circuit
+        synthesizer->instantiateLoopBodyTemplates = get<bool>(settings, "instantiate_loop_body_templates", false) && !synthesizer->recycleConstantLines && !synthesizer->constantLineBudget.has_value() && !isDryRun && synthesizer->hierarchy == nullptr;
+        // Reverting the evaluation of an expression would also revert the results recorded for its subexpressions
+        synthesizer->eliminateCommonSubexpressions = get<bool>(settings, "eliminate_common_subexpressions", false) && synthesizer->supportsCommonSubexpressionElimination() && !synthesizer->recycleConstantLines && !synthesizer->constantLineBudget.has_value();
+        // The gates of instantiated loop body templates can be created concurrently, a value of zero uses one thread per available hardware thread
+        const auto nSynthesisThreads   = get<unsigned>(settings, "synthesis_threads", 1U);
+        synthesizer->nSynthesisThreads = std::max<std::size_t>(nSynthesisThreads != 0U ? nSynthesisThreads : std::thread::hardware_concurrency(), 1U);
         // Run-time measuring
         Timer<PropertiesTimer> t;
 
@@ -1000,6 +1873,29 @@ namespace syrec {
             }
         }
 
+        // The persistent synthesis cache replaces the whole synthesis of the main module, thus it is neither used for dry runs nor for hierarchical circuits whose definitions it does not store
+        std::optional<SynthesisCache> synthesisCache;
+        std::string                   synthesisCacheKey;
+        if (auto synthesisCacheDirectory = get<std::string>(settings, "synthesis_cache_directory", std::string()); !synthesisCacheDirectory.empty() && !isDryRun && synthesizer->hierarchy == nullptr && circ.getLines() == 0U && circ.numGates() == 0U) {
+            // The number of synthesis threads is not part of the key since it does not change the synthesized circuit
+            std::ostringstream configuration;
+            configuration << synthesizer->getNameOfScheme() << ' ' << synthesizer->recycleConstantLines << ' ' << synthesizer->memoizeModuleSynthesis << ' '
+                          << synthesizer->constantLineBudget.value_or(std::numeric_limits<std::size_t>::max()) << ' ' << synthesizer->instantiateLoopBodyTemplates << ' ' << synthesizer->eliminateCommonSubexpressions;
+            synthesisCache.emplace(std::move(synthesisCacheDirectory));
+            synthesisCacheKey = SynthesisCache::computeKey(*main, configuration.str());
+
+            if (SynthesisCache::Statistics cachedStatistics; synthesisCache->load(synthesisCacheKey, circ, cachedStatistics)) {
+                if (statistics) {
+                    t.stop();
+                    for (const auto& [name, value]: cachedStatistics) {
+                        statistics->set(name, value);
+                    }
+                    statistics->set("synthesis_cache_hit", true);
+                }
+                return true;
+            }
+        }
+
         // declare as top module
         synthesizer->setMainModule(main);
 
@@ -1008,10 +1904,40 @@ namespace syrec {
         synthesizer->addVariables(circ, main->variables);
 
         // synthesize the statements
-        const auto synthesisOfMainModuleOk = synthesizer->onModule(circ, main);
+        const auto                       synthesisOfMainModuleOk = synthesizer->onModule(circ, main);
+        const SynthesisCache::Statistics synthesisStatistics{
+                {"total_constant_lines", static_cast<unsigned>(synthesizer->nRequestedConstantLines)},
+                {"added_constant_lines", static_cast<unsigned>(synthesizer->nAddedConstantLines)},
+                {"replayed_module_syntheses", static_cast<unsigned>(synthesizer->nReplayedModuleSyntheses)},
+                {"instantiated_loop_iterations", static_cast<unsigned>(synthesizer->nInstantiatedLoopIterations)},
+                {"reused_subexpressions", static_cast<unsigned>(synthesizer->nReusedSubexpressions)}};
+        if (synthesisCache.has_value() && synthesisOfMainModuleOk) {
+            synthesisCache->store(synthesisCacheKey, circ, synthesisStatistics);
+        }
         if (statistics) {
             t.stop();
+            for (const auto& [name, value]: synthesisStatistics) {
+                statistics->set(name, value);
+            }
+            if (synthesisCache.has_value()) {
+                statistics->set("synthesis_cache_hit", false);
+            }
         }
         return synthesisOfMainModuleOk;
     }
+
+    bool SyrecSynthesis::synthesize(SyrecSynthesis* synthesizer, HierarchicalCircuit& circ, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics) {
+        if (circ.numDefinitions() != 1U) {
+            std::cerr << "Synthesis of a hierarchical circuit requires a circuit without any definitions\n";
+            return false;
+        }
+
+        synthesizer->hierarchy          = &circ;
+        const bool synthesisOfCircuitOk = synthesize(synthesizer, circ.getTopLevelCircuit(), program, settings, statistics);
+        if (statistics) {
+            statistics->set("module_definitions", static_cast<unsigned>(circ.numDefinitions() - 1U));
+            statistics->set("module_instances", static_cast<unsigned>(circ.numInstances()));
+        }
+        return synthesisOfCircuitOk;
+    }
 } // namespace syrec
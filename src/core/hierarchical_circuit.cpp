@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/hierarchical_circuit.hpp"
+
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    HierarchicalCircuit::HierarchicalCircuit() {
+        definitions.emplace_back();
+    }
+
+    std::optional<HierarchicalCircuit::DefinitionId> HierarchicalCircuit::addDefinition(const std::string& name, Circuit circuit, std::vector<std::pair<std::size_t, Instance>> instances) {
+        const DefinitionId definition = definitions.size();
+        definitions.emplace_back(Definition{name, std::move(circuit), {}});
+
+        std::size_t nPrecedingGatesOfPreviousInstance = 0;
+        for (const auto& [nPrecedingGates, instance]: instances) {
+            if (nPrecedingGates < nPrecedingGatesOfPreviousInstance || nPrecedingGates > definitions.back().circuit.numGates() || !isValidInstance(definition, instance)) {
+                definitions.pop_back();
+                return std::nullopt;
+            }
+            nPrecedingGatesOfPreviousInstance = nPrecedingGates;
+        }
+        definitions.back().instances = std::move(instances);
+        return definition;
+    }
+
+    bool HierarchicalCircuit::isValidInstance(const DefinitionId parent, const Instance& instance) const {
+        if (parent >= definitions.size() || instance.definition == TOP_LEVEL_DEFINITION || instance.definition >= definitions.size() || (parent != TOP_LEVEL_DEFINITION && instance.definition >= parent)) {
+            return false;
+        }
+
+        const unsigned linesOfEnclosingCircuit = definitions[parent].circuit.getLines();
+        if (instance.lineMapping.size() != definitions[instance.definition].circuit.getLines() || (!instance.controls.empty() && *instance.controls.crbegin() >= linesOfEnclosingCircuit)) {
+            return false;
+        }
+
+        Gate::LinesLookup mappedLines;
+        for (const auto line: instance.lineMapping) {
+            if (line >= linesOfEnclosingCircuit || instance.controls.count(line) != 0 || !mappedLines.emplace(line).second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool HierarchicalCircuit::addInstance(const DefinitionId parent, Instance instance) {
+        if (!isValidInstance(parent, instance)) {
+            return false;
+        }
+        auto& enclosingDefinition = definitions[parent];
+        enclosingDefinition.instances.emplace_back(enclosingDefinition.circuit.numGates(), std::move(instance));
+        return true;
+    }
+
+    bool HierarchicalCircuit::truncate(const DefinitionId definition, const std::size_t nGates, const std::size_t nInstances) {
+        if (definition >= definitions.size()) {
+            return false;
+        }
+
+        auto& truncatedDefinition = definitions[definition];
+        if (nInstances > truncatedDefinition.instances.size() || (nInstances != 0 && truncatedDefinition.instances[nInstances - 1].first > nGates)) {
+            return false;
+        }
+        if (!truncatedDefinition.circuit.removeGatesFrom(nGates)) {
+            return false;
+        }
+        truncatedDefinition.instances.resize(nInstances);
+        return true;
+    }
+
+    std::size_t HierarchicalCircuit::numInstances() const {
+        std::size_t nInstances = 0;
+        for (const auto& definition: definitions) {
+            nInstances += definition.instances.size();
+        }
+        return nInstances;
+    }
+
+    std::size_t HierarchicalCircuit::numGates() const {
+        std::map<DefinitionId, std::size_t> numGatesOfDefinitions;
+        return numGates(TOP_LEVEL_DEFINITION, numGatesOfDefinitions);
+    }
+
+    std::size_t HierarchicalCircuit::numGates(const DefinitionId definition, std::map<DefinitionId, std::size_t>& numGatesOfDefinitions) const {
+        if (const auto cachedNumGates = numGatesOfDefinitions.find(definition); cachedNumGates != numGatesOfDefinitions.cend()) {
+            return cachedNumGates->second;
+        }
+
+        std::size_t nGates = definitions[definition].circuit.numGates();
+        for (const auto& [nPrecedingGates, instance]: definitions[definition].instances) {
+            nGates += numGates(instance.definition, numGatesOfDefinitions);
+        }
+        numGatesOfDefinitions.emplace(definition, nGates);
+        return nGates;
+    }
+
+    Gate::cost_t HierarchicalCircuit::quantumCost() const {
+        std::map<std::pair<DefinitionId, std::size_t>, Gate::cost_t> costsOfDefinitions;
+        return quantumCost(TOP_LEVEL_DEFINITION, 0, getTopLevelCircuit().getLines(), costsOfDefinitions);
+    }
+
+    Gate::cost_t HierarchicalCircuit::quantumCost(const DefinitionId definition, const std::size_t nAdditionalControls, const unsigned lines, std::map<std::pair<DefinitionId, std::size_t>, Gate::cost_t>& costsOfDefinitions) const {
+        if (const auto cachedCost = costsOfDefinitions.find({definition, nAdditionalControls}); cachedCost != costsOfDefinitions.cend()) {
+            return cachedCost->second;
+        }
+
+        const auto&  costedDefinition = definitions[definition];
+        Gate::cost_t cost             = 0U;
+        if (definition == TOP_LEVEL_DEFINITION) {
+            // The costs of the top-level circuit also include the gates only counted in the cost estimation mode
+            cost = costedDefinition.circuit.quantumCost();
+        } else {
+            // The cost of a gate depends on the number of lines of the flattened circuit rather than on the number of lines of the definition
+            for (const auto& gate: costedDefinition.circuit) {
+                cost += Gate::quantumCost(gate->type, gate->controls.size() + nAdditionalControls, lines);
+            }
+        }
+        // Since the control lines of an instance are not used by the instantiated definition, they increase the number of control lines of every gate of the definition
+        for (const auto& [nPrecedingGates, instance]: costedDefinition.instances) {
+            cost += quantumCost(instance.definition, nAdditionalControls + instance.controls.size(), lines, costsOfDefinitions);
+        }
+        costsOfDefinitions.emplace(std::make_pair(definition, nAdditionalControls), cost);
+        return cost;
+    }
+
+    Gate::cost_t HierarchicalCircuit::transistorCost() const {
+        std::map<std::pair<DefinitionId, std::size_t>, Gate::cost_t> costsOfDefinitions;
+        return transistorCost(TOP_LEVEL_DEFINITION, 0, costsOfDefinitions);
+    }
+
+    Gate::cost_t HierarchicalCircuit::transistorCost(const DefinitionId definition, const std::size_t nAdditionalControls, std::map<std::pair<DefinitionId, std::size_t>, Gate::cost_t>& costsOfDefinitions) const {
+        if (const auto cachedCost = costsOfDefinitions.find({definition, nAdditionalControls}); cachedCost != costsOfDefinitions.cend()) {
+            return cachedCost->second;
+        }
+
+        const auto&  costedDefinition = definitions[definition];
+        Gate::cost_t cost             = costedDefinition.circuit.transistorCost() + 8ULL * nAdditionalControls * costedDefinition.circuit.numGates();
+        for (const auto& [nPrecedingGates, instance]: costedDefinition.instances) {
+            cost += transistorCost(instance.definition, nAdditionalControls + instance.controls.size(), costsOfDefinitions);
+        }
+        costsOfDefinitions.emplace(std::make_pair(definition, nAdditionalControls), cost);
+        return cost;
+    }
+
+    bool HierarchicalCircuit::flatten(Circuit& circ) const {
+        if (circ.getLines() != 0 || circ.numGates() != 0) {
+            return false;
+        }
+
+        const Circuit& topLevelCircuit = getTopLevelCircuit();
+        for (Gate::Line line = 0; line < topLevelCircuit.getLines(); ++line) {
+            circ.addLineCopy(topLevelCircuit, line);
+        }
+        return appendFlattenedDefinition(circ, TOP_LEVEL_DEFINITION, {}, false);
+    }
+
+    bool HierarchicalCircuit::appendFlattenedInstance(Circuit& circ, const Instance& instance) const {
+        if (instance.definition == TOP_LEVEL_DEFINITION || instance.definition >= definitions.size() || instance.lineMapping.size() != definitions[instance.definition].circuit.getLines()) {
+            return false;
+        }
+
+        circ.activateControlLinePropagationScope();
+        const bool registrationOk = std::all_of(instance.controls.cbegin(), instance.controls.cend(), [&circ](const Gate::Line controlLine) { return circ.registerControlLineForPropagationInCurrentAndNestedScopes(controlLine); });
+        const bool flatteningOk   = registrationOk && appendFlattenedDefinition(circ, instance.definition, instance.lineMapping, instance.isInverted);
+        circ.deactivateControlLinePropagationScope();
+        return flatteningOk;
+    }
+
+    bool HierarchicalCircuit::appendFlattenedDefinition(Circuit& circ, const DefinitionId definition, const std::vector<Gate::Line>& lineMapping, const bool isInverted) const {
+        const auto& flattenedDefinition = definitions[definition];
+        return forEachElement(
+                flattenedDefinition, isInverted,
+                [&](const std::size_t gate) {
+                    const Circuit::GateRange gateRange{gate, gate + 1};
+                    return isInverted ? circ.appendInverseOfGateRange(flattenedDefinition.circuit, gateRange, lineMapping) : circ.appendGateRange(flattenedDefinition.circuit, gateRange, lineMapping);
+                },
+                [&](const Instance& instance) {
+                    // The lines of the nested instance are lines of the flattened definition which are mapped to the lines of the circuit
+                    Instance mappedInstance;
+                    mappedInstance.definition = instance.definition;
+                    mappedInstance.isInverted = instance.isInverted != isInverted;
+                    mappedInstance.lineMapping.reserve(instance.lineMapping.size());
+                    for (const auto line: instance.lineMapping) {
+                        mappedInstance.lineMapping.emplace_back(lineMapping.empty() ? line : lineMapping.at(line));
+                    }
+                    for (const auto controlLine: instance.controls) {
+                        mappedInstance.controls.emplace(lineMapping.empty() ? controlLine : lineMapping.at(controlLine));
+                    }
+                    return appendFlattenedInstance(circ, mappedInstance);
+                });
+    }
+} // namespace syrec
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/binary_circuit.hpp"
+
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace syrec {
+    namespace {
+        constexpr std::string_view BINARY_CIRCUIT_MAGIC   = "SYRC";
+        constexpr std::uint8_t     BINARY_CIRCUIT_VERSION = 1U;
+        // Upper bound for the length of a line name to prevent huge allocations when reading corrupted files
+        constexpr std::uint32_t MAX_LINE_NAME_LENGTH = 1U << 16U;
+
+        // Encoding of the constant value of a line
+        constexpr std::uint8_t NOT_CONSTANT   = 0U;
+        constexpr std::uint8_t CONSTANT_FALSE = 1U;
+        constexpr std::uint8_t CONSTANT_TRUE  = 2U;
+
+        // Encoding of the type of a gate
+        constexpr std::uint8_t TOFFOLI_GATE = 0U;
+        constexpr std::uint8_t FREDKIN_GATE = 1U;
+
+        template<typename T>
+        void writeUnsigned(std::ostream& os, T value) {
+            for (std::size_t i = 0; i < sizeof(T); ++i) {
+                os.put(static_cast<char>(value & 0xFFU));
+                value = static_cast<T>(value >> 8U);
+            }
+        }
+
+        template<typename T>
+        std::optional<T> readUnsigned(std::istream& is) {
+            T value = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i) {
+                const auto byte = is.get();
+                if (byte == std::istream::traits_type::eof()) {
+                    return std::nullopt;
+                }
+                value = static_cast<T>(value | static_cast<T>(static_cast<T>(byte) << (8U * i)));
+            }
+            return value;
+        }
+
+        void writeString(std::ostream& os, const std::string& value) {
+            writeUnsigned(os, static_cast<std::uint32_t>(value.size()));
+            os.write(value.data(), static_cast<std::streamsize>(value.size()));
+        }
+
+        std::optional<std::string> readString(std::istream& is) {
+            const auto length = readUnsigned<std::uint32_t>(is);
+            if (!length.has_value() || *length > MAX_LINE_NAME_LENGTH) {
+                return std::nullopt;
+            }
+            std::string value(*length, '\0');
+            if (!is.read(value.data(), static_cast<std::streamsize>(value.size()))) {
+                return std::nullopt;
+            }
+            return value;
+        }
+
+        void writeLines(std::ostream& os, const Gate::LinesLookup& lines) {
+            for (const auto line: lines) {
+                writeUnsigned(os, static_cast<std::uint32_t>(line));
+            }
+        }
+
+        std::optional<Gate::LinesLookup> readLines(std::istream& is, const std::uint32_t nLines) {
+            Gate::LinesLookup lines;
+            for (std::uint32_t i = 0; i < nLines; ++i) {
+                const auto line = readUnsigned<std::uint32_t>(is);
+                if (!line.has_value() || !lines.emplace(*line).second) {
+                    return std::nullopt;
+                }
+            }
+            return lines;
+        }
+    } // namespace
+
+    bool writeBinaryCircuit(const Circuit& circ, std::ostream& os) {
+        os.write(BINARY_CIRCUIT_MAGIC.data(), static_cast<std::streamsize>(BINARY_CIRCUIT_MAGIC.size()));
+        writeUnsigned(os, BINARY_CIRCUIT_VERSION);
+        writeUnsigned(os, static_cast<std::uint32_t>(circ.getLines()));
+        for (unsigned line = 0; line < circ.getLines(); ++line) {
+            writeString(os, circ.getInput(line));
+            writeString(os, circ.getOutput(line));
+            const auto& constantValue = circ.getConstants()[line];
+            writeUnsigned(os, constantValue.has_value() ? (*constantValue ? CONSTANT_TRUE : CONSTANT_FALSE) : NOT_CONSTANT);
+            writeUnsigned(os, static_cast<std::uint8_t>(circ.getGarbage()[line] ? 1U : 0U));
+        }
+
+        writeUnsigned(os, static_cast<std::uint64_t>(circ.numGates()));
+        for (const auto& gate: circ) {
+            if (gate->type != Gate::Type::Toffoli && gate->type != Gate::Type::Fredkin) {
+                return false;
+            }
+            writeUnsigned(os, gate->type == Gate::Type::Toffoli ? TOFFOLI_GATE : FREDKIN_GATE);
+            writeUnsigned(os, static_cast<std::uint32_t>(gate->controls.size()));
+            writeUnsigned(os, static_cast<std::uint32_t>(gate->targets.size()));
+            writeLines(os, gate->controls);
+            writeLines(os, gate->targets);
+        }
+        return os.good();
+    }
+
+    bool writeBinaryCircuitFile(const Circuit& circ, const std::string& filename) {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            return false; // GCOVR_EXCL_LINE
+        }
+        return writeBinaryCircuit(circ, file);
+    }
+
+    bool readBinaryCircuit(Circuit& circ, std::istream& is) {
+        if (circ.getLines() != 0 || circ.numGates() != 0) {
+            return false;
+        }
+
+        std::string magic(BINARY_CIRCUIT_MAGIC.size(), '\0');
+        if (!is.read(magic.data(), static_cast<std::streamsize>(magic.size())) || magic != BINARY_CIRCUIT_MAGIC) {
+            return false;
+        }
+        if (const auto version = readUnsigned<std::uint8_t>(is); !version.has_value() || *version != BINARY_CIRCUIT_VERSION) {
+            return false;
+        }
+
+        const auto nLines = readUnsigned<std::uint32_t>(is);
+        if (!nLines.has_value()) {
+            return false;
+        }
+        for (std::uint32_t line = 0; line < *nLines; ++line) {
+            const auto input         = readString(is);
+            const auto output        = readString(is);
+            const auto constantValue = readUnsigned<std::uint8_t>(is);
+            const auto garbage       = readUnsigned<std::uint8_t>(is);
+            if (!input.has_value() || !output.has_value() || !constantValue.has_value() || *constantValue > CONSTANT_TRUE || !garbage.has_value() || *garbage > 1U) {
+                return false;
+            }
+            circ.addLine(*input, *output, *constantValue == NOT_CONSTANT ? constant() : constant(*constantValue == CONSTANT_TRUE), *garbage == 1U);
+        }
+
+        const auto nGates = readUnsigned<std::uint64_t>(is);
+        if (!nGates.has_value()) {
+            return false;
+        }
+        for (std::uint64_t i = 0; i < *nGates; ++i) {
+            const auto gateType  = readUnsigned<std::uint8_t>(is);
+            const auto nControls = readUnsigned<std::uint32_t>(is);
+            const auto nTargets  = readUnsigned<std::uint32_t>(is);
+            if (!gateType.has_value() || !nControls.has_value() || !nTargets.has_value() || *nControls > *nLines ||
+                (*gateType == TOFFOLI_GATE && *nTargets != 1U) || (*gateType == FREDKIN_GATE && *nTargets != 2U) || *gateType > FREDKIN_GATE) {
+                return false;
+            }
+
+            Gate       gate;
+            const auto controls = readLines(is, *nControls);
+            const auto targets  = readLines(is, *nTargets);
+            if (!controls.has_value() || !targets.has_value()) {
+                return false;
+            }
+            gate.type     = *gateType == TOFFOLI_GATE ? Gate::Type::Toffoli : Gate::Type::Fredkin;
+            gate.controls = *controls;
+            gate.targets  = *targets;
+            // The copy of the gate is only created if all of its lines are lines of the circuit and no control line is also a target line
+            if (circ.createAndAddGateCopy(gate) == nullptr) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool readBinaryCircuitFile(Circuit& circ, const std::string& filename) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+        return readBinaryCircuit(circ, file);
+    }
+} // namespace syrec
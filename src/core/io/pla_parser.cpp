@@ -24,6 +24,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace syrec {
@@ -34,6 +35,11 @@ namespace syrec {
         std::size_t      nOutputs = 0;
         std::regex const whitespace("\\s+");
 
+        // the cubes are collected in bulk and sorted once when the table is read
+        if (tt.empty()) {
+            tt.setSparseStorage(TruthTable::SparseStorage::SortedVector);
+        }
+
         while (in.good() && getline(in, line)) {
             trim(line);
             line = std::regex_replace(line, whitespace, " ");
@@ -94,7 +100,7 @@ namespace syrec {
                     cubeOut.emplace_back(TruthTable::Cube::getValue(s));
                 }
 
-                tt.try_emplace(cubeIn, cubeOut);
+                tt.try_emplace(std::move(cubeIn), std::move(cubeOut));
             }
         }
     }
@@ -105,57 +111,51 @@ namespace syrec {
             throw std::invalid_argument("Overflow!, Number of inputs is greater than maximum capacity " + std::string("(") + std::to_string(std::min(static_cast<unsigned>(std::log2(tt.max_size())), 63U)) + std::string(")"));
         }
 
-        TruthTable newTT{};
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
 
-        for (auto const& [input, output]: tt) {
-            // compute the complete cubes for the input
-            auto completeInputs = input.completeCubes();
-            // move all the complete cubes to the new cube map
-            for (auto const& completeInput: completeInputs) {
-                const auto inputIt = newTT.find(input);
+        // the complete table is stored densely, all inputs not covered by a cube are mapped to the zero output
+        TruthTable::DenseOutputs outputs(nInputs, nOutputs);
+        std::vector<bool>        assigned(static_cast<std::size_t>(outputs.nRows()), false);
 
-                if (inputIt != newTT.end()) {
-                    TruthTable::Cube newOutCube{inputIt->second};
+        const auto toInteger = [&](const TruthTable::Cube::Word* words) -> std::uint64_t {
+            return nInputs == 0U ? 0U : words[0U] >> (TruthTable::Cube::WORD_BITS - nInputs);
+        };
 
-                    // clubbing the 1's of the new output with the old one
-                    for (auto i = 0U; i < tt.nOutputs(); i++) {
-                        if (output[i].has_value() && newOutCube[i].has_value() && *output[i]) {
-                            newOutCube[i] = true;
-                        }
-                    }
+        for (auto const& [input, output]: std::as_const(tt)) {
+            const auto values = toInteger(input.valueWords());
+            const auto dcs    = ~toInteger(input.careWords()) & (outputs.nRows() - 1U);
 
-                    assert(output != newOutCube);
-                    // erasing the old output.
-                    newTT.erase(inputIt);
-                    newTT.try_emplace(completeInput, newOutCube);
-                } else {
-                    newTT.try_emplace(completeInput, output);
+            if (dcs == 0U) {
+                if (!assigned[values]) {
+                    outputs.setOutput(values, output);
+                    assigned[values] = true;
+                    continue;
                 }
+                // clubbing the 1's of the new output with the old one
+                for (auto i = 0U; i < nOutputs; i++) {
+                    if (output[i].has_value() && outputs.get(values, i).has_value() && *output[i]) {
+                        outputs.set(values, i, true);
+                    }
+                }
+                continue;
             }
+
+            // compute the complete cubes for the input, the outputs of complete cubes covered by a previous cube are kept
+            std::uint64_t dc = 0U;
+            do {
+                if (const auto completeInput = values | dc; !assigned[completeInput]) {
+                    outputs.setOutput(completeInput, output);
+                    assigned[completeInput] = true;
+                }
+                dc = (dc - dcs) & dcs;
+            } while (dc != 0U);
         }
-        // swap the new cube map with the old one
-        tt.swap(newTT);
-
-        // construct output cube
-        const auto output = TruthTable::Cube(tt.nOutputs(), false);
-
-        std::uint64_t pos = 0U;
-        for (const auto& [input, _]: tt) {
-            // fill in all the missing inputs
-            const auto number = input.toInteger();
-            for (std::uint64_t i = pos; i < number; ++i) {
-                tt[TruthTable::Cube::fromInteger(i, tt.nInputs())] = output;
-            }
-            pos = number + 1U;
-        }
-        // fill in the remaining missing inputs (if any)
-        const std::uint64_t max = 1ULL << tt.nInputs();
-        for (std::uint64_t i = pos; i < max; ++i) {
-            tt[TruthTable::Cube::fromInteger(i, tt.nInputs())] = output;
-        }
+
+        tt.setDenseOutputs(std::move(outputs));
     }
 
-    bool readPla(TruthTable& tt, const std::string& filename) {
+    bool readPla(TruthTable& tt, const std::string& filename, const bool extendTable) {
         std::ifstream is;
         is.open(filename.c_str(), std::ifstream::in);
 
@@ -167,7 +167,9 @@ namespace syrec {
         parsePla(tt, is);
 
         // extending the truth table.
-        extend(tt);
+        if (extendTable) {
+            extend(tt);
+        }
 
         return true;
     }
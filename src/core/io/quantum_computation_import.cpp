@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/quantum_computation_import.hpp"
+
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    bool importQuantumComputation(Circuit& circ, const qc::QuantumComputation& qc) {
+        if (circ.getLines() != 0 || circ.numGates() != 0) {
+            return false;
+        }
+
+        const std::size_t        nQubits = qc.getNqubits();
+        std::vector<std::string> lineNames(nQubits);
+        for (std::size_t qubit = 0; qubit < nQubits; ++qubit) {
+            lineNames[qubit] = "q" + std::to_string(qubit);
+        }
+        for (const auto* registers: {&qc.getQuantumRegisters(), &qc.getAncillaRegisters()}) {
+            for (const auto& [registerName, quantumRegister]: *registers) {
+                for (std::size_t i = 0; i < quantumRegister.getSize(); ++i) {
+                    if (const std::size_t qubit = quantumRegister.getStartIndex() + i; qubit < nQubits) {
+                        lineNames[qubit] = quantumRegister.getSize() == 1U ? registerName : registerName + "_" + std::to_string(i);
+                    }
+                }
+            }
+        }
+
+        const auto& ancillary = qc.getAncillary();
+        const auto& garbage   = qc.getGarbage();
+        for (std::size_t qubit = 0; qubit < nQubits; ++qubit) {
+            const bool isAncillary = qubit < ancillary.size() && ancillary[qubit];
+            const bool isGarbage   = qubit < garbage.size() && garbage[qubit];
+            circ.addLine(lineNames[qubit], lineNames[qubit], isAncillary ? constant(false) : constant(), isGarbage);
+        }
+
+        for (const auto& operation: qc) {
+            if (!operation->isStandardOperation()) {
+                return false;
+            }
+
+            const auto operationType = operation->getType();
+            if (operationType == qc::I || operationType == qc::Barrier) {
+                continue;
+            }
+            if (operationType != qc::X && operationType != qc::SWAP) {
+                return false;
+            }
+
+            Gate::LinesLookup       controlLines;
+            std::vector<Gate::Line> negativeControlLines;
+            for (const auto& control: operation->getControls()) {
+                controlLines.emplace(control.qubit);
+                if (control.type == qc::Control::Type::Neg) {
+                    negativeControlLines.emplace_back(control.qubit);
+                }
+            }
+            const auto& targets = operation->getTargets();
+            if (targets.size() != (operationType == qc::X ? 1U : 2U)) {
+                return false;
+            }
+
+            for (const auto negativeControlLine: negativeControlLines) {
+                if (circ.createAndAddNotGate(negativeControlLine) == nullptr) {
+                    return false;
+                }
+            }
+            Gate gate;
+            gate.type     = operationType == qc::X ? Gate::Type::Toffoli : Gate::Type::Fredkin;
+            gate.controls = controlLines;
+            gate.targets.insert(targets.cbegin(), targets.cend());
+            if (circ.createAndAddGateCopy(gate) == nullptr) {
+                return false;
+            }
+            for (const auto negativeControlLine: negativeControlLines) {
+                circ.createAndAddNotGate(negativeControlLine);
+            }
+        }
+        return true;
+    }
+} // namespace syrec
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/lexer.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <string_view>
+
+namespace syrec {
+    namespace {
+        bool isWordCharacter(const char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+        }
+
+        bool isDigit(const char c) {
+            return std::isdigit(static_cast<unsigned char>(c)) != 0;
+        }
+
+        bool isWhitespace(const char c) {
+            return std::isspace(static_cast<unsigned char>(c)) != 0;
+        }
+    } // namespace
+
+    bool Lexer::skipIgnoredCharacters() {
+        while (position < content.size()) {
+            const char c = content[position];
+            if (c == '\n') {
+                ++lineNumber;
+                ++position;
+            } else if (c == ';' || isWhitespace(c)) {
+                ++position;
+            } else if (content.compare(position, 2, "//") == 0) {
+                const std::size_t endOfLine = content.find('\n', position);
+                position                    = endOfLine == std::string_view::npos ? content.size() : endOfLine;
+            } else if (content.compare(position, 2, "/*") == 0) {
+                const std::size_t endOfComment = content.find("*/", position + 2);
+                if (endOfComment == std::string_view::npos) {
+                    return false;
+                }
+                for (std::size_t i = position; i < endOfComment; ++i) {
+                    lineNumber += content[i] == '\n' ? 1U : 0U;
+                }
+                position = endOfComment + 2;
+            } else {
+                break;
+            }
+        }
+        return true;
+    }
+
+    Token Lexer::next() {
+        Token token;
+        if (!skipIgnoredCharacters()) {
+            token.kind       = Token::Kind::Invalid;
+            token.offset     = position;
+            token.lineNumber = lineNumber;
+            token.text       = content.substr(position);
+            position         = content.size();
+            return token;
+        }
+
+        token.offset     = position;
+        token.lineNumber = lineNumber;
+        if (position == content.size()) {
+            return token;
+        }
+
+        const auto accept = [&](const Token::Kind kind, const std::size_t length) {
+            token.kind = kind;
+            token.text = content.substr(position, length);
+            position += length;
+            return token;
+        };
+        const auto followedBy = [&](const char c) {
+            return position + 1 < content.size() && content[position + 1] == c;
+        };
+
+        const char c = content[position];
+        if (isWordCharacter(c)) {
+            std::size_t end          = position;
+            bool        isOnlyDigits = true;
+            while (end < content.size() && isWordCharacter(content[end])) {
+                isOnlyDigits &= isDigit(content[end]);
+                ++end;
+            }
+            return accept(isOnlyDigits ? Token::Kind::Number : Token::Kind::Identifier, end - position);
+        }
+
+        switch (c) {
+            case '(':
+                return accept(Token::Kind::LeftParenthesis, 1);
+            case ')':
+                return accept(Token::Kind::RightParenthesis, 1);
+            case '[':
+                return accept(Token::Kind::LeftBracket, 1);
+            case ']':
+                return accept(Token::Kind::RightBracket, 1);
+            case ',':
+                return accept(Token::Kind::Comma, 1);
+            case '.':
+                return accept(Token::Kind::Dot, 1);
+            case ':':
+                return accept(Token::Kind::Colon, 1);
+            case '#':
+                return accept(Token::Kind::Hash, 1);
+            case '$':
+                return accept(Token::Kind::Dollar, 1);
+            case '~':
+                return accept(Token::Kind::Tilde, 1);
+            case '^':
+                return accept(Token::Kind::Caret, 1);
+            case '*':
+                return accept(Token::Kind::Star, 1);
+            case '/':
+                return accept(Token::Kind::Slash, 1);
+            case '%':
+                return accept(Token::Kind::Percent, 1);
+            case '+':
+                return followedBy('+') ? accept(Token::Kind::Increment, 2) : accept(Token::Kind::Plus, 1);
+            case '-':
+                return followedBy('-') ? accept(Token::Kind::Decrement, 2) : accept(Token::Kind::Minus, 1);
+            case '&':
+                return followedBy('&') ? accept(Token::Kind::LogicalAnd, 2) : accept(Token::Kind::Ampersand, 1);
+            case '|':
+                return followedBy('|') ? accept(Token::Kind::LogicalOr, 2) : accept(Token::Kind::Pipe, 1);
+            case '=':
+                return followedBy('=') ? accept(Token::Kind::Equals, 2) : accept(Token::Kind::Assign, 1);
+            case '!':
+                return followedBy('=') ? accept(Token::Kind::NotEquals, 2) : accept(Token::Kind::Invalid, 1);
+            case '>':
+                if (followedBy('=')) {
+                    return accept(Token::Kind::GreaterEquals, 2);
+                }
+                return followedBy('>') ? accept(Token::Kind::ShiftRight, 2) : accept(Token::Kind::Greater, 1);
+            case '<':
+                if (content.compare(position, 3, "<=>") == 0) {
+                    return accept(Token::Kind::Swap, 3);
+                }
+                if (followedBy('=')) {
+                    return accept(Token::Kind::LessEquals, 2);
+                }
+                return followedBy('<') ? accept(Token::Kind::ShiftLeft, 2) : accept(Token::Kind::Less, 1);
+            default:
+                return accept(Token::Kind::Invalid, 1);
+        }
+    }
+} // namespace syrec
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/node_pool.hpp"
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    namespace {
+        // Tags distinguishing the different kinds of nodes sharing the same map of nodes
+        enum class NodeKind : std::uint8_t {
+            ConstantNumber,
+            LoopVariable,
+            VariableAccess,
+            NumericExpression,
+            VariableExpression,
+            BinaryExpression,
+            ShiftExpression
+        };
+
+        constexpr std::size_t tag(const NodeKind kind) {
+            return static_cast<std::size_t>(kind);
+        }
+
+        // Marks the absence of an optional child in the key of a node
+        constexpr auto NO_NODE = static_cast<std::size_t>(-1);
+    } // namespace
+
+    void* NodeArena::allocate(const std::size_t size, const std::size_t alignment) {
+        // The memory returned by new is suitably aligned for any fundamental type but a chunk might start at an arbitrary address for over-aligned types,
+        // hence the address of the allocated memory and not its offset in the chunk is aligned
+        const auto alignedOffsetInCurrentChunk = [&]() {
+            const auto address = reinterpret_cast<std::uintptr_t>(chunks.back().get() + offsetInCurrentChunk); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            return offsetInCurrentChunk + static_cast<std::size_t>((address + alignment - 1U) / alignment * alignment - address);
+        };
+
+        std::size_t alignedOffset = chunks.empty() ? 0U : alignedOffsetInCurrentChunk();
+        if (chunks.empty() || alignedOffset + size > sizeOfCurrentChunk) {
+            // Nodes larger than a chunk get a chunk of their own
+            sizeOfCurrentChunk = std::max(CHUNK_SIZE, size + alignment);
+            chunks.emplace_back(std::make_unique<unsigned char[]>(sizeOfCurrentChunk)); // NOLINT(*-avoid-c-arrays)
+            offsetInCurrentChunk = 0;
+            alignedOffset        = alignedOffsetInCurrentChunk();
+        }
+
+        void* memory         = chunks.back().get() + alignedOffset;
+        offsetInCurrentChunk = alignedOffset + size;
+        nAllocatedBytes += size;
+        return memory;
+    }
+
+    std::size_t NodePool::NodeKeyHash::operator()(const NodeKey& key) const noexcept {
+        std::size_t hash = key.size();
+        for (const auto entry: key) {
+            hash ^= entry + 0x9e3779b97f4a7c15ULL + (hash << 6U) + (hash >> 2U);
+        }
+        return hash;
+    }
+
+    template<typename T, typename Node, typename... Args>
+    std::shared_ptr<Node> NodePool::intern(std::unordered_map<NodeKey, std::shared_ptr<Node>, NodeKeyHash>& nodes, std::unordered_map<const Node*, std::size_t>& ids, NodeKey&& key, Args&&... args) {
+        if (const auto existingNode = nodes.find(key); existingNode != nodes.end()) {
+            ++nSharedNodes;
+            return existingNode->second;
+        }
+
+        std::shared_ptr<Node> node = std::allocate_shared<T>(NodeArenaAllocator<T>(arena), std::forward<Args>(args)...);
+        ids.emplace(node.get(), ids.size());
+        nodes.emplace(std::move(key), node);
+        return node;
+    }
+
+    template<typename Node>
+    std::size_t NodePool::getOrAssignId(std::unordered_map<const Node*, std::size_t>& ids, const std::shared_ptr<Node>& node) {
+        const auto [id, inserted] = ids.try_emplace(node.get(), ids.size());
+        if (inserted) {
+            externalNodes.emplace_back(node);
+        }
+        return id->second;
+    }
+
+    Number::ptr NodePool::number(const unsigned value) {
+        return intern<Number>(numbers, numberIds, {tag(NodeKind::ConstantNumber), value}, value);
+    }
+
+    Number::ptr NodePool::loopVariable(const std::string& name, const std::size_t slot) {
+        const std::size_t nameId = loopVariableIds.try_emplace(name, loopVariableIds.size()).first->second;
+        return intern<Number>(numbers, numberIds, {tag(NodeKind::LoopVariable), nameId, slot}, name, slot);
+    }
+
+    VariableAccess::ptr NodePool::variableAccess(const Variable::ptr& var, const std::optional<std::pair<Number::ptr, Number::ptr>>& range, const Expression::vec& indexes) {
+        NodeKey key;
+        key.reserve(4U + indexes.size());
+        key.emplace_back(tag(NodeKind::VariableAccess));
+        key.emplace_back(getOrAssignId(variableIds, var));
+        key.emplace_back(range.has_value() ? getOrAssignId(numberIds, range->first) : NO_NODE);
+        key.emplace_back(range.has_value() ? getOrAssignId(numberIds, range->second) : NO_NODE);
+        for (const auto& index: indexes) {
+            key.emplace_back(getOrAssignId(expressionIds, index));
+        }
+
+        const auto existingNode = variableAccesses.find(key);
+        if (existingNode != variableAccesses.end()) {
+            ++nSharedNodes;
+            return existingNode->second;
+        }
+
+        auto access = std::allocate_shared<VariableAccess>(NodeArenaAllocator<VariableAccess>(arena));
+        access->setVar(var);
+        access->range   = range;
+        access->indexes = indexes;
+        variableAccessIds.emplace(access.get(), variableAccessIds.size());
+        variableAccesses.emplace(std::move(key), access);
+        return access;
+    }
+
+    Expression::ptr NodePool::numericExpression(const Number::ptr& value, const unsigned bitwidth) {
+        return intern<NumericExpression>(expressions, expressionIds, {tag(NodeKind::NumericExpression), getOrAssignId(numberIds, value), bitwidth}, value, bitwidth);
+    }
+
+    Expression::ptr NodePool::variableExpression(const VariableAccess::ptr& var) {
+        return intern<VariableExpression>(expressions, expressionIds, {tag(NodeKind::VariableExpression), getOrAssignId(variableAccessIds, var)}, var);
+    }
+
+    Expression::ptr NodePool::binaryExpression(const Expression::ptr& lhs, const unsigned op, const Expression::ptr& rhs) {
+        return intern<BinaryExpression>(expressions, expressionIds, {tag(NodeKind::BinaryExpression), getOrAssignId(expressionIds, lhs), op, getOrAssignId(expressionIds, rhs)}, lhs, op, rhs);
+    }
+
+    Expression::ptr NodePool::shiftExpression(const Expression::ptr& lhs, const unsigned op, const Number::ptr& rhs) {
+        return intern<ShiftExpression>(expressions, expressionIds, {tag(NodeKind::ShiftExpression), getOrAssignId(expressionIds, lhs), op, getOrAssignId(numberIds, rhs)}, lhs, op, rhs);
+    }
+
+    std::optional<std::size_t> NodePool::getId(const Number& node) const {
+        if (const auto id = numberIds.find(&node); id != numberIds.end()) {
+            return id->second;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::size_t> NodePool::getId(const VariableAccess& node) const {
+        if (const auto id = variableAccessIds.find(&node); id != variableAccessIds.end()) {
+            return id->second;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<std::size_t> NodePool::getId(const Expression& node) const {
+        if (const auto id = expressionIds.find(&node); id != expressionIds.end()) {
+            return id->second;
+        }
+        return std::nullopt;
+    }
+} // namespace syrec
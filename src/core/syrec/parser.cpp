@@ -22,16 +22,306 @@
 #include <boost/variant/detail/apply_visitor_unary.hpp>
 #include <boost/variant/recursive_wrapper.hpp>
 #include <cassert>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
 
 namespace syrec {
+    unsigned parseNumericExpressionOperation(const std::string_view astOp) {
+        unsigned op = 0U;
+        if (astOp == "+") {
+            op = NumericExpression::Add;
+        } else if (astOp == "-") {
+            op = NumericExpression::Subtract;
+        } else if (astOp == "*") {
+            op = NumericExpression::Multiply;
+        } else if (astOp == "/") {
+            op = NumericExpression::Divide;
+        } else if (astOp == "%") {
+            op = NumericExpression::Modulo;
+        } else if (astOp == "&&") {
+            op = NumericExpression::LogicalAnd;
+        } else if (astOp == "||") {
+            op = NumericExpression::LogicalOr;
+        } else if (astOp == "&") {
+            op = NumericExpression::BitwiseAnd;
+        } else if (astOp == "|") {
+            op = NumericExpression::BitwiseOr;
+        } else if (astOp == ">") {
+            op = NumericExpression::GreaterThan;
+        } else if (astOp == "<") {
+            op = NumericExpression::LessThan;
+        } else if (astOp == ">=") {
+            op = NumericExpression::GreaterEquals;
+        } else if (astOp == "<=") {
+            op = NumericExpression::LessEquals;
+        } else if (astOp == "==") {
+            op = NumericExpression::Equals;
+        } else if (astOp == "!=") {
+            op = NumericExpression::NotEquals;
+        }
+        return op;
+    }
+
+    Number::ptr foldNumericExpression(const Number::ptr& lhs, const unsigned op, const Number::ptr& rhs, ParserContext& context) {
+        if (lhs->isConstant() && rhs->isConstant()) {
+            const auto lhsValue = lhs->evaluate(Number::loop_variable_values());
+            const auto rhsValue = rhs->evaluate(Number::loop_variable_values());
+            unsigned   numValue = 0;
+
+            switch (op) {
+                case NumericExpression::Add: // +
+                {
+                    numValue = lhsValue + rhsValue;
+                } break;
+
+                case NumericExpression::Subtract: // -
+                {
+                    numValue = lhsValue - rhsValue;
+                } break;
+
+                case NumericExpression::Multiply: // *
+                {
+                    numValue = lhsValue * rhsValue;
+                } break;
+
+                case NumericExpression::Divide: // /
+                {
+                    numValue = lhsValue / rhsValue;
+                } break;
+
+                case NumericExpression::Modulo: // /
+                {
+                    numValue = lhsValue % rhsValue;
+                } break;
+
+                case NumericExpression::LogicalAnd: // /
+                {
+                    numValue = static_cast<unsigned>((lhsValue != 0U) && (rhsValue != 0U));
+                } break;
+
+                case NumericExpression::LogicalOr: // /
+                {
+                    numValue = static_cast<unsigned>((lhsValue != 0U) || (rhsValue != 0U));
+                } break;
+
+                case NumericExpression::BitwiseAnd: // /
+                {
+                    numValue = lhsValue & rhsValue;
+                } break;
+
+                case NumericExpression::BitwiseOr: // /
+                {
+                    numValue = lhsValue | rhsValue;
+                } break;
+
+                case NumericExpression::LessThan: // /
+                {
+                    numValue = static_cast<unsigned int>(lhsValue < rhsValue);
+                } break;
+
+                case NumericExpression::GreaterThan: // /
+                {
+                    numValue = static_cast<unsigned int>(lhsValue > rhsValue);
+                } break;
+
+                case NumericExpression::GreaterEquals: // /
+                {
+                    numValue = static_cast<unsigned int>(lhsValue >= rhsValue);
+                } break;
+
+                case NumericExpression::LessEquals: // /
+                {
+                    numValue = static_cast<unsigned int>(lhsValue <= rhsValue);
+                } break;
+
+                case NumericExpression::Equals: // /
+                {
+                    numValue = static_cast<unsigned int>(lhsValue == rhsValue);
+                } break;
+
+                case NumericExpression::NotEquals: // /
+                {
+                    numValue = static_cast<unsigned int>(lhsValue != rhsValue);
+                } break;
+
+                default:
+                    return {};
+            }
+
+            return context.nodePool.number(numValue);
+        }
+        return context.nodePool.number(0);
+    }
+
+    unsigned parseBinaryExpressionOperation(const std::string_view astOp) {
+        unsigned op = 0U;
+        if (astOp == "+") {
+            op = BinaryExpression::Add;
+        } else if (astOp == "-") {
+            op = BinaryExpression::Subtract;
+        } else if (astOp == "^") {
+            op = BinaryExpression::Exor;
+        } else if (astOp == "*") {
+            op = BinaryExpression::Multiply;
+        } else if (astOp == "/") {
+            op = BinaryExpression::Divide;
+        } else if (astOp == "%") {
+            op = BinaryExpression::Modulo;
+        } else if (astOp == "*>") {
+            op = BinaryExpression::FracDivide;
+        } else if (astOp == "&") {
+            op = BinaryExpression::BitwiseAnd;
+        } else if (astOp == "|") {
+            op = BinaryExpression::BitwiseOr;
+        } else if (astOp == "&&") {
+            op = BinaryExpression::LogicalAnd;
+        } else if (astOp == "||") {
+            op = BinaryExpression::LogicalOr;
+        } else if (astOp == "<") {
+            op = BinaryExpression::LessThan;
+        } else if (astOp == ">") {
+            op = BinaryExpression::GreaterThan;
+        } else if (astOp == "=") {
+            op = BinaryExpression::Equals;
+        } else if (astOp == "!=") {
+            op = BinaryExpression::NotEquals;
+        } else if (astOp == "<=") {
+            op = BinaryExpression::LessEquals;
+        } else if (astOp == ">=") {
+            op = BinaryExpression::GreaterEquals;
+        }
+        return op;
+    }
+
+    unsigned parseShiftExpressionOperation(const std::string_view astOp) {
+        unsigned op = 0U;
+        if (astOp == "<<") {
+            op = ShiftExpression::Left;
+        } else if (astOp == ">>") {
+            op = ShiftExpression::Right;
+        }
+        return op;
+    }
+
+    Expression::ptr createShiftExpression(const Expression::ptr& lhs, const unsigned op, const Number::ptr& rhs, ParserContext& context) {
+        if (lhs->kind() == Expression::Kind::Numeric) {
+            if (const auto& lhsNo = static_cast<const NumericExpression&>(*lhs); lhsNo.value->isConstant() && rhs->isConstant()) {
+                const auto& value   = lhsNo.value->evaluate(Number::loop_variable_values());
+                const auto& shftAmt = rhs->evaluate(Number::loop_variable_values());
+                unsigned    result  = 0;
+
+                switch (op) {
+                    case ShiftExpression::Left: // <<
+                    {
+                        result = value << shftAmt;
+                    } break;
+
+                    case ShiftExpression::Right: // >>
+                    {
+                        result = value >> shftAmt;
+                    } break;
+
+                    default:
+                        std::cerr << "Invalid operator in shift expression\n";
+                        assert(false);
+                }
+                return context.nodePool.numericExpression(context.nodePool.number(result), lhs->bitwidth());
+            }
+        }
+
+        return context.nodePool.shiftExpression(lhs, op, rhs);
+    }
+
+    Statement::ptr createSwapStatement(const VariableAccess::ptr& va1, const VariableAccess::ptr& va2, ParserContext& context) {
+        if (va1->bitwidth() != va2->bitwidth()) {
+            std::cerr << "Different bit-widths in ↔ statement: " + va1->getVar()->name + " (" + std::to_string(va1->bitwidth()) + "), " + va2->getVar()->name + " (" + std::to_string(va2->bitwidth()) + ")\n";
+            assert(false);
+            return nullptr;
+        }
+
+        return context.nodePool.statement<SwapStatement>(va1, va2);
+    }
+
+    unsigned parseUnaryStatementOperation(const std::string_view astOp) {
+        unsigned op = 0U;
+
+        if (astOp == "~") {
+            op = UnaryStatement::Invert;
+        } else if (astOp == "++") {
+            op = UnaryStatement::Increment;
+        } else if (astOp == "--") {
+            op = UnaryStatement::Decrement;
+        }
+        return op;
+    }
+
+    unsigned parseAssignStatementOperation(const char astOp) {
+        unsigned op{};
+        if (astOp == '+') {
+            op = AssignStatement::Add;
+        } else if (astOp == '-') {
+            op = AssignStatement::Subtract;
+        } else {
+            op = AssignStatement::Exor;
+        }
+        return op;
+    }
+
+    Statement::ptr createAssignStatement(const VariableAccess::ptr& lhs, const unsigned op, const Expression::ptr& rhs, ParserContext& context) {
+        if (lhs->bitwidth() != rhs->bitwidth()) {
+            context.errorMessage = "Wrong bit-width in assignment to " + lhs->getVar()->name;
+            return nullptr;
+        }
+
+        return context.nodePool.statement<AssignStatement>(lhs, op, rhs);
+    }
+
+    Statement::ptr createCallStatement(const bool isCall, const Module::ptr& otherProc, const std::string& procName, const std::vector<std::string>& parameters, const Module& proc, ParserContext& context) {
+        // found no module
+        if (!static_cast<bool>(otherProc.get())) {
+            context.errorMessage = "Unknown module " + procName;
+            return nullptr;
+        }
+
+        // wrong number of parameters
+        if (parameters.size() != otherProc->parameters.size()) {
+            context.errorMessage = "Wrong number of arguments in (un)call of " + otherProc->name + ". Expected " + std::to_string(otherProc->parameters.size()) + ", got " + std::to_string(parameters.size());
+            return nullptr;
+        }
+
+        // unknown variable name in parameters
+        for (const std::string& parameter: parameters) {
+            if (!proc.findParameterOrVariable(parameter)) {
+                context.errorMessage = "Unknown variable " + parameter + " in (un)call of " + otherProc->name;
+                return nullptr;
+            }
+        }
+
+        // check whether bit-width fits
+        for (unsigned i = 0; i < parameters.size(); ++i) {
+            const auto& vOther    = otherProc->parameters.at(i);
+            const auto& parameter = proc.findParameterOrVariable(parameters.at(i)); // must exist (see above)
+
+            if (vOther->bitwidth != parameter->bitwidth) {
+                context.errorMessage = std::to_string(i + 1) + ". parameter (" + parameters.at(i) + ") in (un)call of " + otherProc->name + " has bit-width of " + std::to_string(parameter->bitwidth) + ", but " + std::to_string(vOther->bitwidth) + " is required";
+                return nullptr;
+            }
+        }
+
+        if (isCall) {
+            return context.nodePool.statement<CallStatement>(otherProc, parameters);
+        }
+        return context.nodePool.statement<UncallStatement>(otherProc, parameters);
+    }
 
     struct ParseNumberVisitor {
         explicit ParseNumberVisitor(const Module& proc, ParserContext& context):
@@ -39,7 +329,7 @@ namespace syrec {
             context(context) {}
 
         Number::ptr operator()(unsigned value) const {
-            return std::make_shared<Number>(value);
+            return context.nodePool.number(value);
         }
 
         Number::ptr operator()(const boost::recursive_wrapper<ast_variable>& astVar) const {
@@ -49,12 +339,12 @@ namespace syrec {
                 return {};
             }
 
-            return std::make_shared<Number>(var->bitwidth);
+            return context.nodePool.number(var->bitwidth);
         }
 
         Number::ptr operator()(const std::string& loopVariable) const {
-            if (std::find(context.loopVariables.begin(), context.loopVariables.end(), loopVariable) != context.loopVariables.end()) {
-                return std::make_shared<Number>(loopVariable);
+            if (const auto it = std::find(context.loopVariables.begin(), context.loopVariables.end(), loopVariable); it != context.loopVariables.end()) {
+                return context.nodePool.loopVariable(loopVariable, static_cast<std::size_t>(std::distance(context.loopVariables.begin(), it)));
             }
             context.errorMessage = "Unknown loop variable $" + loopVariable;
             return {};
@@ -65,41 +355,6 @@ namespace syrec {
             const auto& astOp  = astNe.get().op;
             const auto& astNo2 = astNe.get().operand2;
 
-            unsigned op = 0U;
-            if (astOp == "+") {
-                op = NumericExpression::Add;
-            } else if (astOp == "-") {
-                op = NumericExpression::Subtract;
-            } else if (astOp == "*") {
-                op = NumericExpression::Multiply;
-            } else if (astOp == "/") {
-                op = NumericExpression::Divide;
-            } else if (astOp == "%") {
-                op = NumericExpression::Modulo;
-            } else if (astOp == "&&") {
-                op = NumericExpression::LogicalAnd;
-            }
-
-            else if (astOp == "||") {
-                op = NumericExpression::LogicalOr;
-            } else if (astOp == "&") {
-                op = NumericExpression::BitwiseAnd;
-            } else if (astOp == "|") {
-                op = NumericExpression::BitwiseOr;
-            } else if (astOp == ">") {
-                op = NumericExpression::GreaterThan;
-            } else if (astOp == "<") {
-                op = NumericExpression::LessThan;
-            } else if (astOp == ">=") {
-                op = NumericExpression::GreaterEquals;
-            } else if (astOp == "<=") {
-                op = NumericExpression::LessEquals;
-            } else if (astOp == "==") {
-                op = NumericExpression::Equals;
-            } else if (astOp == "!=") {
-                op = NumericExpression::NotEquals;
-            }
-
             const auto& lhs = parseNumber(astNo1, proc, context);
             if (!lhs) {
                 return {};
@@ -109,94 +364,7 @@ namespace syrec {
             if (!rhs) {
                 return {};
             }
-            if (lhs->isConstant() && rhs->isConstant()) {
-                const auto lhsValue = lhs->evaluate(Number::loop_variable_mapping());
-                const auto rhsValue = rhs->evaluate(Number::loop_variable_mapping());
-                unsigned   numValue = 0;
-
-                switch (op) {
-                    case NumericExpression::Add: // +
-                    {
-                        numValue = lhsValue + rhsValue;
-                    } break;
-
-                    case NumericExpression::Subtract: // -
-                    {
-                        numValue = lhsValue - rhsValue;
-                    } break;
-
-                    case NumericExpression::Multiply: // *
-                    {
-                        numValue = lhsValue * rhsValue;
-                    } break;
-
-                    case NumericExpression::Divide: // /
-                    {
-                        numValue = lhsValue / rhsValue;
-                    } break;
-
-                    case NumericExpression::Modulo: // /
-                    {
-                        numValue = lhsValue % rhsValue;
-                    } break;
-
-                    case NumericExpression::LogicalAnd: // /
-                    {
-                        numValue = static_cast<unsigned>((lhsValue != 0U) && (rhsValue != 0U));
-                    } break;
-
-                    case NumericExpression::LogicalOr: // /
-                    {
-                        numValue = static_cast<unsigned>((lhsValue != 0U) || (rhsValue != 0U));
-                    } break;
-
-                    case NumericExpression::BitwiseAnd: // /
-                    {
-                        numValue = lhsValue & rhsValue;
-                    } break;
-
-                    case NumericExpression::BitwiseOr: // /
-                    {
-                        numValue = lhsValue | rhsValue;
-                    } break;
-
-                    case NumericExpression::LessThan: // /
-                    {
-                        numValue = static_cast<unsigned int>(lhsValue < rhsValue);
-                    } break;
-
-                    case NumericExpression::GreaterThan: // /
-                    {
-                        numValue = static_cast<unsigned int>(lhsValue > rhsValue);
-                    } break;
-
-                    case NumericExpression::GreaterEquals: // /
-                    {
-                        numValue = static_cast<unsigned int>(lhsValue >= rhsValue);
-                    } break;
-
-                    case NumericExpression::LessEquals: // /
-                    {
-                        numValue = static_cast<unsigned int>(lhsValue <= rhsValue);
-                    } break;
-
-                    case NumericExpression::Equals: // /
-                    {
-                        numValue = static_cast<unsigned int>(lhsValue == rhsValue);
-                    } break;
-
-                    case NumericExpression::NotEquals: // /
-                    {
-                        numValue = static_cast<unsigned int>(lhsValue != rhsValue);
-                    } break;
-
-                    default:
-                        return {};
-                }
-
-                return std::make_shared<Number>(numValue);
-            }
-            return std::make_shared<Number>(0);
+            return foldNumericExpression(lhs, parseNumericExpressionOperation(astOp), rhs, context);
         }
 
     private:
@@ -216,9 +384,6 @@ namespace syrec {
             return {};
         }
 
-        VariableAccess::ptr va(new VariableAccess());
-        va->setVar(var);
-
         std::optional<std::pair<Number::ptr, Number::ptr>> varRange;
 
         if (const auto& range = astVar.range) {
@@ -229,7 +394,7 @@ namespace syrec {
 
             // is in range?
             if (!first->isLoopVariable()) {
-                const auto bound = first->evaluate(Number::loop_variable_mapping());
+                const auto bound = first->evaluate(Number::loop_variable_values());
                 if (bound >= var->bitwidth) {
                     context.errorMessage = "Bound " + std::to_string(bound) + " out of range in variable " + var->name + "(" + std::to_string(var->bitwidth) + ")";
                     return {};
@@ -246,7 +411,7 @@ namespace syrec {
 
                 // is in range?
                 if (!second->isLoopVariable()) {
-                    const auto bound = second->evaluate(Number::loop_variable_mapping());
+                    const auto bound = second->evaluate(Number::loop_variable_values());
                     if (bound >= var->bitwidth) {
                         context.errorMessage = "Bound " + std::to_string(bound) + " out of range in variable " + var->name + "(" + std::to_string(var->bitwidth) + ")";
                         return {};
@@ -257,7 +422,6 @@ namespace syrec {
             varRange = std::make_pair(first, second);
         }
 
-        va->range = varRange;
 
         // indexes
         if (var->dimensions.size() != astVar.indexes.size()) {
@@ -273,9 +437,8 @@ namespace syrec {
             }
             indexes.emplace_back(index);
         }
-        va->indexes = indexes;
 
-        return va;
+        return context.nodePool.variableAccess(var, varRange, indexes);
     }
 
     struct ExpressionVisitor {
@@ -284,64 +447,27 @@ namespace syrec {
             bitwidth(bitwidth),
             context(context) {}
 
-        Expression* operator()(const ast_number& astNum) const {
+        Expression::ptr operator()(const ast_number& astNum) const {
             const auto num = parseNumber(astNum, proc, context);
             if (!num) {
                 return nullptr;
             }
-            return new NumericExpression(num, bitwidth);
+            return context.nodePool.numericExpression(num, bitwidth);
         }
 
-        Expression* operator()(const ast_variable& astVar) const {
+        Expression::ptr operator()(const ast_variable& astVar) const {
             const auto access = parseVariableAccess(astVar, proc, context);
             if (!access) {
                 return nullptr;
             }
-            return new VariableExpression(access);
+            return context.nodePool.variableExpression(access);
         }
 
-        Expression* operator()(const ast_binary_expression& astExp) const {
+        Expression::ptr operator()(const ast_binary_expression& astExp) const {
             const auto& astExp1 = astExp.operand1;
             const auto& astOp   = astExp.op;
             const auto& astExp2 = astExp.operand2;
 
-            unsigned op = 0U;
-            if (astOp == "+") {
-                op = BinaryExpression::Add;
-            } else if (astOp == "-") {
-                op = BinaryExpression::Subtract;
-            } else if (astOp == "^") {
-                op = BinaryExpression::Exor;
-            } else if (astOp == "*") {
-                op = BinaryExpression::Multiply;
-            } else if (astOp == "/") {
-                op = BinaryExpression::Divide;
-            } else if (astOp == "%") {
-                op = BinaryExpression::Modulo;
-            } else if (astOp == "*>") {
-                op = BinaryExpression::FracDivide;
-            } else if (astOp == "&") {
-                op = BinaryExpression::BitwiseAnd;
-            } else if (astOp == "|") {
-                op = BinaryExpression::BitwiseOr;
-            } else if (astOp == "&&") {
-                op = BinaryExpression::LogicalAnd;
-            } else if (astOp == "||") {
-                op = BinaryExpression::LogicalOr;
-            } else if (astOp == "<") {
-                op = BinaryExpression::LessThan;
-            } else if (astOp == ">") {
-                op = BinaryExpression::GreaterThan;
-            } else if (astOp == "=") {
-                op = BinaryExpression::Equals;
-            } else if (astOp == "!=") {
-                op = BinaryExpression::NotEquals;
-            } else if (astOp == "<=") {
-                op = BinaryExpression::LessEquals;
-            } else if (astOp == ">=") {
-                op = BinaryExpression::GreaterEquals;
-            }
-
             const auto& lhs = parseExpression(astExp1, proc, 0U, context);
             if (!lhs) {
                 return nullptr;
@@ -352,21 +478,14 @@ namespace syrec {
                 return nullptr;
             }
 
-            return new BinaryExpression(lhs, op, rhs);
+            return context.nodePool.binaryExpression(lhs, parseBinaryExpressionOperation(astOp), rhs);
         }
 
-        Expression* operator()(const ast_shift_expression& astExp) const {
+        Expression::ptr operator()(const ast_shift_expression& astExp) const {
             const auto& astExp1 = astExp.operand1;
             const auto& astOp   = astExp.op;
             const auto& astNum  = astExp.operand2;
 
-            unsigned op = 0U;
-            if (astOp == "<<") {
-                op = ShiftExpression::Left;
-            } else if (astOp == ">>") {
-                op = ShiftExpression::Right;
-            }
-
             const auto& lhs = parseExpression(astExp1, proc, bitwidth, context);
             if (!lhs) {
                 return nullptr;
@@ -377,32 +496,7 @@ namespace syrec {
                 return nullptr;
             }
 
-            if (auto const* lhsNo = dynamic_cast<NumericExpression*>(lhs.get())) {
-                if (lhsNo->value->isConstant() && rhs->isConstant()) {
-                    const auto& value   = lhsNo->value->evaluate(Number::loop_variable_mapping());
-                    const auto& shftAmt = rhs->evaluate(Number::loop_variable_mapping());
-                    unsigned    result  = 0;
-
-                    switch (op) {
-                        case ShiftExpression::Left: // <<
-                        {
-                            result = value << shftAmt;
-                        } break;
-
-                        case ShiftExpression::Right: // >>
-                        {
-                            result = value >> shftAmt;
-                        } break;
-
-                        default:
-                            std::cerr << "Invalid operator in shift expression\n";
-                            assert(false);
-                    }
-                    return new NumericExpression(std::make_shared<Number>(result), lhs->bitwidth());
-                }
-            }
-
-            return new ShiftExpression(lhs, op, rhs);
+            return createShiftExpression(lhs, parseShiftExpressionOperation(astOp), rhs, context);
         }
 
     private:
@@ -412,7 +506,7 @@ namespace syrec {
     };
 
     Expression::ptr parseExpression(const ast_expression& astExp, const Module& proc, unsigned bitwidth, ParserContext& context) {
-        return Expression::ptr(boost::apply_visitor(ExpressionVisitor(proc, bitwidth, context), astExp));
+        return boost::apply_visitor(ExpressionVisitor(proc, bitwidth, context), astExp);
     }
 
     struct StatementVisitor {
@@ -434,13 +528,7 @@ namespace syrec {
                 return nullptr;
             }
 
-            if (va1->bitwidth() != va2->bitwidth()) {
-                std::cerr << "Different bit-widths in ↔ statement: " + va1->getVar()->name + " (" + std::to_string(va1->bitwidth()) + "), " + va2->getVar()->name + " (" + std::to_string(va2->bitwidth()) + ")\n";
-                assert(false);
-                return nullptr;
-            }
-
-            return std::make_shared<SwapStatement>(va1, va2);
+            return createSwapStatement(va1, va2, context);
         }
 
         Statement::ptr operator()(const ast_unary_statement& astUnaryStat) const {
@@ -452,17 +540,7 @@ namespace syrec {
                 return nullptr;
             }
 
-            unsigned op = 0U;
-
-            if (astOp == "~") {
-                op = UnaryStatement::Invert;
-            } else if (astOp == "++") {
-                op = UnaryStatement::Increment;
-            } else if (astOp == "--") {
-                op = UnaryStatement::Decrement;
-            }
-
-            return std::make_shared<UnaryStatement>(op, var);
+            return context.nodePool.statement<UnaryStatement>(parseUnaryStatementOperation(astOp), var);
         }
 
         Statement::ptr operator()(const ast_assign_statement& astAssignStat) const {
@@ -475,30 +553,16 @@ namespace syrec {
                 return nullptr;
             }
 
-            unsigned op{};
-            if (astOp == '+') {
-                op = AssignStatement::Add;
-            } else if (astOp == '-') {
-                op = AssignStatement::Subtract;
-            } else {
-                op = AssignStatement::Exor;
-            }
-
             const auto& rhs = parseExpression(astExp, proc, lhs->bitwidth(), context);
             if (!rhs) {
                 return nullptr;
             }
 
-            if (lhs->bitwidth() != rhs->bitwidth()) {
-                context.errorMessage = "Wrong bit-width in assignment to " + lhs->getVar()->name;
-                return nullptr;
-            }
-
-            return std::make_shared<AssignStatement>(lhs, op, rhs);
+            return createAssignStatement(lhs, parseAssignStatementOperation(astOp), rhs, context);
         }
 
         Statement::ptr operator()(const ast_if_statement& astIfStat) const {
-            auto ifStat = std::make_shared<IfStatement>();
+            auto ifStat = context.nodePool.statement<IfStatement>();
 
             const auto& condition = parseExpression(astIfStat.condition, proc, 1U, context);
             if (!condition) {
@@ -532,7 +596,7 @@ namespace syrec {
         }
 
         Statement::ptr operator()(const ast_for_statement& astForStat) const {
-            auto forStat = std::make_shared<ForStatement>();
+            auto forStat = context.nodePool.statement<ForStatement>();
 
             Number::ptr from;
             const auto& to = parseNumber(astForStat.to, proc, context);
@@ -557,7 +621,8 @@ namespace syrec {
                         return nullptr;
                     }
 
-                    forStat->loopVariable = loopVariable;
+                    forStat->loopVariable     = loopVariable;
+                    forStat->loopVariableSlot = context.loopVariables.size();
 
                     context.loopVariables.emplace_back(loopVariable);
                 }
@@ -586,47 +651,11 @@ namespace syrec {
             const auto& procName  = boost::fusion::at_c<1>(astCallStat);
             const auto& otherProc = prog.findModule(procName);
 
-            // found no module
-            if (!static_cast<bool>(otherProc.get())) {
-                context.errorMessage = "Unknown module " + procName;
-                return nullptr;
-            }
-
-            const std::vector<std::string>& parameters = boost::fusion::at_c<2>(astCallStat);
-
-            // wrong number of parameters
-            if (parameters.size() != otherProc->parameters.size()) {
-                context.errorMessage = "Wrong number of arguments in (un)call of " + otherProc->name + ". Expected " + std::to_string(otherProc->parameters.size()) + ", got " + std::to_string(parameters.size());
-                return nullptr;
-            }
-
-            // unknown variable name in parameters
-            for (const std::string& parameter: parameters) {
-                if (!proc.findParameterOrVariable(parameter)) {
-                    context.errorMessage = "Unknown variable " + parameter + " in (un)call of " + otherProc->name;
-                    return nullptr;
-                }
-            }
-
-            // check whether bit-width fits
-            for (unsigned i = 0; i < parameters.size(); ++i) {
-                const auto& vOther    = otherProc->parameters.at(i);
-                const auto& parameter = proc.findParameterOrVariable(parameters.at(i)); // must exist (see above)
-
-                if (vOther->bitwidth != parameter->bitwidth) {
-                    context.errorMessage = std::to_string(i + 1) + ". parameter (" + parameters.at(i) + ") in (un)call of " + otherProc->name + " has bit-width of " + std::to_string(parameter->bitwidth) + ", but " + std::to_string(vOther->bitwidth) + " is required";
-                    return nullptr;
-                }
-            }
-
-            if (boost::fusion::at_c<0>(astCallStat) == "call") {
-                return std::make_shared<CallStatement>(otherProc, parameters);
-            }
-            return std::make_shared<UncallStatement>(otherProc, parameters);
+            return createCallStatement(boost::fusion::at_c<0>(astCallStat) == "call", otherProc, procName, boost::fusion::at_c<2>(astCallStat), proc, context);
         }
 
         Statement::ptr operator()(const std::string& astSkipStat [[maybe_unused]]) const {
-            return std::make_shared<SkipStatement>();
+            return context.nodePool.statement<SkipStatement>();
         }
 
     private:
@@ -637,7 +666,7 @@ namespace syrec {
 
     Statement::ptr parseStatement(const ast_statement& astStat, const Program& prog, const Module& proc, ParserContext& context) {
         if (auto stat = boost::apply_visitor(StatementVisitor(prog, proc, context), boost::fusion::at_c<1>(astStat))) {
-            context.currentLineNumber = static_cast<unsigned>(std::count(context.begin, boost::fusion::at_c<0>(astStat), '\n')) + 1U;
+            context.currentLineNumber = static_cast<unsigned>(std::count(context.begin, boost::fusion::at_c<0>(astStat), '\n')) + context.settings.firstLineNumber;
             stat->lineNumber          = context.currentLineNumber;
             return {stat};
         }
@@ -696,15 +725,22 @@ namespace syrec {
         return true;
     }
 
-    bool Program::readProgramFromString(const std::string& content, const ReadProgramSettings& settings, std::string& error) {
-        ast_program astProg;
-        if (!parseString(astProg, content)) {
+    bool Program::readProgramFromString(const std::string_view content, const ReadProgramSettings& settings, std::string& error) {
+        if (!settings.useSpiritGrammar) {
+            ParserContext context(settings, pool);
+            return parseProgram(*this, content, context, error);
+        }
+
+        // The abstract syntax tree refers to the program by iterators of a string
+        const std::string programString(content);
+        ast_program       astProg;
+        if (!parseString(astProg, programString)) {
             error = "PARSE_STRING_FAILED";
             return false;
         }
 
-        ParserContext context(settings);
-        context.begin = content.begin();
+        ParserContext context(settings, pool);
+        context.begin = programString.begin();
 
         // Modules
         for (const ast_module& astProc: astProg) {
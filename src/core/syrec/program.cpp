@@ -10,20 +10,87 @@
 
 #include "core/syrec/program.hpp"
 
+#include <cstddef>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace syrec {
+    namespace {
+        /**
+         * @brief Read-only content of a file
+         *
+         * Regular files are memory-mapped where supported. Otherwise, the file is read with a single read of its size or, if its size is unknown (e.g. for a pipe), until its end.
+         * The content of a file that cannot be opened is empty.
+         */
+        class FileContent {
+        public:
+            explicit FileContent(const std::string& filename) {
+#if !defined(_WIN32)
+                if (const int fd = ::open(filename.c_str(), O_RDONLY); fd >= 0) {
+                    if (struct stat status{}; ::fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0) {
+                        const auto size = static_cast<std::size_t>(status.st_size);
+                        if (void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0); mapping != MAP_FAILED) {
+                            ::madvise(mapping, size, MADV_SEQUENTIAL);
+                            content = std::string_view(static_cast<const char*>(mapping), size);
+                            mapped  = true;
+                        }
+                    }
+                    ::close(fd);
+                }
+                if (mapped) {
+                    return;
+                }
+#endif
+                std::ifstream is(filename, std::ios::in | std::ios::binary);
+                if (is.seekg(0, std::ios::end); is) {
+                    if (const auto size = is.tellg(); size > 0) {
+                        buffer.resize(static_cast<std::size_t>(size));
+                        is.seekg(0, std::ios::beg);
+                        is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                        buffer.resize(static_cast<std::size_t>(is.gcount()));
+                    }
+                } else {
+                    is.clear();
+                    buffer.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+                }
+                content = buffer;
+            }
 
-    bool Program::readFile(const std::string& filename, const ReadProgramSettings settings, std::string& error) {
-        std::string content;
-        std::string line;
+            ~FileContent() {
+#if !defined(_WIN32)
+                if (mapped) {
+                    ::munmap(const_cast<char*>(content.data()), content.size()); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+                }
+#endif
+            }
 
-        std::ifstream is;
-        is.open(filename.c_str(), std::ios::in);
+            FileContent(const FileContent&)            = delete;
+            FileContent& operator=(const FileContent&) = delete;
 
-        while (getline(is, line)) {
-            content += line + '\n';
-        }
+            [[nodiscard]] std::string_view view() const {
+                return content;
+            }
+
+        private:
+            std::string_view content;
+            std::string      buffer;
+            bool             mapped = false;
+        };
+    } // namespace
 
-        return readProgramFromString(content, settings, error);
+    bool Program::readFile(const std::string& filename, const ReadProgramSettings settings, std::string& error) {
+        const FileContent content(filename);
+        return readProgramFromString(content.view(), settings, error);
     }
 
     std::string Program::read(const std::string& filename, const ReadProgramSettings settings) {
@@ -33,4 +100,11 @@ namespace syrec {
         return {};
     }
 
+    std::string Program::readFromString(const std::string_view content, const ReadProgramSettings settings) {
+        if (std::string errorMessage; !(readProgramFromString(content, settings, errorMessage))) {
+            return errorMessage;
+        }
+        return {};
+    }
+
 } // namespace syrec
@@ -0,0 +1,846 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/lexer.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/parser.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    namespace {
+        /**
+         * @brief Recursive-descent parser creating the modules of a SyReC program in a single pass over its tokens
+         *
+         * The parser accepts the same programs as the Boost.Spirit grammar and reports the same errors. Since the Boost.Spirit grammar only checks the
+         * semantics of a program once its syntax was checked, a syntax error is reported even if it succeeds a semantic error. Semantic errors are thus only
+         * recorded while the parsing continues, with the first error in the order of the semantic checks of the Boost.Spirit grammar being reported. This
+         * order only differs from the order of the tokens for the fi-condition of an if statement, the range of a for statement and the bit range of a variable access.
+         */
+        class RecursiveDescentParser {
+        public:
+            RecursiveDescentParser(Program& prog, const std::string_view content, ParserContext& context):
+                prog(prog), context(context), lexer(content, context.settings.firstLineNumber) {
+                advance();
+            }
+
+            bool parse(std::string& error) {
+                if (token.kind == Token::Kind::EndOfInput) {
+                    return reportSyntaxError(token.offset, error);
+                }
+                while (token.kind != Token::Kind::EndOfInput) {
+                    if (const std::size_t moduleBegin = token.offset; !parseModule()) {
+                        return reportSyntaxError(moduleBegin, error);
+                    }
+                }
+
+                // Like for the Boost.Spirit grammar, the modules preceding the module with a semantic error are still added to the program
+                for (const auto& module: parsedModules) {
+                    prog.addModule(module);
+                }
+                if (semanticError.has_value()) {
+                    error = "In line " + std::to_string(semanticError->lineNumber) + ": " + semanticError->message;
+                    return false;
+                }
+                return true;
+            }
+
+        private:
+            struct SemanticError {
+                std::string message;
+                unsigned    lineNumber;
+            };
+
+            struct State {
+                Lexer lexer;
+                Token token;
+            };
+
+            Program&       prog;    // NOLINT(*-avoid-const-or-ref-data-members)
+            ParserContext& context; // NOLINT(*-avoid-const-or-ref-data-members)
+            Lexer          lexer;
+            Token          token;
+
+            bool                         checkOnly = false; // Whether only the syntax is checked, e.g. to decide between alternatives of the grammar
+            std::optional<SemanticError> semanticError;
+            Module::vec                  parsedModules;
+
+            void advance() {
+                token = lexer.next();
+            }
+
+            [[nodiscard]] State save() const {
+                return {lexer, token};
+            }
+
+            void restore(const State& state) {
+                lexer = state.lexer;
+                token = state.token;
+            }
+
+            [[nodiscard]] Token peek(const std::size_t n = 1) const {
+                Lexer lookahead = lexer;
+                Token peeked    = token;
+                for (std::size_t i = 0; i < n; ++i) {
+                    peeked = lookahead.next();
+                }
+                return peeked;
+            }
+
+            bool accept(const Token::Kind kind) {
+                if (token.kind != kind) {
+                    return false;
+                }
+                advance();
+                return true;
+            }
+
+            [[nodiscard]] bool isKeyword(const std::string_view keyword) const {
+                return token.kind == Token::Kind::Identifier && token.text == keyword;
+            }
+
+            bool acceptKeyword(const std::string_view keyword) {
+                if (!isKeyword(keyword)) {
+                    return false;
+                }
+                advance();
+                return true;
+            }
+
+            bool acceptIdentifier(std::string_view& identifier) {
+                if (token.kind != Token::Kind::Identifier && token.kind != Token::Kind::Number) {
+                    return false;
+                }
+                identifier = token.text;
+                advance();
+                return true;
+            }
+
+            // The names of variables must not start with the keyword introducing the next module
+            bool acceptVariableName(std::string_view& name) {
+                return token.text.substr(0, 6) != "module" && acceptIdentifier(name);
+            }
+
+            bool acceptUnsigned(unsigned& value) {
+                if (token.kind != Token::Kind::Number) {
+                    return false;
+                }
+                if (const auto [end, errorCode] = std::from_chars(token.text.data(), token.text.data() + token.text.size(), value); errorCode != std::errc{} || end != token.text.data() + token.text.size()) {
+                    return false;
+                }
+                advance();
+                return true;
+            }
+
+            bool reportSyntaxError(const std::size_t offset, std::string& error) const {
+                std::cerr << "ERROR AT: " << lexer.remainder(offset) << std::endl;
+                error = "PARSE_STRING_FAILED";
+                return false;
+            }
+
+            [[nodiscard]] bool isCreatingNodes() const {
+                return !checkOnly && !semanticError.has_value();
+            }
+
+            void reportSemanticError(const std::string& message) {
+                if (!semanticError.has_value()) {
+                    semanticError = SemanticError{message, context.currentLineNumber};
+                }
+            }
+
+            void reportSemanticError(std::optional<SemanticError> error) {
+                if (!semanticError.has_value()) {
+                    semanticError = std::move(error);
+                }
+            }
+
+            // Parses a part of the program whose semantic errors are only reported if no semantic error is found in the parts checked before it by the Boost.Spirit grammar
+            template<typename Parse>
+            bool parseWithSeparateSemanticErrors(Parse&& parse, std::optional<SemanticError>& separateError) {
+                if (semanticError.has_value()) {
+                    return parse();
+                }
+                const bool syntaxOk = parse();
+                separateError       = std::exchange(semanticError, std::nullopt);
+                return syntaxOk;
+            }
+
+            template<typename Parse>
+            bool checkSyntax(Parse&& parse) {
+                const bool wasCheckOnly = std::exchange(checkOnly, true);
+                const bool syntaxOk     = parse();
+                checkOnly               = wasCheckOnly;
+                return syntaxOk;
+            }
+
+            [[nodiscard]] Module::ptr findModule(const std::string& name) const {
+                if (auto module = prog.findModule(name)) {
+                    return module;
+                }
+                const auto parsedModule = std::find_if(parsedModules.cbegin(), parsedModules.cend(), [&name](const Module::ptr& module) { return module->name == name; });
+                return parsedModule != parsedModules.cend() ? *parsedModule : Module::ptr();
+            }
+
+            static bool isNumericExpressionOperation(const Token::Kind kind) {
+                switch (kind) {
+                    case Token::Kind::Plus:
+                    case Token::Kind::Minus:
+                    case Token::Kind::Star:
+                    case Token::Kind::Slash:
+                    case Token::Kind::Percent:
+                    case Token::Kind::LogicalAnd:
+                    case Token::Kind::LogicalOr:
+                    case Token::Kind::Ampersand:
+                    case Token::Kind::Pipe:
+                    case Token::Kind::GreaterEquals:
+                    case Token::Kind::LessEquals:
+                    case Token::Kind::Greater:
+                    case Token::Kind::Less:
+                    case Token::Kind::Equals:
+                    case Token::Kind::NotEquals:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            static bool isBinaryExpressionOperation(const Token::Kind kind) {
+                switch (kind) {
+                    case Token::Kind::Plus:
+                    case Token::Kind::Minus:
+                    case Token::Kind::Caret:
+                    case Token::Kind::Star:
+                    case Token::Kind::Slash:
+                    case Token::Kind::Percent:
+                    case Token::Kind::LogicalAnd:
+                    case Token::Kind::LogicalOr:
+                    case Token::Kind::Ampersand:
+                    case Token::Kind::Pipe:
+                    case Token::Kind::LessEquals:
+                    case Token::Kind::GreaterEquals:
+                    case Token::Kind::Assign:
+                    case Token::Kind::NotEquals:
+                    case Token::Kind::Less:
+                    case Token::Kind::Greater:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            bool parseNumber(const Module& module, Number::ptr& number) {
+                number = nullptr;
+                switch (token.kind) {
+                    case Token::Kind::Number: {
+                        unsigned value = 0;
+                        if (!acceptUnsigned(value)) {
+                            return false;
+                        }
+                        if (isCreatingNodes()) {
+                            number = context.nodePool.number(value);
+                        }
+                        return true;
+                    }
+                    case Token::Kind::Hash: {
+                        // Only the name of the variable whose bit-width is used as number is checked
+                        advance();
+                        const std::string_view name = token.text;
+                        if (VariableAccess::ptr unusedAccess; !checkSyntax([&] { return parseVariableAccess(module, unusedAccess); })) {
+                            return false;
+                        }
+                        if (isCreatingNodes()) {
+                            const auto var = module.findParameterOrVariable(std::string(name));
+                            if (!var) {
+                                reportSemanticError("Unknown variable " + std::string(name));
+                                return true;
+                            }
+                            number = context.nodePool.number(var->bitwidth);
+                        }
+                        return true;
+                    }
+                    case Token::Kind::Dollar: {
+                        advance();
+                        std::string_view loopVariable;
+                        if (!acceptIdentifier(loopVariable)) {
+                            return false;
+                        }
+                        if (isCreatingNodes()) {
+                            if (const auto it = std::find(context.loopVariables.begin(), context.loopVariables.end(), loopVariable); it != context.loopVariables.end()) {
+                                number = context.nodePool.loopVariable(std::string(loopVariable), static_cast<std::size_t>(std::distance(context.loopVariables.begin(), it)));
+                            } else {
+                                reportSemanticError("Unknown loop variable $" + std::string(loopVariable));
+                            }
+                        }
+                        return true;
+                    }
+                    case Token::Kind::LeftParenthesis: {
+                        advance();
+                        Number::ptr lhs;
+                        if (!parseNumber(module, lhs) || !isNumericExpressionOperation(token.kind)) {
+                            return false;
+                        }
+                        const std::string_view op = token.text;
+                        advance();
+                        Number::ptr rhs;
+                        if (!parseNumber(module, rhs) || !accept(Token::Kind::RightParenthesis)) {
+                            return false;
+                        }
+                        if (isCreatingNodes()) {
+                            number = foldNumericExpression(lhs, parseNumericExpressionOperation(op), rhs, context);
+                        }
+                        return true;
+                    }
+                    default:
+                        return false;
+                }
+            }
+
+            bool parseVariableAccess(const Module& module, VariableAccess::ptr& access) {
+                access = nullptr;
+                std::string_view name;
+                if (!acceptVariableName(name)) {
+                    return false;
+                }
+
+                Variable::ptr var;
+                if (isCreatingNodes()) {
+                    var = module.findParameterOrVariable(std::string(name));
+                    if (!var) {
+                        reportSemanticError("Unknown variable %s" + std::string(name));
+                    }
+                }
+
+                // The indexes are checked after the range and the number of indexes
+                Expression::vec              indexes;
+                std::optional<SemanticError> errorOfIndexes;
+                const auto                   parseIndexes = [&] {
+                    while (accept(Token::Kind::LeftBracket)) {
+                        Expression::ptr index;
+                        if (!parseExpression(module, var ? var->bitwidth : 0U, index) || !accept(Token::Kind::RightBracket)) {
+                            return false;
+                        }
+                        indexes.emplace_back(index);
+                    }
+                    return true;
+                };
+                if (!parseWithSeparateSemanticErrors(parseIndexes, errorOfIndexes)) {
+                    return false;
+                }
+
+                std::optional<std::pair<Number::ptr, Number::ptr>> varRange;
+                if (accept(Token::Kind::Dot)) {
+                    const auto parseBound = [&](Number::ptr& bound) {
+                        if (!parseNumber(module, bound)) {
+                            return false;
+                        }
+                        if (isCreatingNodes() && !bound->isLoopVariable()) {
+                            if (const auto value = bound->evaluate(Number::loop_variable_values()); value >= var->bitwidth) {
+                                reportSemanticError("Bound " + std::to_string(value) + " out of range in variable " + var->name + "(" + std::to_string(var->bitwidth) + ")");
+                            }
+                        }
+                        return true;
+                    };
+
+                    Number::ptr first;
+                    if (!parseBound(first)) {
+                        return false;
+                    }
+                    Number::ptr second = first;
+                    if (accept(Token::Kind::Colon) && !parseBound(second)) {
+                        return false;
+                    }
+                    varRange = std::make_pair(first, second);
+                }
+
+                if (isCreatingNodes() && var->dimensions.size() != indexes.size()) {
+                    reportSemanticError("Invalid number of array indexes in variable " + var->name + ". Expected " + std::to_string(var->dimensions.size()) + ", got " + std::to_string(indexes.size()));
+                }
+                reportSemanticError(std::move(errorOfIndexes));
+
+                if (isCreatingNodes()) {
+                    access = context.nodePool.variableAccess(var, varRange, indexes);
+                }
+                return true;
+            }
+
+            bool parseExpression(const Module& module, const unsigned bitwidth, Expression::ptr& expression) {
+                expression = nullptr;
+                switch (token.kind) {
+                    case Token::Kind::Identifier: {
+                        VariableAccess::ptr access;
+                        if (!parseVariableAccess(module, access)) {
+                            return false;
+                        }
+                        if (isCreatingNodes()) {
+                            expression = context.nodePool.variableExpression(access);
+                        }
+                        return true;
+                    }
+                    case Token::Kind::LeftParenthesis: {
+                        // A parenthesized numeric expression takes precedence over a binary expression
+                        if (const State state = save(); !checkSyntax([&] { Number::ptr unusedNumber; return parseNumber(module, unusedNumber); })) {
+                            restore(state);
+                            return parseBinaryOrShiftExpression(module, bitwidth, expression);
+                        } else {
+                            restore(state);
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+
+                Number::ptr number;
+                if (!parseNumber(module, number)) {
+                    return false;
+                }
+                if (isCreatingNodes()) {
+                    expression = context.nodePool.numericExpression(number, bitwidth);
+                }
+                return true;
+            }
+
+            bool parseBinaryOrShiftExpression(const Module& module, const unsigned bitwidth, Expression::ptr& expression) {
+                if (!accept(Token::Kind::LeftParenthesis)) {
+                    return false;
+                }
+                Expression::ptr lhs;
+                if (!parseExpression(module, 0U, lhs)) {
+                    return false;
+                }
+
+                const std::string_view op = token.text;
+                if (token.kind == Token::Kind::ShiftLeft || token.kind == Token::Kind::ShiftRight) {
+                    advance();
+                    Number::ptr rhs;
+                    if (!parseNumber(module, rhs) || !accept(Token::Kind::RightParenthesis)) {
+                        return false;
+                    }
+                    if (isCreatingNodes()) {
+                        // The operand of a shift expression is parsed with the bit-width of the shift expression, which only affects numeric operands
+                        if (lhs->kind() == Expression::Kind::Numeric) {
+                            lhs = context.nodePool.numericExpression(static_cast<const NumericExpression&>(*lhs).value, bitwidth);
+                        }
+                        expression = createShiftExpression(lhs, parseShiftExpressionOperation(op), rhs, context);
+                    }
+                    return true;
+                }
+
+                if (!isBinaryExpressionOperation(token.kind)) {
+                    return false;
+                }
+                advance();
+                Expression::ptr rhs;
+                if (!parseExpression(module, isCreatingNodes() ? lhs->bitwidth() : 0U, rhs) || !accept(Token::Kind::RightParenthesis)) {
+                    return false;
+                }
+                if (isCreatingNodes()) {
+                    expression = context.nodePool.binaryExpression(lhs, parseBinaryExpressionOperation(op), rhs);
+                }
+                return true;
+            }
+
+            // Whether the current identifier starts a swap or an assign statement, which take precedence over the statements starting with a keyword
+            [[nodiscard]] bool isVariableStatementAhead() const {
+                const Token next = peek();
+                switch (next.kind) {
+                    case Token::Kind::LeftBracket:
+                    case Token::Kind::Dot:
+                    case Token::Kind::Swap:
+                        return true;
+                    case Token::Kind::Caret:
+                    case Token::Kind::Plus:
+                    case Token::Kind::Minus:
+                        return peek(2).kind == Token::Kind::Assign;
+                    default:
+                        return false;
+                }
+            }
+
+            [[nodiscard]] bool isStatementAhead() const {
+                switch (token.kind) {
+                    case Token::Kind::Tilde:
+                    case Token::Kind::Increment:
+                    case Token::Kind::Decrement:
+                        return true;
+                    case Token::Kind::Identifier:
+                        if (token.text.substr(0, 6) == "module") {
+                            return false;
+                        }
+                        return isVariableStatementAhead() || isKeyword("if") || isKeyword("for") || isKeyword("call") || isKeyword("uncall") || isKeyword("skip");
+                    default:
+                        return false;
+                }
+            }
+
+            bool parseStatements(const Module& module, Statement::vec& statements) {
+                do {
+                    Statement::ptr statement;
+                    if (!parseStatement(module, statement)) {
+                        return false;
+                    }
+                    if (statement) {
+                        statements.emplace_back(statement);
+                    }
+                } while (isStatementAhead());
+                return true;
+            }
+
+            bool parseStatement(const Module& module, Statement::ptr& statement) {
+                statement                 = nullptr;
+                const unsigned lineNumber = token.lineNumber;
+
+                bool syntaxOk = false;
+                if (token.kind == Token::Kind::Tilde || token.kind == Token::Kind::Increment || token.kind == Token::Kind::Decrement) {
+                    syntaxOk = parseUnaryStatement(module, statement);
+                } else if (token.kind != Token::Kind::Identifier || isVariableStatementAhead()) {
+                    syntaxOk = parseSwapOrAssignStatement(module, statement);
+                } else if (isKeyword("if")) {
+                    syntaxOk = parseIfStatement(module, statement);
+                } else if (isKeyword("for")) {
+                    syntaxOk = parseForStatement(module, statement);
+                } else if (isKeyword("call") || isKeyword("uncall")) {
+                    syntaxOk = parseCallStatement(module, statement);
+                } else if (acceptKeyword("skip")) {
+                    syntaxOk = true;
+                    if (isCreatingNodes()) {
+                        statement = context.nodePool.statement<SkipStatement>();
+                    }
+                } else {
+                    syntaxOk = parseSwapOrAssignStatement(module, statement);
+                }
+
+                if (syntaxOk && statement) {
+                    context.currentLineNumber = lineNumber;
+                    statement->lineNumber     = lineNumber;
+                }
+                return syntaxOk;
+            }
+
+            // Reports the error of a semantic check shared with the Boost.Spirit grammar if the check failed
+            void reportFailedCheck(const Statement::ptr& statement) {
+                if (!statement) {
+                    reportSemanticError(context.errorMessage);
+                }
+            }
+
+            bool parseUnaryStatement(const Module& module, Statement::ptr& statement) {
+                const std::string_view op = token.text;
+                advance();
+                VariableAccess::ptr var;
+                if (!accept(Token::Kind::Assign) || !parseVariableAccess(module, var)) {
+                    return false;
+                }
+                if (isCreatingNodes()) {
+                    statement = context.nodePool.statement<UnaryStatement>(parseUnaryStatementOperation(op), var);
+                }
+                return true;
+            }
+
+            bool parseSwapOrAssignStatement(const Module& module, Statement::ptr& statement) {
+                VariableAccess::ptr lhs;
+                if (!parseVariableAccess(module, lhs)) {
+                    return false;
+                }
+
+                if (accept(Token::Kind::Swap)) {
+                    VariableAccess::ptr rhs;
+                    if (!parseVariableAccess(module, rhs)) {
+                        return false;
+                    }
+                    if (isCreatingNodes()) {
+                        context.errorMessage.clear();
+                        statement = createSwapStatement(lhs, rhs, context);
+                        reportFailedCheck(statement);
+                    }
+                    return true;
+                }
+
+                if (token.kind != Token::Kind::Caret && token.kind != Token::Kind::Plus && token.kind != Token::Kind::Minus) {
+                    return false;
+                }
+                const char op = token.text.front();
+                advance();
+                Expression::ptr rhs;
+                if (!accept(Token::Kind::Assign) || !parseExpression(module, isCreatingNodes() ? lhs->bitwidth() : 0U, rhs)) {
+                    return false;
+                }
+                if (isCreatingNodes()) {
+                    context.errorMessage.clear();
+                    statement = createAssignStatement(lhs, parseAssignStatementOperation(op), rhs, context);
+                    reportFailedCheck(statement);
+                }
+                return true;
+            }
+
+            bool parseIfStatement(const Module& module, Statement::ptr& statement) {
+                advance();
+                Expression::ptr condition;
+                if (!parseExpression(module, 1U, condition) || !acceptKeyword("then")) {
+                    return false;
+                }
+
+                // The fi-condition is checked before the statements of both branches
+                Statement::vec               thenStatements;
+                Statement::vec               elseStatements;
+                std::optional<SemanticError> errorOfBranches;
+                const unsigned               lineNumberBeforeBranches = context.currentLineNumber;
+                if (!parseWithSeparateSemanticErrors([&] { return parseStatements(module, thenStatements) && acceptKeyword("else") && parseStatements(module, elseStatements); }, errorOfBranches) || !acceptKeyword("fi")) {
+                    return false;
+                }
+
+                const unsigned  lineNumberAfterBranches = std::exchange(context.currentLineNumber, lineNumberBeforeBranches);
+                Expression::ptr fiCondition;
+                if (!parseExpression(module, 1U, fiCondition)) {
+                    return false;
+                }
+                context.currentLineNumber = lineNumberAfterBranches;
+                reportSemanticError(std::move(errorOfBranches));
+
+                if (isCreatingNodes()) {
+                    auto ifStat = context.nodePool.statement<IfStatement>();
+                    ifStat->setCondition(condition);
+                    ifStat->setFiCondition(fiCondition);
+                    for (const auto& thenStatement: thenStatements) {
+                        ifStat->addThenStatement(thenStatement);
+                    }
+                    for (const auto& elseStatement: elseStatements) {
+                        ifStat->addElseStatement(elseStatement);
+                    }
+                    statement = ifStat;
+                }
+                return true;
+            }
+
+            bool parseForStatement(const Module& module, Statement::ptr& statement) {
+                advance();
+
+                // The end of the range is checked before its start
+                std::string_view             loopVariable;
+                Number::ptr                  from;
+                Number::ptr                  to;
+                std::optional<SemanticError> errorOfFrom;
+                std::optional<SemanticError> errorOfTo;
+                if (token.kind == Token::Kind::Dollar && peek().kind == Token::Kind::Identifier && peek(2).kind == Token::Kind::Assign) {
+                    advance();
+                    loopVariable = token.text;
+                    advance();
+                    advance();
+                    if (!parseWithSeparateSemanticErrors([&] { return parseNumber(module, from); }, errorOfFrom) || !acceptKeyword("to")) {
+                        return false;
+                    }
+                    if (!parseWithSeparateSemanticErrors([&] { return parseNumber(module, to); }, errorOfTo)) {
+                        return false;
+                    }
+                } else {
+                    Number::ptr                  number;
+                    std::optional<SemanticError> errorOfNumber;
+                    if (!parseWithSeparateSemanticErrors([&] { return parseNumber(module, number); }, errorOfNumber)) {
+                        return false;
+                    }
+                    if (acceptKeyword("to")) {
+                        from        = number;
+                        errorOfFrom = std::move(errorOfNumber);
+                        if (!parseWithSeparateSemanticErrors([&] { return parseNumber(module, to); }, errorOfTo)) {
+                            return false;
+                        }
+                    } else {
+                        to        = number;
+                        errorOfTo = std::move(errorOfNumber);
+                    }
+                }
+                reportSemanticError(std::move(errorOfTo));
+                reportSemanticError(std::move(errorOfFrom));
+
+                // Like for the Boost.Spirit grammar, the step is only checked syntactically
+                if (acceptKeyword("step")) {
+                    accept(Token::Kind::Minus);
+                    if (Number::ptr unusedStep; !checkSyntax([&] { return parseNumber(module, unusedStep); })) {
+                        return false;
+                    }
+                }
+                if (!acceptKeyword("do")) {
+                    return false;
+                }
+
+                bool isLoopVariableBound = false;
+                if (!loopVariable.empty() && isCreatingNodes()) {
+                    if (std::find(context.loopVariables.begin(), context.loopVariables.end(), loopVariable) != context.loopVariables.end()) {
+                        reportSemanticError("Redefinition of loop variable $" + std::string(loopVariable));
+                    } else {
+                        context.loopVariables.emplace_back(loopVariable);
+                        isLoopVariableBound = true;
+                    }
+                }
+
+                Statement::vec doStatements;
+                const bool     syntaxOk = parseStatements(module, doStatements) && acceptKeyword("rof");
+                if (isLoopVariableBound) {
+                    // release loop variable
+                    context.loopVariables.erase(std::remove_if(context.loopVariables.begin(), context.loopVariables.end(), [&loopVariable](const auto& s) { return s == loopVariable; }), context.loopVariables.end());
+                }
+                if (!syntaxOk) {
+                    return false;
+                }
+
+                if (isCreatingNodes()) {
+                    auto forStat   = context.nodePool.statement<ForStatement>();
+                    forStat->range = std::make_pair(from, to);
+                    if (isLoopVariableBound) {
+                        forStat->loopVariable     = std::string(loopVariable);
+                        forStat->loopVariableSlot = context.loopVariables.size();
+                    }
+                    for (const auto& doStatement: doStatements) {
+                        forStat->addStatement(doStatement);
+                    }
+                    statement = forStat;
+                }
+                return true;
+            }
+
+            bool parseCallStatement(const Module& module, Statement::ptr& statement) {
+                const bool isCall = isKeyword("call");
+                advance();
+                std::string_view procName;
+                if (!acceptIdentifier(procName)) {
+                    return false;
+                }
+
+                std::vector<std::string> parameters;
+                if (accept(Token::Kind::LeftParenthesis)) {
+                    std::string_view parameter;
+                    if (acceptIdentifier(parameter)) {
+                        parameters.emplace_back(parameter);
+                        while (accept(Token::Kind::Comma)) {
+                            if (!acceptIdentifier(parameter)) {
+                                return false;
+                            }
+                            parameters.emplace_back(parameter);
+                        }
+                    }
+                    if (!accept(Token::Kind::RightParenthesis)) {
+                        return false;
+                    }
+                }
+
+                if (isCreatingNodes()) {
+                    const std::string name(procName);
+                    context.errorMessage.clear();
+                    statement = createCallStatement(isCall, findModule(name), name, parameters, module, context);
+                    reportFailedCheck(statement);
+                }
+                return true;
+            }
+
+            bool parseVariableDeclaration(std::string_view& name, std::vector<unsigned>& dimensions, std::optional<unsigned>& bitwidth) {
+                if (!acceptVariableName(name)) {
+                    return false;
+                }
+                while (accept(Token::Kind::LeftBracket)) {
+                    unsigned dimension = 0;
+                    if (!acceptUnsigned(dimension) || !accept(Token::Kind::RightBracket)) {
+                        return false;
+                    }
+                    dimensions.emplace_back(dimension);
+                }
+                if (accept(Token::Kind::LeftParenthesis)) {
+                    unsigned value = 0;
+                    if (!acceptUnsigned(value) || !accept(Token::Kind::RightParenthesis)) {
+                        return false;
+                    }
+                    bitwidth = value;
+                }
+                return true;
+            }
+
+            bool parseModule() {
+                std::string_view name;
+                if (!acceptKeyword("module") || !acceptIdentifier(name) || !accept(Token::Kind::LeftParenthesis)) {
+                    return false;
+                }
+
+                const auto            module = std::make_shared<Module>(std::string(name));
+                std::set<std::string> variableNames;
+                if (token.kind != Token::Kind::RightParenthesis) {
+                    do {
+                        if (!isKeyword("inout") && !isKeyword("in") && !isKeyword("out")) {
+                            return false;
+                        }
+                        const std::string type(token.text);
+                        advance();
+
+                        std::string_view        variableName;
+                        std::vector<unsigned>   dimensions;
+                        std::optional<unsigned> bitwidth;
+                        if (!parseVariableDeclaration(variableName, dimensions, bitwidth)) {
+                            return false;
+                        }
+                        if (isCreatingNodes()) {
+                            if (!variableNames.emplace(variableName).second) {
+                                reportSemanticError("Redefinition of variable " + std::string(variableName));
+                            } else {
+                                module->addParameter(std::make_shared<Variable>(parseVariableType(type), std::string(variableName), dimensions, bitwidth.value_or(context.settings.defaultBitwidth)));
+                            }
+                        }
+                    } while (accept(Token::Kind::Comma));
+                }
+                if (!accept(Token::Kind::RightParenthesis)) {
+                    return false;
+                }
+
+                // Like for the Boost.Spirit grammar, the declarations of local variables are only checked syntactically
+                while ((isKeyword("state") || isKeyword("wire")) && peek().kind == Token::Kind::Identifier) {
+                    advance();
+                    do {
+                        std::string_view        variableName;
+                        std::vector<unsigned>   dimensions;
+                        std::optional<unsigned> bitwidth;
+                        if (!parseVariableDeclaration(variableName, dimensions, bitwidth)) {
+                            return false;
+                        }
+                    } while (accept(Token::Kind::Comma));
+                }
+
+                Statement::vec statements;
+                if (!parseStatements(*module, statements) || (token.kind != Token::Kind::EndOfInput && !isKeyword("module"))) {
+                    return false;
+                }
+                if (isCreatingNodes()) {
+                    for (const auto& statement: statements) {
+                        module->addStatement(statement);
+                    }
+                    parsedModules.emplace_back(module);
+                }
+                return true;
+            }
+        };
+    } // namespace
+
+    bool parseProgram(Program& prog, const std::string_view content, ParserContext& context, std::string& error) {
+        return RecursiveDescentParser(prog, content, context).parse(error);
+    }
+} // namespace syrec
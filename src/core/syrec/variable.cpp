@@ -55,8 +55,8 @@ namespace syrec {
                 assert(false);
             }
 
-            Number::loop_variable_mapping const map; // empty map
-            return static_cast<unsigned>(std::abs(static_cast<int>(first->evaluate(map) - second->evaluate(map)))) + 1U;
+            Number::loop_variable_values const values; // no loop variables
+            return static_cast<unsigned>(std::abs(static_cast<int>(first->evaluate(values) - second->evaluate(values)))) + 1U;
         }
         return var->bitwidth;
     }
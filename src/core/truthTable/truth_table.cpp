@@ -14,17 +14,63 @@
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <map>
 #include <utility>
 #include <vector>
 
 namespace syrec {
 
+    auto TruthTable::Cube::reserveWords(const std::size_t n) -> void {
+        const auto capacity = capacityWords();
+        const auto required = nWordsFor(n);
+        if (required <= capacity) {
+            return;
+        }
+        const auto        newCapacity = std::max(required, 2U * capacity);
+        std::vector<Word> words(2U * newCapacity, 0U);
+        const auto* const values = valueWords();
+        const auto* const cares  = careWords();
+        std::copy(values, values + capacity, words.begin());
+        std::copy(cares, cares + capacity, words.begin() + static_cast<std::ptrdiff_t>(newCapacity));
+        heapWords = std::move(words);
+        inlineWords.fill(0U);
+    }
+
+    auto TruthTable::Cube::clearFrom(const std::size_t pos) -> void {
+        auto* const values = valueWords();
+        auto* const cares  = careWords();
+        auto        word   = pos / WORD_BITS;
+        if (pos % WORD_BITS != 0U) {
+            values[word] &= lastWordMask(pos);
+            cares[word] &= lastWordMask(pos);
+            ++word;
+        }
+        for (; word < nWords(); ++word) {
+            values[word] = 0U;
+            cares[word]  = 0U;
+        }
+    }
+
+    auto TruthTable::Cube::insertZero() -> void {
+        reserveWords(nBits + 1U);
+        ++nBits;
+        // shift all positions by one towards the least significant bits
+        for (auto* const words: {valueWords(), careWords()}) {
+            for (auto word = nWords(); word-- > 0U;) {
+                words[word] = (words[word] >> 1U) | (word == 0U ? 0U : words[word - 1U] << (WORD_BITS - 1U));
+            }
+        }
+        set(0U, false);
+    }
+
     auto TruthTable::Cube::completeCubes() const -> Vector {
         std::vector<std::size_t> dcPositions;
         dcPositions.reserve(size());
-        for (auto pos = 0U; pos < size(); pos++) {
-            if (!cube[pos].has_value()) // if DC
+        const auto* const cares = careWords();
+        for (std::size_t pos = 0U; pos < size(); ++pos) {
+            if ((cares[pos / WORD_BITS] & bitMask(pos)) == 0U) // if DC
             {
                 dcPositions.emplace_back(pos);
             }
@@ -34,19 +80,257 @@ namespace syrec {
         const auto dcVecSize = dcPositions.size();
         const auto dcSize    = 1U << dcVecSize;
         result.reserve(dcSize);
-        Cube dcCube(cube);
+        Cube dcCube(*this);
 
         for (auto i = 0U; i < dcSize; ++i) {
             for (auto j = 0U; j < dcVecSize; ++j) {
                 const auto localBit = (i & (1U << (dcVecSize - j - 1))) != 0;
 
-                dcCube[dcPositions[j]] = localBit;
+                dcCube.set(dcPositions[j], localBit);
             }
             result.emplace_back(dcCube);
         }
         return result;
     }
 
+    TruthTable::DenseOutputs::DenseOutputs(const std::size_t nInputs, const std::size_t nOutputs):
+        inputs(nInputs), outputs(nOutputs), columnWords(static_cast<std::size_t>((nRows() + Cube::WORD_BITS - 1U) / Cube::WORD_BITS)), values(columnWords * nOutputs, 0U) {
+        assert(nInputs < Cube::WORD_BITS);
+    }
+
+    auto TruthTable::DenseOutputs::rowMask(const std::size_t word) const -> Cube::Word {
+        const auto remainingRows = nRows() - (static_cast<std::uint64_t>(word) * Cube::WORD_BITS);
+        return remainingRows >= Cube::WORD_BITS ? ~Cube::Word{0U} : (Cube::Word{1U} << remainingRows) - 1U;
+    }
+
+    auto TruthTable::DenseOutputs::set(const std::uint64_t input, const std::size_t pos, const Cube::Value& v) -> void {
+        const auto word = (pos * columnWords) + static_cast<std::size_t>(input / Cube::WORD_BITS);
+        const auto mask = Cube::Word{1U} << (input % Cube::WORD_BITS);
+        if (!v.has_value() && cares.empty()) {
+            // the first don't care value, all other values are cared for
+            cares.resize(values.size());
+            for (std::size_t w = 0U; w < cares.size(); ++w) {
+                cares[w] = rowMask(w % columnWords);
+            }
+        }
+        if (!cares.empty()) {
+            cares[word] = v.has_value() ? (cares[word] | mask) : (cares[word] & ~mask);
+        }
+        values[word] = v.value_or(false) ? (values[word] | mask) : (values[word] & ~mask);
+    }
+
+    auto TruthTable::DenseOutputs::output(const std::uint64_t input) const -> Cube {
+        Cube cube{};
+        cube.reserve(outputs);
+        for (std::size_t pos = 0U; pos < outputs; ++pos) {
+            cube.emplace_back(get(input, pos));
+        }
+        return cube;
+    }
+
+    auto TruthTable::DenseOutputs::setOutput(const std::uint64_t input, const Cube& output) -> void {
+        assert(output.size() == outputs);
+        for (std::size_t pos = 0U; pos < outputs; ++pos) {
+            set(input, pos, output[pos]);
+        }
+    }
+
+    auto TruthTable::DenseOutputs::operator==(const DenseOutputs& other) const -> bool {
+        if (inputs != other.inputs || outputs != other.outputs || values != other.values) {
+            return false;
+        }
+        if (cares.empty() || other.cares.empty()) {
+            // the care bits of the outputs without a don't care value are implicitly set
+            const auto& withCares = cares.empty() ? other.cares : cares;
+            for (std::size_t w = 0U; w < withCares.size(); ++w) {
+                if (withCares[w] != rowMask(w % columnWords)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return cares == other.cares;
+    }
+
+    auto TruthTable::mergeInsertedRows() const -> void {
+        if (insertedRows.empty()) {
+            return;
+        }
+        // the first of multiple rows inserted with the same input is kept, like by an insertion into the map
+        std::stable_sort(insertedRows.begin(), insertedRows.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        insertedRows.erase(std::unique(insertedRows.begin(), insertedRows.end(), [](const auto& lhs, const auto& rhs) { return lhs.first == rhs.first; }), insertedRows.end());
+
+        std::vector<Row> rows;
+        rows.reserve(sortedRows.size() + insertedRows.size());
+        auto sortedIt = sortedRows.begin();
+        for (auto& [input, output]: insertedRows) {
+            for (; sortedIt != sortedRows.end() && sortedIt->first < input; ++sortedIt) {
+                rows.emplace_back(std::move(*sortedIt));
+            }
+            // the rows inserted before the last read take precedence
+            if (sortedIt == sortedRows.end() || input < sortedIt->first) {
+                rows.emplace_back(std::move(input), std::move(output));
+            }
+        }
+        for (; sortedIt != sortedRows.end(); ++sortedIt) {
+            rows.emplace_back(std::move(*sortedIt));
+        }
+        sortedRows = std::move(rows);
+        insertedRows.clear();
+    }
+
+    auto TruthTable::toMap() -> void {
+        toSparse();
+        if (sparseStorage == SparseStorage::Map) {
+            return;
+        }
+        mergeInsertedRows();
+        // the rows are inserted in ascending order, i.e. always at the end of the map
+        for (auto& [input, output]: sortedRows) {
+            cubeMap.emplace_hint(cubeMap.end(), std::move(input), std::move(output));
+        }
+        sortedRows.clear();
+        sparseStorage = SparseStorage::Map;
+    }
+
+    auto TruthTable::setSparseStorage(const SparseStorage storage) -> void {
+        if (storage == sparseStorage) {
+            return;
+        }
+        if (storage == SparseStorage::Map) {
+            toMap();
+            return;
+        }
+        sortedRows.reserve(cubeMap.size());
+        while (!cubeMap.empty()) {
+            auto node = cubeMap.extract(cubeMap.begin());
+            sortedRows.emplace_back(std::move(node.key()), std::move(node.mapped()));
+        }
+        sparseStorage = storage;
+    }
+
+    auto TruthTable::firstRow() const -> std::pair<const Cube*, const Cube*> {
+        if (!cubeMap.empty()) {
+            return {&cubeMap.begin()->first, &cubeMap.begin()->second};
+        }
+        // all rows have the same number of inputs and outputs, hence the inserted rows do not need to be merged
+        if (!sortedRows.empty()) {
+            return {&sortedRows.front().first, &sortedRows.front().second};
+        }
+        if (!insertedRows.empty()) {
+            return {&insertedRows.front().first, &insertedRows.front().second};
+        }
+        return {nullptr, nullptr};
+    }
+
+    auto TruthTable::begin() const -> ConstIterator {
+        if (isDense()) {
+            return {*denseOutputs, 0U};
+        }
+        if (sparseStorage == SparseStorage::SortedVector) {
+            mergeInsertedRows();
+            return ConstIterator(sortedRows.data());
+        }
+        return ConstIterator(cubeMap.cbegin());
+    }
+
+    auto TruthTable::end() const -> ConstIterator {
+        if (isDense()) {
+            return {*denseOutputs, denseOutputs->nRows()};
+        }
+        if (sparseStorage == SparseStorage::SortedVector) {
+            mergeInsertedRows();
+            return ConstIterator(sortedRows.data() + sortedRows.size());
+        }
+        return ConstIterator(cubeMap.cend());
+    }
+
+    auto TruthTable::size() const -> std::size_t {
+        if (isDense()) {
+            return static_cast<std::size_t>(denseOutputs->nRows());
+        }
+        if (sparseStorage == SparseStorage::SortedVector) {
+            mergeInsertedRows();
+            return sortedRows.size();
+        }
+        return cubeMap.size();
+    }
+
+    auto TruthTable::try_emplace(Cube&& input, Cube&& output) -> void { // NOLINT(readability-identifier-naming) keeping same Interface as std::vector
+        toSparse();
+        assert(empty() || (input.size() == nInputs() && output.size() == nOutputs()));
+        if (sparseStorage == SparseStorage::SortedVector) {
+            insertedRows.emplace_back(std::move(input), std::move(output));
+        } else {
+            cubeMap.try_emplace(std::move(input), std::move(output));
+        }
+    }
+
+    auto TruthTable::toDense() -> bool {
+        if (isDense()) {
+            return true;
+        }
+        const auto nIn = nInputs();
+        if (empty() || nIn >= Cube::WORD_BITS || size() != (std::size_t{1U} << nIn)) {
+            return false;
+        }
+        // all inputs are distinct, hence the table is completely specified if no input contains a don't care value
+        const auto& rows = std::as_const(*this);
+        for (const auto& [input, _]: rows) {
+            if (nIn != 0U && input.careWords()[0U] != (~Cube::Word{0U} << (Cube::WORD_BITS - nIn))) {
+                return false;
+            }
+        }
+
+        DenseOutputs outputs(nIn, nOutputs());
+        for (const auto& [input, output]: rows) {
+            outputs.setOutput(input.toInteger(), output);
+        }
+        setDenseOutputs(std::move(outputs));
+        return true;
+    }
+
+    auto TruthTable::toSparse() -> void {
+        if (!isDense()) {
+            return;
+        }
+        const auto outputs = std::move(*denseOutputs);
+        denseOutputs.reset();
+        // the inputs are inserted in ascending order, i.e. always at the end of the map or the sorted rows
+        for (std::uint64_t input = 0U; input < outputs.nRows(); ++input) {
+            if (sparseStorage == SparseStorage::SortedVector) {
+                sortedRows.emplace_back(Cube::fromInteger(input, outputs.nInputs()), outputs.output(input));
+            } else {
+                cubeMap.emplace_hint(cubeMap.end(), Cube::fromInteger(input, outputs.nInputs()), outputs.output(input));
+            }
+        }
+    }
+
+    auto TruthTable::find(const Cube& c) const -> ConstIterator {
+        if (isDense()) {
+            if (c.size() != denseOutputs->nInputs() || (!c.empty() && c.careWords()[0U] != (~Cube::Word{0U} << (Cube::WORD_BITS - c.size())))) {
+                return end();
+            }
+            return {*denseOutputs, c.toInteger()};
+        }
+        if (sparseStorage == SparseStorage::SortedVector) {
+            mergeInsertedRows();
+            const auto it = std::lower_bound(sortedRows.cbegin(), sortedRows.cend(), c, [](const auto& row, const Cube& input) { return row.first < input; });
+            return ConstIterator(it != sortedRows.cend() && it->first == c ? &*it : sortedRows.data() + sortedRows.size());
+        }
+        return ConstIterator(cubeMap.find(c));
+    }
+
+    auto TruthTable::operator==(const TruthTable& tt) const -> bool {
+        if (isDense() && tt.isDense()) {
+            return *denseOutputs == *tt.denseOutputs;
+        }
+        if (!isDense() && !tt.isDense() && sparseStorage == SparseStorage::Map && tt.sparseStorage == SparseStorage::Map) {
+            return cubeMap == tt.cubeMap;
+        }
+        return size() == tt.size() && std::equal(begin(), end(), tt.begin());
+    }
+
     auto TruthTable::filteredInput(const Cube& input) const -> Cube {
         // the size of the provided input should be the same as the constants stored in the tt.
         assert(input.size() == constants.size());
@@ -83,15 +367,42 @@ namespace syrec {
             return (tt1 == tt2);
         }
 
+        if (tt1.isDense() && tt2.isDense() && tt1.nInputs() == tt2.nInputs() && tt1.nOutputs() == tt2.nOutputs() && tt1.constants == tt2.constants && tt1.garbage == tt2.garbage && tt1.garbage.size() == tt1.nOutputs()) {
+            // the rows of both tables have the same inputs, hence only the columns of the primary outputs need to be compared
+            const auto& outputs1 = tt1.getDenseOutputs();
+            const auto& outputs2 = tt2.getDenseOutputs();
+            const auto  nOutputs = outputs1.nOutputs();
+            for (std::size_t pos = 0U; pos < nOutputs; ++pos) {
+                if (tt1.isGarbage(nOutputs - 1U - pos)) {
+                    continue;
+                }
+                const auto* const values1 = outputs1.valueColumn(pos);
+                const auto* const values2 = outputs2.valueColumn(pos);
+                const auto* const cares1  = outputs1.careColumn(pos);
+                const auto* const cares2  = outputs2.careColumn(pos);
+                for (std::size_t w = 0U; w < outputs1.nColumnWords(); ++w) {
+                    const auto cares = (cares1 == nullptr ? outputs1.rowMask(w) : cares1[w]) & (cares2 == nullptr ? outputs2.rowMask(w) : cares2[w]);
+                    if (((values1[w] ^ values2[w]) & cares) != 0U) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
         // the number of primary inputs and outputs should be equal for both the truth tables.
         if (tt1.nPrimaryInputs() != tt2.nPrimaryInputs() && tt1.nPrimaryOutputs() != tt2.nPrimaryOutputs()) {
             return false;
         }
+        // the rows are compared pairwise, hence an end iterator (whose row is not materialized for a dense table) is never dereferenced
+        if (tt1.size() != tt2.size()) {
+            return false;
+        }
 
         auto tt1It = tt1.begin();
         auto tt2It = tt2.begin();
 
-        while (tt1It != tt1.end() || tt2It != tt2.end()) {
+        while (tt1It != tt1.end() && tt2It != tt2.end()) {
             const auto& [input1, output1] = *tt1It;
             const auto& [input2, output2] = *tt2It;
             if ((tt1.filteredInput(input1) != tt2.filteredInput(input2)) || (!TruthTable::Cube::checkCubeEquality(tt1.filteredOutput(output1), tt2.filteredOutput(output2)))) {
@@ -107,7 +418,7 @@ namespace syrec {
     auto TruthTable::minimumAdditionalLinesRequired() const -> std::size_t {
         // calculate the frequency of each unique output pattern.
         std::map<TruthTable::Cube, std::size_t> outputFreq;
-        for (const auto& [input, output]: cubeMap) {
+        for (const auto& [input, output]: *this) {
             outputFreq[output]++;
         }
 
@@ -26,6 +26,9 @@ from .pysyrec import (
     properties,
     read_program_settings,
     simple_simulation,
+    slice_circuit,
+    synthesis_scheme,
+    synthesis_session,
 )
 
 __all__ = [
@@ -40,4 +43,7 @@ __all__ = [
     "properties",
     "read_program_settings",
     "simple_simulation",
+    "slice_circuit",
+    "synthesis_scheme",
+    "synthesis_session",
 ]
@@ -159,6 +159,7 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
         self.setup_actions()
 
         self.filename: str
+        self.sessions: dict[syrec.synthesis_scheme, syrec.synthesis_session] = {}
 
         self.title = "SyReC Simulation"
         self.left = 0
@@ -232,16 +233,6 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
                 # making other check box to uncheck
                 self.buttonCostAware.setChecked(True)
 
-    def write_editor_contents_to_file(self) -> None:
-        data = QtCore.QFile("/tmp/out.src")  # noqa: S108
-        if data.open(QtCore.QFile.OpenModeFlag.WriteOnly | QtCore.QFile.OpenModeFlag.Truncate):
-            out = QtCore.QTextStream(data)
-            out << self.getText()
-        else:
-            return
-
-        data.close()
-
     def open_file(self) -> None:
         filename, _ = QtWidgets.QFileDialog.getOpenFileName(
             parent=self.parent, caption="Open Specification", filter="SyReC specification (*.src)"
@@ -261,11 +252,13 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
         if self.before_build is not None:
             self.before_build()
 
-        self.write_editor_contents_to_file()
-
-        self.prog = syrec.program()
+        # Each synthesis scheme keeps its own session so that unchanged modules are neither parsed nor synthesized again
+        scheme = syrec.synthesis_scheme.cost_aware if self.cost_aware_synthesis else syrec.synthesis_scheme.line_aware
+        if scheme not in self.sessions:
+            self.sessions[scheme] = syrec.synthesis_session(scheme)
+        session = self.sessions[scheme]
 
-        error_string = self.prog.read("/tmp/out.src")  # noqa: S108
+        error_string = session.parse(self.getText())
 
         if error_string == "PARSE_STRING_FAILED":
             if self.parser_failed is not None:
@@ -277,12 +270,12 @@ class SyReCEditor(QtWidgets.QWidget):  # type: ignore[misc]
                 self.build_failed(error_string)
             return
 
-        self.circ = syrec.circuit()
-
-        if self.cost_aware_synthesis:
-            syrec.cost_aware_synthesis(self.circ, self.prog)
-        else:
-            syrec.line_aware_synthesis(self.circ, self.prog)
+        self.prog = session.program()
+        if not session.synthesize():
+            if self.build_failed is not None:
+                self.build_failed("Synthesis of the program failed")
+            return
+        self.circ = session.circuit()
 
         self.sim_action.setDisabled(False)
         self.stat_action.setDisabled(False)
@@ -8,7 +8,9 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/simulation/circuit_slicing.hpp"
 #include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/synthesis_session.hpp"
 #include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
 #include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
 #include "core/circuit.hpp"
@@ -17,9 +19,14 @@
 #include "core/properties.hpp"
 #include "core/syrec/program.hpp"
 
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <string_view>
+#include <vector>
 
 namespace py = pybind11;
 using namespace pybind11::literals;
@@ -53,7 +60,9 @@ PYBIND11_MODULE(pysyrec, m) {
             .def("quantum_cost", &Circuit::quantumCost, "Returns the quantum cost of the circuit.")
             .def("transistor_cost", &Circuit::transistorCost, "Returns the transistor cost of the circuit.")
             .def("to_qasm_str", &Circuit::toQasm, "Returns the QASM representation of the circuit.")
-            .def("to_qasm_file", &Circuit::toQasmFile, "filename"_a, "Writes the QASM representation of the circuit to a file.");
+            .def("to_qasm_file", &Circuit::toQasmFile, "filename"_a, "Writes the QASM representation of the circuit to a file.")
+            .def("to_real_str", &Circuit::toReal, "Returns the RevLib .real representation of the circuit.")
+            .def("to_real_file", &Circuit::toRealFile, "filename"_a, "Writes the RevLib .real representation of the circuit to a file.");
 
     py::class_<Properties, std::shared_ptr<Properties>>(m, "properties")
             .def(py::init<>(), "Constructs property map object.")
@@ -63,16 +72,36 @@ PYBIND11_MODULE(pysyrec, m) {
             .def("set_unsigned", &Properties::set<unsigned>)
             .def("set_double", &Properties::set<double>)
             .def("get_string", py::overload_cast<const std::string&>(&Properties::get<std::string>, py::const_))
+            .def("get_unsigned", py::overload_cast<const std::string&>(&Properties::get<unsigned>, py::const_))
             .def("get_double", py::overload_cast<const std::string&>(&Properties::get<double>, py::const_));
 
     py::class_<ReadProgramSettings>(m, "read_program_settings")
             .def(py::init<>(), "Constructs ReadProgramSettings object.")
-            .def_readwrite("default_bitwidth", &ReadProgramSettings::defaultBitwidth);
+            .def_readwrite("default_bitwidth", &ReadProgramSettings::defaultBitwidth)
+            .def_readwrite("use_spirit_grammar", &ReadProgramSettings::useSpiritGrammar)
+            .def_readwrite("first_line_number", &ReadProgramSettings::firstLineNumber);
 
     py::class_<Program>(m, "program")
             .def(py::init<>(), "Constructs SyReC program object.")
             .def("add_module", &Program::addModule)
-            .def("read", &Program::read, "filename"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a file.");
+            .def("read", &Program::read, "filename"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a file.")
+            .def("read_from_string", &Program::readFromString, "content"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a string.")
+            .def(
+                    "read_from_string", [](Program& prog, const py::buffer& content, const ReadProgramSettings& settings) {
+                        // The program is parsed directly from the buffer (e.g. bytes, bytearray or memoryview) without copying it
+                        const py::buffer_info info = content.request();
+                        // the buffer is only read as a contiguous sequence of bytes if its elements are stored in row-major order without gaps
+                        auto expectedStride = info.itemsize;
+                        for (auto dimension = info.ndim; dimension > 0; --dimension) {
+                            const auto i = static_cast<std::size_t>(dimension - 1);
+                            if (info.shape[i] > 1 && info.strides[i] != expectedStride) {
+                                throw py::buffer_error("The buffer to read the SyReC program from must be C-contiguous.");
+                            }
+                            expectedStride *= info.shape[i];
+                        }
+                        return prog.readFromString(std::string_view(static_cast<const char*>(info.ptr), static_cast<std::size_t>(info.size * info.itemsize)), settings);
+                    },
+                    "content"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a buffer.");
 
     py::class_<NBitValuesContainer>(m, "n_bit_values_container")
             .def(py::init<>(), "Constructs an empty container of size zero.")
@@ -101,7 +130,27 @@ PYBIND11_MODULE(pysyrec, m) {
             .def_readwrite("targets", &Gate::targets, "Targets of the gate.")
             .def_readwrite("type", &Gate::type, "Type of the gate.");
 
-    m.def("cost_aware_synthesis", &CostAwareSynthesis::synthesize, "circ"_a, "program"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), "Cost-aware synthesis of the SyReC program.");
-    m.def("line_aware_synthesis", &LineAwareSynthesis::synthesize, "circ"_a, "program"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), "Line-aware synthesis of the SyReC program.");
-    m.def("simple_simulation", &simpleSimulation, "output"_a, "circ"_a, "input"_a, "statistics"_a = Properties::ptr(), "Simulation of the synthesized circuit circ.");
+    py::enum_<SynthesisScheme>(m, "synthesis_scheme")
+            .value("cost_aware", SynthesisScheme::CostAware, "Cost-aware synthesis scheme.")
+            .value("line_aware", SynthesisScheme::LineAware, "Line-aware synthesis scheme.");
+
+    py::class_<SynthesisSession>(m, "synthesis_session")
+            .def(py::init<SynthesisScheme, Properties::ptr, const ReadProgramSettings&>(), "scheme"_a = SynthesisScheme::CostAware, "settings"_a = std::make_shared<Properties>(), "read_settings"_a = ReadProgramSettings{}, "Constructs a session for the incremental synthesis of consecutive versions of a SyReC program.")
+            .def("parse", &SynthesisSession::parse, "source"_a, "statistics"_a = std::make_shared<Properties>(), "Parse a new version of the program, reusing the modules whose source did not change.")
+            .def("synthesize", &SynthesisSession::synthesize, "statistics"_a = std::make_shared<Properties>(), "Synthesize the last parsed version of the program, reusing the syntheses of unchanged modules.")
+            .def("program", &SynthesisSession::program, py::return_value_policy::reference_internal, "The last successfully parsed version of the program.")
+            .def("circuit", &SynthesisSession::circuit, py::return_value_policy::reference_internal, "The circuit synthesized for the last successfully parsed version of the program.");
+
+    m.def("cost_aware_synthesis", py::overload_cast<Circuit&, const Program&, const Properties::ptr&, const Properties::ptr&>(&CostAwareSynthesis::synthesize), "circ"_a, "program"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), "Cost-aware synthesis of the SyReC program.");
+    m.def("line_aware_synthesis", py::overload_cast<Circuit&, const Program&, const Properties::ptr&, const Properties::ptr&>(&LineAwareSynthesis::synthesize), "circ"_a, "program"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), "Line-aware synthesis of the SyReC program.");
+    m.def("simple_simulation", py::overload_cast<NBitValuesContainer&, const Circuit&, const NBitValuesContainer&, const Properties::ptr&>(&simpleSimulation), "output"_a, "circ"_a, "input"_a, "statistics"_a = Properties::ptr(), "Simulation of the synthesized circuit circ.");
+    m.def(
+            "slice_circuit", [](Circuit& slice, const Circuit& circ, const std::vector<Gate::Line>& lines, const Properties::ptr& statistics) -> std::optional<std::vector<Gate::Line>> {
+                std::vector<Gate::Line> lineMapping;
+                if (!sliceCircuit(slice, lineMapping, circ, lines, statistics)) {
+                    return std::nullopt;
+                }
+                return lineMapping;
+            },
+            "slice"_a, "circ"_a, "lines"_a, "statistics"_a = Properties::ptr(), "Extracts the cone of influence of the given lines of circ into slice. Returns the mapping of the lines of the slice to the lines of circ or None if any of the lines does not exist in circ.");
 }
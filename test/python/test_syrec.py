@@ -53,6 +53,20 @@ def test_parser(data_line_aware_synthesis: dict[str, Any]) -> None:
         assert not error
 
 
+def test_parser_from_buffer(data_line_aware_synthesis: dict[str, Any]) -> None:
+    for file_name in data_line_aware_synthesis:
+        content = (circuit_dir / (file_name + ".src")).read_bytes()
+
+        assert not syrec.program().read_from_string(content)
+        assert not syrec.program().read_from_string(memoryview(content))
+        assert not syrec.program().read_from_string(content.decode())
+
+    assert syrec.program().read_from_string(b"module main(inout a(2))\n  b ^= 1") == "In line 0: Unknown variable %sb"
+
+    with pytest.raises(BufferError):
+        syrec.program().read_from_string(memoryview(b"module main(inout a(2))")[::2])
+
+
 def test_synthesis_no_lines(data_line_aware_synthesis: dict[str, Any]) -> None:
     for file_name in data_line_aware_synthesis:
         circ = syrec.circuit()
@@ -127,3 +141,32 @@ def test_no_lines_to_qasm(data_line_aware_synthesis: dict[str, Any]) -> None:
         prog = syrec.program()
         prog.read(str(circuit_dir / (file_name + ".src")))
         assert circ.to_qasm_file(str(circuit_dir / (file_name + ".qasm")))
+
+
+def test_synthesis_session() -> None:
+    source = "module inc(inout a(2))\n  ++= a\n\nmodule main(inout x(2), inout y(2))\n  call inc(x);\n  x ^= y\n"
+    edited_source = source.replace("x ^= y", "y ^= x")
+
+    session = syrec.synthesis_session(syrec.synthesis_scheme.cost_aware)
+    assert not session.parse(source)
+    assert session.synthesize()
+
+    prog = syrec.program()
+    assert not prog.read_from_string(source)
+    circ = syrec.circuit()
+    assert syrec.cost_aware_synthesis(circ, prog)
+    assert session.circuit().num_gates == circ.num_gates
+    assert session.circuit().lines == circ.lines
+
+    statistics = syrec.properties()
+    assert not session.parse(edited_source, statistics)
+    assert statistics.get_unsigned("reparsed_modules") == 1
+    assert statistics.get_unsigned("reused_modules") == 1
+    assert session.synthesize()
+
+    edited_prog = syrec.program()
+    assert not edited_prog.read_from_string(edited_source)
+    edited_circ = syrec.circuit()
+    assert syrec.cost_aware_synthesis(edited_circ, edited_prog)
+    assert session.circuit().num_gates == edited_circ.num_gates
+    assert session.circuit().lines == edited_circ.lines
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "core/circuit.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace syrec::test {
+    // All input patterns are simulated for circuits with at most this number of simulated lines
+    constexpr std::size_t MAX_EXHAUSTIVELY_SIMULATED_LINES = 10U;
+    constexpr std::size_t SAMPLED_INPUT_PATTERNS           = 256U;
+
+    // The number of lines of the parameters of the main module (or the first module), which are the first lines of the synthesized circuit
+    inline std::size_t nParameterLinesOfMainModule(const Program& prog) {
+        const auto  mainModule      = prog.findModule("main") ? prog.findModule("main") : prog.modules().front();
+        std::size_t nParameterLines = 0;
+        for (const auto& parameter: mainModule->parameters) {
+            std::size_t nLinesOfParameter = parameter->bitwidth;
+            for (const auto dimension: parameter->dimensions) {
+                nLinesOfParameter *= dimension;
+            }
+            nParameterLines += nLinesOfParameter;
+        }
+        return nParameterLines;
+    }
+
+    // The values of the simulated lines of each simulated input pattern, the i-th line is set to the (i % 64)-th bit of the values.
+    // Larger circuits are only checked for a subset of all input patterns
+    inline std::vector<std::uint64_t> simulatedInputPatterns(const std::size_t nSimulatedLines) {
+        const auto          exhaustive    = nSimulatedLines <= MAX_EXHAUSTIVELY_SIMULATED_LINES;
+        const std::uint64_t nPatterns     = exhaustive ? (1ULL << nSimulatedLines) : SAMPLED_INPUT_PATTERNS;
+        const std::uint64_t patternStride = exhaustive ? 1ULL : 0x9E3779B97F4A7C15ULL;
+
+        std::vector<std::uint64_t> patterns;
+        patterns.reserve(nPatterns);
+        for (std::uint64_t i = 0; i < nPatterns; ++i) {
+            patterns.emplace_back(i * patternStride);
+        }
+        return patterns;
+    }
+
+    // Creates the input of the circuit, in which the constant lines are set to their values and the first nSimulatedLines other lines to the given values
+    inline NBitValuesContainer createInput(const Circuit& circ, const std::uint64_t values, const std::size_t nSimulatedLines = std::numeric_limits<std::size_t>::max()) {
+        NBitValuesContainer input(circ.getLines());
+        for (std::size_t i = 0; i < circ.getLines(); ++i) {
+            if (const auto& constantValue = circ.getConstants()[i]; constantValue.has_value()) {
+                input.set(i, *constantValue);
+            } else if (i < nSimulatedLines) {
+                input.set(i, ((values >> (i % 64U)) & 1U) != 0);
+            }
+        }
+        return input;
+    }
+
+    // Asserts that the first nSimulatedLines lines of both circuits have the same outputs for the same values of these lines
+    inline void assertSimulatedLinesAreEqual(const Circuit& expectedCirc, const Circuit& actualCirc, const std::size_t nSimulatedLines) {
+        const Properties::ptr noStatistics;
+        NBitValuesContainer   expectedOutput(expectedCirc.getLines());
+        NBitValuesContainer   actualOutput(actualCirc.getLines());
+        for (const auto values: simulatedInputPatterns(nSimulatedLines)) {
+            simpleSimulation(expectedOutput, expectedCirc, createInput(expectedCirc, values, nSimulatedLines), noStatistics);
+            simpleSimulation(actualOutput, actualCirc, createInput(actualCirc, values, nSimulatedLines), noStatistics);
+            for (std::size_t line = 0; line < nSimulatedLines; ++line) {
+                ASSERT_EQ(expectedOutput[line], actualOutput[line]) << "Output of line " << std::to_string(line) << " did not match for input values " << std::to_string(values);
+            }
+        }
+    }
+
+    // Asserts that both circuits have the same lines and the same outputs for the same values of all non-constant lines
+    inline void assertCircuitsAreFunctionallyEquivalent(const Circuit& expectedCirc, const Circuit& actualCirc) {
+        ASSERT_EQ(expectedCirc.getLines(), actualCirc.getLines());
+        assertSimulatedLinesAreEqual(expectedCirc, actualCirc, expectedCirc.getLines());
+    }
+} // namespace syrec::test
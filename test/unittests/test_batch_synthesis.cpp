@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "core/properties.hpp"
+
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+
+using namespace syrec;
+
+class SyrecBatchSynthesisTest: public testing::Test {
+protected:
+    std::string              testConfigsDir  = "./configs/";
+    std::string              testCircuitsDir = "./circuits/";
+    std::vector<std::string> circuitNames    = {"alu_2", "bitwise_and_2", "call_8", "divide_2", "for_4", "gray_binary_conversion_16", "input_repeated_4", "modulo_2", "multiply_2", "negate_8", "parity_check_16", "swap_2"};
+
+    [[nodiscard]] std::vector<BatchSynthesisJob> createJobs() const {
+        std::vector<BatchSynthesisJob> jobs;
+        for (const auto scheme: {SynthesisScheme::CostAware, SynthesisScheme::LineAware}) {
+            for (const auto& circuitName: circuitNames) {
+                jobs.emplace_back(BatchSynthesisJob{circuitName, testCircuitsDir + circuitName + ".src", scheme, std::make_shared<Properties>()});
+            }
+        }
+        return jobs;
+    }
+
+    [[nodiscard]] json readExpectedResults(const SynthesisScheme scheme) const {
+        std::ifstream i(testConfigsDir + "circuits_" + std::string(getNameOfSynthesisScheme(scheme)) + "_synthesis.json");
+        return json::parse(i);
+    }
+};
+
+TEST_F(SyrecBatchSynthesisTest, SynthesisSchemeNames) {
+    EXPECT_EQ("cost_aware", getNameOfSynthesisScheme(SynthesisScheme::CostAware));
+    EXPECT_EQ("line_aware", getNameOfSynthesisScheme(SynthesisScheme::LineAware));
+    EXPECT_EQ(SynthesisScheme::CostAware, getSynthesisSchemeByName("cost_aware"));
+    EXPECT_EQ(SynthesisScheme::LineAware, getSynthesisSchemeByName("line-aware"));
+    EXPECT_FALSE(getSynthesisSchemeByName("unknown").has_value());
+}
+
+TEST_F(SyrecBatchSynthesisTest, ConcurrentBatchSynthesisMatchesExpectedResults) {
+    const auto jobs = createJobs();
+    for (const unsigned nThreads: {1U, 4U, 0U}) {
+        const auto results = synthesizeBatch(jobs, nThreads);
+        ASSERT_EQ(jobs.size(), results.size());
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            const auto& result = results[i];
+            ASSERT_TRUE(result.ok) << result.filename << ": " << result.errorMessage;
+            ASSERT_EQ(jobs[i].name, result.name);
+            ASSERT_EQ(jobs[i].scheme, result.scheme);
+
+            const auto expectedResults = readExpectedResults(result.scheme)[result.name];
+            EXPECT_EQ(expectedResults["num_gates"].get<unsigned>(), result.numGates) << result.name;
+            EXPECT_EQ(expectedResults["lines"].get<unsigned>(), result.lines) << result.name;
+            EXPECT_EQ(expectedResults["quantum_costs"].get<Gate::cost_t>(), result.quantumCosts) << result.name;
+            EXPECT_EQ(expectedResults["transistor_costs"].get<Gate::cost_t>(), result.transistorCosts) << result.name;
+            EXPECT_GE(result.parsingRuntime, 0.);
+            EXPECT_GE(result.synthesisRuntime, 0.);
+        }
+    }
+}
+
+TEST_F(SyrecBatchSynthesisTest, ReportContainsFieldsOfTestConfigurations) {
+    std::vector<BatchSynthesisJob> jobs;
+    for (const auto& job: createJobs()) {
+        if (job.scheme == SynthesisScheme::LineAware) {
+            jobs.emplace_back(job);
+        }
+    }
+    const auto results = synthesizeBatch(jobs, 2);
+
+    std::stringstream report;
+    writeBatchSynthesisReport(report, results);
+    const auto actualResults   = json::parse(report.str());
+    const auto expectedResults = readExpectedResults(SynthesisScheme::LineAware);
+    ASSERT_EQ(circuitNames.size(), actualResults.size());
+    for (const auto& circuitName: circuitNames) {
+        const auto& actualResult = actualResults[circuitName];
+        for (const auto* field: {"num_gates", "lines", "quantum_costs", "transistor_costs"}) {
+            EXPECT_EQ(expectedResults[circuitName][field], actualResult[field]) << circuitName << ": " << field;
+        }
+        EXPECT_EQ("line_aware", actualResult["synthesis"].get<std::string>());
+        EXPECT_TRUE(actualResult["runtime"].contains("parsing"));
+        EXPECT_TRUE(actualResult["runtime"].contains("synthesis"));
+        EXPECT_TRUE(actualResult.contains("peak_memory"));
+    }
+}
+
+TEST_F(SyrecBatchSynthesisTest, FailedJobsDoNotAffectOtherJobs) {
+    const std::vector<BatchSynthesisJob> jobs = {
+            {"missing", testCircuitsDir + "does_not_exist.src", SynthesisScheme::CostAware, std::make_shared<Properties>()},
+            {"alu_2", testCircuitsDir + "alu_2.src", SynthesisScheme::CostAware, std::make_shared<Properties>()}};
+    const auto results = synthesizeBatch(jobs, 2);
+    ASSERT_EQ(2U, results.size());
+    ASSERT_FALSE(results[0].ok);
+    ASSERT_EQ("Could not open file " + testCircuitsDir + "does_not_exist.src", results[0].errorMessage);
+    ASSERT_TRUE(results[1].ok);
+
+    std::stringstream report;
+    writeBatchSynthesisReport(report, results);
+    const auto actualResults = json::parse(report.str());
+    ASSERT_EQ("Could not open file " + testCircuitsDir + "does_not_exist.src", actualResults["missing"]["error"].get<std::string>());
+    ASSERT_FALSE(actualResults["missing"].contains("num_gates"));
+    ASSERT_EQ(26U, actualResults["alu_2"]["num_gates"].get<unsigned>());
+}
+
+TEST_F(SyrecBatchSynthesisTest, ProgramsSharingTheStemOfTheirFileHaveDistinctNames) {
+    const std::vector<std::string> filenames = {"a/alu_2.src", "b/alu_2.src", "for_4.src", "a/alu_2.src"};
+    const auto                     names     = getNamesOfBatchSynthesisPrograms(filenames);
+    ASSERT_EQ(std::vector<std::string>({"a/alu_2.src", "b/alu_2.src", "for_4", "a/alu_2.src"}), names);
+
+    const std::vector<BatchSynthesisJob> jobs = {
+            {names[0], testCircuitsDir + "alu_2.src", SynthesisScheme::CostAware, std::make_shared<Properties>()},
+            {names[1], testCircuitsDir + "does_not_exist.src", SynthesisScheme::CostAware, std::make_shared<Properties>()}};
+    std::stringstream report;
+    writeBatchSynthesisReport(report, synthesizeBatch(jobs, 2));
+    const auto actualResults = json::parse(report.str());
+    ASSERT_EQ(2U, actualResults.size());
+    ASSERT_EQ(26U, actualResults["a/alu_2.src"]["num_gates"].get<unsigned>());
+    ASSERT_TRUE(actualResults["b/alu_2.src"].contains("error"));
+}
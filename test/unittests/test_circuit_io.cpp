@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/io/binary_circuit.hpp"
+#include "core/syrec/program.hpp"
+
+#include <algorithm>
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+class SyrecBinaryCircuitTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Circuit     circ;
+
+    void SetUp() override {
+        Program                   prog;
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecCircuitIoTest, SyrecBinaryCircuitTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "call_8",
+                                 "for_4",
+                                 "parity_check_16",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<SyrecBinaryCircuitTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecBinaryCircuitTest, WrittenCircuitCanBeReadAgain) {
+    std::stringstream binaryCircuit;
+    ASSERT_TRUE(writeBinaryCircuit(circ, binaryCircuit));
+
+    Circuit readCirc;
+    ASSERT_TRUE(readBinaryCircuit(readCirc, binaryCircuit));
+    ASSERT_EQ(circ.getLines(), readCirc.getLines());
+    ASSERT_EQ(circ.getInputs(), readCirc.getInputs());
+    ASSERT_EQ(circ.getOutputs(), readCirc.getOutputs());
+    ASSERT_EQ(circ.getConstants(), readCirc.getConstants());
+    ASSERT_EQ(circ.getGarbage(), readCirc.getGarbage());
+    ASSERT_EQ(circ.numGates(), readCirc.numGates());
+
+    auto readGateIt = readCirc.cbegin();
+    for (auto gateIt = circ.cbegin(); gateIt != circ.cend(); ++gateIt, ++readGateIt) {
+        ASSERT_EQ((*gateIt)->type, (*readGateIt)->type);
+        ASSERT_THAT((*readGateIt)->controls, testing::ElementsAreArray((*gateIt)->controls.cbegin(), (*gateIt)->controls.cend()));
+        ASSERT_THAT((*readGateIt)->targets, testing::ElementsAreArray((*gateIt)->targets.cbegin(), (*gateIt)->targets.cend()));
+    }
+    ASSERT_EQ(circ.quantumCost(), readCirc.quantumCost());
+    ASSERT_EQ(circ.transistorCost(), readCirc.transistorCost());
+}
+
+TEST_P(SyrecBinaryCircuitTest, TruncatedCircuitIsRejected) {
+    std::stringstream binaryCircuit;
+    ASSERT_TRUE(writeBinaryCircuit(circ, binaryCircuit));
+
+    const std::string serializedCircuit = binaryCircuit.str();
+    for (const auto length: {std::size_t{0}, std::size_t{3}, serializedCircuit.size() / 2, serializedCircuit.size() - 1}) {
+        std::stringstream truncatedCircuit(serializedCircuit.substr(0, length));
+        Circuit           readCirc;
+        ASSERT_FALSE(readBinaryCircuit(readCirc, truncatedCircuit)) << "Truncated to " << length << " bytes";
+    }
+}
+
+TEST(SyrecCircuitIoTest, BinaryCircuitWithInvalidGateLinesIsRejected) {
+    Circuit circ;
+    circ.addLine("a", "a");
+    circ.addLine("b", "b");
+    ASSERT_NE(nullptr, circ.createAndAddCnotGate(0, 1));
+
+    std::stringstream binaryCircuit;
+    ASSERT_TRUE(writeBinaryCircuit(circ, binaryCircuit));
+    std::string serializedCircuit = binaryCircuit.str();
+    // The target line of the CNOT gate is stored in the last four bytes
+    serializedCircuit[serializedCircuit.size() - 4] = 2;
+
+    std::stringstream corruptedCircuit(serializedCircuit);
+    Circuit           readCirc;
+    ASSERT_FALSE(readBinaryCircuit(readCirc, corruptedCircuit));
+
+    std::stringstream notABinaryCircuit("OPENQASM 2.0;");
+    Circuit           otherCirc;
+    ASSERT_FALSE(readBinaryCircuit(otherCirc, notABinaryCircuit));
+}
+
+TEST(SyrecCircuitIoTest, RealRepresentationOfCircuit) {
+    Circuit circ;
+    circ.addLine("a.0", "a.0");
+    circ.addLine("const_0", "garbage", false, true);
+    circ.addLine("const_0", "garbage", true, true);
+    circ.addLine("x0", "x0");
+    ASSERT_NE(nullptr, circ.createAndAddToffoliGate(0, 3, 1));
+    ASSERT_NE(nullptr, circ.createAndAddNotGate(2));
+    ASSERT_NE(nullptr, circ.createAndAddFredkinGate(0, 3));
+
+    const std::string expectedReal = ".version 2.0\n"
+                                     ".numvars 4\n"
+                                     ".variables x0 x1 x2 x3\n"
+                                     ".inputs a_0 const_0 const_0_2 x0_3\n"
+                                     ".outputs a_0 garbage garbage_2 x0_3\n"
+                                     ".constants -01-\n"
+                                     ".garbage -11-\n"
+                                     ".begin\n"
+                                     "t3 x0 x3 x1\n"
+                                     "t1 x2\n"
+                                     "f2 x0 x3\n"
+                                     ".end\n";
+    ASSERT_EQ(expectedReal, circ.toReal());
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_slicing.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    void assertSliceSimulationMatchesCircuitSimulation(const Circuit& circ, const Circuit& slice, const std::vector<Gate::Line>& lineMapping, const std::vector<Gate::Line>& slicedLines) {
+        const std::size_t nCircuitLines = circ.getLines();
+        ASSERT_LT(nCircuitLines, 64U);
+
+        const Properties::ptr statistics;
+        NBitValuesContainer   circuitOutput(nCircuitLines);
+        NBitValuesContainer   sliceOutput(slice.getLines());
+        for (std::uint64_t inputPattern = 0; inputPattern < (1ULL << nCircuitLines); ++inputPattern) {
+            const NBitValuesContainer circuitInput(nCircuitLines, inputPattern);
+            simpleSimulation(circuitOutput, circ, circuitInput, statistics);
+
+            NBitValuesContainer sliceInput(slice.getLines());
+            for (std::size_t i = 0; i < lineMapping.size(); ++i) {
+                sliceInput.set(i, circuitInput[lineMapping[i]]);
+            }
+            simpleSimulation(sliceOutput, slice, sliceInput, statistics);
+
+            for (std::size_t i = 0; i < lineMapping.size(); ++i) {
+                for (const auto slicedLine: slicedLines) {
+                    if (lineMapping[i] == slicedLine) {
+                        ASSERT_EQ(circuitOutput[slicedLine], sliceOutput[i]) << "Output of line " << std::to_string(slicedLine) << " did not match for input pattern " << std::to_string(inputPattern);
+                    }
+                }
+            }
+        }
+    }
+} // namespace
+
+TEST(CircuitSlicingTest, SliceOnlyContainsGatesInConeOfInfluence) {
+    Circuit circ;
+    circ.setLines(5);
+    circ.setInputs({"a", "b", "c", "d", "e"});
+    circ.setGarbage({false, false, true, false, true});
+
+    ASSERT_NE(nullptr, circ.createAndAddCnotGate(0, 1));
+    ASSERT_NE(nullptr, circ.createAndAddToffoliGate(3, 4, 2));
+    ASSERT_NE(nullptr, circ.createAndAddCnotGate(1, 3));
+    const auto annotatedGate = circ.createAndAddNotGate(4);
+    ASSERT_NE(nullptr, annotatedGate);
+    circ.annotate(*annotatedGate, "lno", "1");
+
+    Circuit                 slice;
+    std::vector<Gate::Line> lineMapping;
+    ASSERT_TRUE(sliceCircuit(slice, lineMapping, circ, {3}));
+    ASSERT_THAT(lineMapping, testing::ElementsAre(0, 1, 3));
+    ASSERT_EQ(3U, slice.getLines());
+    ASSERT_EQ(2U, slice.numGates());
+    ASSERT_THAT(slice.getInputs(), testing::ElementsAre("a", "b", "d"));
+    ASSERT_THAT(slice.getGarbage(), testing::ElementsAre(false, false, false));
+
+    const auto& firstGate = **slice.cbegin();
+    ASSERT_THAT(firstGate.controls, testing::ElementsAre(0));
+    ASSERT_THAT(firstGate.targets, testing::ElementsAre(1));
+    const auto& secondGate = **std::next(slice.cbegin());
+    ASSERT_THAT(secondGate.controls, testing::ElementsAre(1));
+    ASSERT_THAT(secondGate.targets, testing::ElementsAre(2));
+
+    Circuit                 sliceOfAnnotatedLine;
+    std::vector<Gate::Line> lineMappingOfAnnotatedLine;
+    ASSERT_TRUE(sliceCircuit(sliceOfAnnotatedLine, lineMappingOfAnnotatedLine, circ, {4}));
+    ASSERT_THAT(lineMappingOfAnnotatedLine, testing::ElementsAre(4));
+    ASSERT_EQ(1U, sliceOfAnnotatedLine.numGates());
+    const auto annotationsOfSlicedGate = sliceOfAnnotatedLine.getAnnotations(**sliceOfAnnotatedLine.cbegin());
+    ASSERT_TRUE(annotationsOfSlicedGate.has_value());
+    ASSERT_EQ("1", annotationsOfSlicedGate->at("lno"));
+}
+
+TEST(CircuitSlicingTest, SlicingOfUnknownLineFails) {
+    Circuit circ;
+    circ.setLines(2);
+    ASSERT_NE(nullptr, circ.createAndAddCnotGate(0, 1));
+
+    Circuit                 slice;
+    std::vector<Gate::Line> lineMapping;
+    ASSERT_FALSE(sliceCircuit(slice, lineMapping, circ, {1, 2}));
+}
+
+TEST(CircuitSlicingTest, SliceOfSynthesizedCircuitProducesSameOutputs) {
+    Program                   prog;
+    const ReadProgramSettings settings;
+    ASSERT_TRUE(prog.read("./circuits/alu_2.src", settings).empty());
+
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    for (Gate::Line line = 0; line < circ.getLines(); ++line) {
+        Circuit                 slice;
+        std::vector<Gate::Line> lineMapping;
+        ASSERT_TRUE(sliceCircuit(slice, lineMapping, circ, {line}));
+        ASSERT_LE(slice.numGates(), circ.numGates());
+        assertSliceSimulationMatchesCircuitSimulation(circ, slice, lineMapping, {line});
+    }
+
+    // The output x0 of the alu is stored on the lines 1 and 2 and depends on all other inputs
+    Circuit                 sliceOfOutput;
+    std::vector<Gate::Line> lineMappingOfOutput;
+    ASSERT_TRUE(sliceCircuit(sliceOfOutput, lineMappingOfOutput, circ, {1, 2}));
+    assertSliceSimulationMatchesCircuitSimulation(circ, sliceOfOutput, lineMappingOfOutput, {1, 2});
+}
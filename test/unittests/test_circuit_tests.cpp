@@ -15,6 +15,7 @@
 #include <gmock/gmock-matchers.h>
 #include <gtest/gtest.h>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -1824,3 +1825,129 @@ TEST_F(CircuitTestsFixture, UpdateLocalAnnotationWhoseKeyMatchesGlobalAnnotation
     assertThatAnnotationsOfGateAreEqualTo(*circuit, *secondGeneratedNotGate, expectedAnnotationsOfSecondGate);
 }
 // END Annotation tests
+
+// BEGIN GateRange tests
+TEST_F(CircuitTestsFixture, AppendInverseOfGateRange) {
+    circuit->setLines(3);
+    ASSERT_THAT(circuit->createAndAddNotGate(0), testing::NotNull());
+
+    auto gateRange = circuit->beginGateRange();
+    ASSERT_THAT(circuit->createAndAddToffoliGate(0, 1, 2), testing::NotNull());
+    ASSERT_THAT(circuit->createAndAddCnotGate(2, 1), testing::NotNull());
+    ASSERT_THAT(circuit->createAndAddFredkinGate(0, 2), testing::NotNull());
+    circuit->endGateRange(gateRange);
+    ASSERT_EQ(1U, gateRange.begin);
+    ASSERT_EQ(3U, gateRange.size());
+
+    const std::string globalAnnotationKey   = "KEY";
+    const std::string globalAnnotationValue = "Inverse";
+    circuit->setOrUpdateGlobalGateAnnotation(globalAnnotationKey, globalAnnotationValue);
+    ASSERT_TRUE(circuit->appendInverseOfGateRange(*circuit, gateRange));
+
+    auto expectedNotGate  = std::make_shared<Gate>();
+    expectedNotGate->type = Gate::Type::Toffoli;
+    expectedNotGate->targets.emplace(0);
+
+    auto expectedToffoliGate      = std::make_shared<Gate>();
+    expectedToffoliGate->type     = Gate::Type::Toffoli;
+    expectedToffoliGate->controls = {0, 1};
+    expectedToffoliGate->targets.emplace(2);
+
+    auto expectedCnotGate      = std::make_shared<Gate>();
+    expectedCnotGate->type     = Gate::Type::Toffoli;
+    expectedCnotGate->controls = {2};
+    expectedCnotGate->targets.emplace(1);
+
+    auto expectedFredkinGate     = std::make_shared<Gate>();
+    expectedFredkinGate->type    = Gate::Type::Fredkin;
+    expectedFredkinGate->targets = {0, 2};
+    assertThatGatesOfCircuitAreEqualToSequence(*circuit, {expectedNotGate, expectedToffoliGate, expectedCnotGate, expectedFredkinGate, expectedFredkinGate, expectedCnotGate, expectedToffoliGate});
+
+    const std::unordered_map<std::string, std::string> expectedAnnotationsOfInvertedGates = {{globalAnnotationKey, globalAnnotationValue}};
+    for (auto gateIt = std::next(circuit->cbegin(), 4); gateIt != circuit->cend(); ++gateIt) {
+        assertThatAnnotationsOfGateAreEqualTo(*circuit, **gateIt, expectedAnnotationsOfInvertedGates);
+    }
+}
+
+TEST_F(CircuitTestsFixture, AppendGateRangeOfOtherCircuitWithLineMappingAndPropagatedControlLines) {
+    Circuit source;
+    source.setLines(2);
+    const auto sourceGate = source.createAndAddCnotGate(0, 1);
+    ASSERT_THAT(sourceGate, testing::NotNull());
+    const std::string annotationKey   = "KEY";
+    const std::string annotationValue = "Source";
+    source.annotate(*sourceGate, annotationKey, annotationValue);
+
+    circuit->setLines(4);
+    circuit->setOrUpdateGlobalGateAnnotation(annotationKey, "Global");
+    circuit->activateControlLinePropagationScope();
+    circuit->registerControlLineForPropagationInCurrentAndNestedScopes(0);
+    ASSERT_TRUE(circuit->appendGateRange(source, {0, source.numGates()}, {3, 2}));
+    ASSERT_TRUE(circuit->appendInverseOfGateRange(source, {0, source.numGates()}, {1, 2}));
+    circuit->deactivateControlLinePropagationScope();
+
+    auto expectedFirstGate      = std::make_shared<Gate>();
+    expectedFirstGate->type     = Gate::Type::Toffoli;
+    expectedFirstGate->controls = {0, 3};
+    expectedFirstGate->targets.emplace(2);
+
+    auto expectedSecondGate      = std::make_shared<Gate>();
+    expectedSecondGate->type     = Gate::Type::Toffoli;
+    expectedSecondGate->controls = {0, 1};
+    expectedSecondGate->targets.emplace(2);
+    assertThatGatesOfCircuitAreEqualToSequence(*circuit, {expectedFirstGate, expectedSecondGate});
+
+    // The annotations of the gates of the range are only copied when the range is appended in its original order
+    assertThatAnnotationsOfGateAreEqualTo(*circuit, **circuit->cbegin(), std::unordered_map<std::string, std::string>({{annotationKey, annotationValue}}));
+    assertThatAnnotationsOfGateAreEqualTo(*circuit, **std::next(circuit->cbegin()), std::unordered_map<std::string, std::string>({{annotationKey, "Global"}}));
+}
+
+TEST_F(CircuitTestsFixture, AppendInvalidGateRange) {
+    circuit->setLines(2);
+    ASSERT_THAT(circuit->createAndAddCnotGate(0, 1), testing::NotNull());
+    ASSERT_THAT(circuit->createAndAddFredkinGate(0, 1), testing::NotNull());
+
+    ASSERT_FALSE(circuit->appendGateRange(*circuit, {1, 3}));
+    ASSERT_FALSE(circuit->appendInverseOfGateRange(*circuit, {2, 1}));
+    // The mapping of both target lines of the Fredkin gate onto the same line cannot be represented
+    ASSERT_FALSE(circuit->appendInverseOfGateRange(*circuit, {0, 2}, {0, 0}));
+
+    Circuit circuitWithMoreLines;
+    circuitWithMoreLines.setLines(3);
+    ASSERT_THAT(circuitWithMoreLines.createAndAddNotGate(2), testing::NotNull());
+    ASSERT_FALSE(circuit->appendGateRange(circuitWithMoreLines, {0, 1}));
+    ASSERT_EQ(2U, circuit->numGates());
+}
+
+TEST_F(CircuitTestsFixture, AppendGatesMovedFromOtherCircuit) {
+    circuit->setLines(3);
+    ASSERT_THAT(circuit->createAndAddNotGate(0), testing::NotNull());
+
+    Circuit other;
+    other.setLines(3);
+    const std::string annotationKey   = "Key";
+    const std::string annotationValue = "Value";
+    const auto        movedGate       = other.createAndAddCnotGate(1, 2);
+    ASSERT_THAT(movedGate, testing::NotNull());
+    other.annotate(*movedGate, annotationKey, annotationValue);
+
+    // Neither the propagated control lines nor the global gate annotations of the circuit are applied to the moved gates
+    circuit->setOrUpdateGlobalGateAnnotation(annotationKey, "Global");
+    circuit->activateControlLinePropagationScope();
+    circuit->registerControlLineForPropagationInCurrentAndNestedScopes(0);
+    ASSERT_TRUE(circuit->appendGatesMovedFrom(other));
+    circuit->deactivateControlLinePropagationScope();
+    ASSERT_EQ(0U, other.numGates());
+    ASSERT_EQ(2U, circuit->numGates());
+    ASSERT_EQ(movedGate, *std::next(circuit->cbegin()));
+    ASSERT_THAT(movedGate->controls, testing::ElementsAre(1));
+    assertThatAnnotationsOfGateAreEqualTo(*circuit, *movedGate, std::unordered_map<std::string, std::string>({{annotationKey, annotationValue}}));
+
+    Circuit otherWithMoreLines;
+    otherWithMoreLines.setLines(4);
+    ASSERT_THAT(otherWithMoreLines.createAndAddNotGate(3), testing::NotNull());
+    ASSERT_FALSE(circuit->appendGatesMovedFrom(otherWithMoreLines));
+    ASSERT_EQ(1U, otherWithMoreLines.numGates());
+    ASSERT_EQ(2U, circuit->numGates());
+}
+// END GateRange tests
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "simulation_helpers.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    Properties::ptr createSettings() {
+        auto settings = std::make_shared<Properties>();
+        settings->set("eliminate_common_subexpressions", true);
+        return settings;
+    }
+} // namespace
+
+class SyrecCommonSubexpressionEliminationTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+    std::size_t nParameterLines = 0;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+
+        nParameterLines = test::nParameterLinesOfMainModule(prog);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecCommonSubexpressionEliminationTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "bitwise_and_2",
+                                 "call_8",
+                                 "common_subexpressions_2",
+                                 "divide_2",
+                                 "for_indexed_4",
+                                 "input_repeated_2",
+                                 "modulo_2",
+                                 "multiply_2",
+                                 "numeric_2",
+                                 "operators_repeated_4",
+                                 "parity_check_16",
+                                 "shift_4",
+                                 "single_longstatement_4"),
+                         [](const testing::TestParamInfo<SyrecCommonSubexpressionEliminationTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecCommonSubexpressionEliminationTest, EliminationPreservesFunctionalityOfParameters) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit circWithElimination;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithElimination, prog, createSettings()));
+    ASSERT_LE(circWithElimination.getLines(), circ.getLines());
+    ASSERT_LE(circWithElimination.numGates(), circ.numGates());
+
+    test::assertSimulatedLinesAreEqual(circ, circWithElimination, nParameterLines);
+}
+
+TEST_P(SyrecCommonSubexpressionEliminationTest, EliminationIsCompatibleWithDryRun) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, createSettings()));
+
+    Circuit    estimatedCirc;
+    const auto settings = createSettings();
+    settings->set("dry_run", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(estimatedCirc, prog, settings));
+    ASSERT_EQ(circ.getLines(), estimatedCirc.getLines());
+    ASSERT_EQ(circ.numGates(), estimatedCirc.numGates());
+    ASSERT_EQ(circ.quantumCost(), estimatedCirc.quantumCost());
+}
+
+TEST(SyrecCommonSubexpressionEliminationStatisticsTest, RepeatedSubexpressionsAreOnlyEvaluatedOnce) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/common_subexpressions_2.src", readSettings).empty());
+
+    Circuit    circ;
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, std::make_shared<Properties>(), statistics));
+    ASSERT_EQ(0U, statistics->get<unsigned>("reused_subexpressions"));
+
+    Circuit    circWithElimination;
+    const auto statisticsWithElimination = std::make_shared<Properties>();
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithElimination, prog, createSettings(), statisticsWithElimination));
+    ASSERT_LT(0U, statisticsWithElimination->get<unsigned>("reused_subexpressions"));
+    ASSERT_LT(circWithElimination.getLines(), circ.getLines());
+    ASSERT_LT(circWithElimination.numGates(), circ.numGates());
+    ASSERT_LT(statisticsWithElimination->get<unsigned>("total_constant_lines"), statistics->get<unsigned>("total_constant_lines"));
+}
+
+TEST(SyrecCommonSubexpressionEliminationStatisticsTest, EliminationIsIgnoredByLineAwareSynthesisAndWhenRecyclingConstantLines) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/common_subexpressions_2.src", readSettings).empty());
+
+    Circuit    lineAwareCirc;
+    const auto lineAwareStatistics = std::make_shared<Properties>();
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(lineAwareCirc, prog, createSettings(), lineAwareStatistics));
+    ASSERT_EQ(0U, lineAwareStatistics->get<unsigned>("reused_subexpressions"));
+
+    Circuit    circWithRecycling;
+    const auto settings   = createSettings();
+    const auto statistics = std::make_shared<Properties>();
+    settings->set("recycle_constant_lines", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithRecycling, prog, settings, statistics));
+    ASSERT_EQ(0U, statistics->get<unsigned>("reused_subexpressions"));
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "simulation_helpers.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class SyrecConstantLineBudgetTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+    std::size_t nParameterLines = 0;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+
+        nParameterLines = test::nParameterLinesOfMainModule(prog);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecConstantLineBudgetTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "bitwise_or_2",
+                                 "for_4",
+                                 "logical_or_1",
+                                 "modulo_2",
+                                 "multiply_2",
+                                 "negate_8",
+                                 "numeric_2",
+                                 "operators_repeated_4",
+                                 "parity_4",
+                                 "shift_4",
+                                 "simple_add_2",
+                                 "single_longstatement_4"),
+                         [](const testing::TestParamInfo<SyrecConstantLineBudgetTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecConstantLineBudgetTest, BudgetTradesGatesForLines) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    for (const unsigned constantLineBudget: {0U, 4U, 16U}) {
+        Circuit    circWithBudget;
+        const auto settings   = std::make_shared<Properties>();
+        const auto statistics = std::make_shared<Properties>();
+        settings->set("constant_line_budget", constantLineBudget);
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithBudget, prog, settings, statistics));
+
+        ASSERT_LE(circWithBudget.getLines(), circ.getLines()) << "Budget: " << std::to_string(constantLineBudget);
+        ASSERT_GE(circWithBudget.numGates(), circ.numGates()) << "Budget: " << std::to_string(constantLineBudget);
+        ASSERT_EQ(circWithBudget.getLines() - nParameterLines, statistics->get<unsigned>("added_constant_lines"));
+        test::assertSimulatedLinesAreEqual(circ, circWithBudget, nParameterLines);
+    }
+}
+
+TEST_P(SyrecConstantLineBudgetTest, ZeroBudgetRequiresNoMoreLinesThanRecyclingOfAssignments) {
+    Circuit    circWithRecycling;
+    const auto recyclingSettings = std::make_shared<Properties>();
+    recyclingSettings->set("recycle_constant_lines", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithRecycling, prog, recyclingSettings));
+
+    Circuit    circWithBudget;
+    const auto budgetSettings = std::make_shared<Properties>();
+    budgetSettings->set("constant_line_budget", 0U);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithBudget, prog, budgetSettings));
+
+    ASSERT_LE(circWithBudget.getLines(), circWithRecycling.getLines());
+    test::assertSimulatedLinesAreEqual(circWithRecycling, circWithBudget, nParameterLines);
+}
+
+TEST(SyrecConstantLineBudgetStatisticsTest, LargerBudgetKeepsMoreIntermediateResults) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/for_32.src", readSettings).empty());
+
+    std::vector<Circuit> circuits(3);
+    const unsigned       constantLineBudgets[] = {0U, 64U, 256U};
+    for (std::size_t i = 0; i < circuits.size(); ++i) {
+        const auto settings = std::make_shared<Properties>();
+        settings->set("constant_line_budget", constantLineBudgets[i]);
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(circuits[i], prog, settings));
+    }
+
+    for (std::size_t i = 1; i < circuits.size(); ++i) {
+        ASSERT_LT(circuits[i - 1].getLines(), circuits[i].getLines());
+        ASSERT_GT(circuits[i - 1].numGates(), circuits[i].numGates());
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "simulation_helpers.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+class SyrecConstantLineRecyclingTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+    std::size_t nParameterLines = 0;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+
+        nParameterLines = test::nParameterLinesOfMainModule(prog);
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecConstantLineRecyclingTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "bitwise_and_2",
+                                 "bitwise_or_2",
+                                 "for_4",
+                                 "logical_and_1",
+                                 "modulo_2",
+                                 "multiply_2",
+                                 "negate_8",
+                                 "numeric_2",
+                                 "parity_4",
+                                 "shift_4",
+                                 "simple_add_2",
+                                 "single_longstatement_4",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<SyrecConstantLineRecyclingTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecConstantLineRecyclingTest, RecyclingPreservesFunctionalityOfParameters) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithRecycling;
+    const auto settings   = std::make_shared<Properties>();
+    const auto statistics = std::make_shared<Properties>();
+    settings->set("recycle_constant_lines", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithRecycling, prog, settings, statistics));
+
+    ASSERT_LE(circWithRecycling.getLines(), circ.getLines());
+    ASSERT_LE(statistics->get<unsigned>("added_constant_lines"), statistics->get<unsigned>("total_constant_lines"));
+    ASSERT_EQ(circWithRecycling.getLines() - nParameterLines, statistics->get<unsigned>("added_constant_lines"));
+
+    test::assertSimulatedLinesAreEqual(circ, circWithRecycling, nParameterLines);
+}
+
+TEST(SyrecConstantLineRecyclingStatisticsTest, RecyclingBoundsLinesOfLoops) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/for_32.src", readSettings).empty());
+
+    Circuit    circ;
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, std::make_shared<Properties>(), statistics));
+    ASSERT_EQ(statistics->get<unsigned>("added_constant_lines"), statistics->get<unsigned>("total_constant_lines"));
+
+    Circuit    circWithRecycling;
+    const auto settings                = std::make_shared<Properties>();
+    const auto statisticsWithRecycling = std::make_shared<Properties>();
+    settings->set("recycle_constant_lines", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithRecycling, prog, settings, statisticsWithRecycling));
+
+    ASSERT_EQ(statistics->get<unsigned>("total_constant_lines"), statisticsWithRecycling->get<unsigned>("total_constant_lines"));
+    ASSERT_LT(statisticsWithRecycling->get<unsigned>("added_constant_lines"), statistics->get<unsigned>("added_constant_lines"));
+    ASSERT_LT(circWithRecycling.getLines(), circ.getLines());
+}
+
+TEST(SyrecConstantLineRecyclingStatisticsTest, RecyclingIsIgnoredByLineAwareSynthesis) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/for_32.src", readSettings).empty());
+
+    Circuit circ;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithRecycling;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("recycle_constant_lines", true);
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circWithRecycling, prog, settings));
+
+    ASSERT_EQ(circ.getLines(), circWithRecycling.getLines());
+    ASSERT_EQ(circ.numGates(), circWithRecycling.numGates());
+}
@@ -56,7 +56,8 @@ INSTANTIATE_TEST_SUITE_P(SyrecSimulationTest, SyrecAddLinesSimulationTest,
                                  "simple_add_2",
                                  "multiply_2",
                                  "modulo_2",
-                                 "negate_8"),
+                                 "negate_8",
+                                 "for_nested_2"),
                          [](const testing::TestParamInfo<SyrecAddLinesSimulationTest::ParamType>& info) {
                              auto s = info.param;
                              std::replace( s.begin(), s.end(), '-', '_');
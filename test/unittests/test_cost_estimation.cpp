@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+class SyrecCostEstimationTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+    }
+
+    static Properties::ptr createDryRunSettings() {
+        auto settings = std::make_shared<Properties>();
+        settings->set("dry_run", true);
+        return settings;
+    }
+
+    static void assertCostsAreEqual(const Circuit& expectedCirc, const Circuit& estimatedCirc) {
+        ASSERT_TRUE(estimatedCirc.isInCostEstimationMode());
+        ASSERT_EQ(estimatedCirc.cbegin(), estimatedCirc.cend());
+        ASSERT_EQ(expectedCirc.numGates(), estimatedCirc.numGates());
+        ASSERT_EQ(expectedCirc.getLines(), estimatedCirc.getLines());
+        ASSERT_EQ(expectedCirc.quantumCost(), estimatedCirc.quantumCost());
+        ASSERT_EQ(expectedCirc.transistorCost(), estimatedCirc.transistorCost());
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecCostEstimationTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "binary_numeric",
+                                 "bitwise_and_2",
+                                 "bitwise_or_2",
+                                 "bn_2",
+                                 "call_8",
+                                 "call_repeated_4",
+                                 "divide_2",
+                                 "for_4",
+                                 "for_32",
+                                 "for_indexed_4",
+                                 "gray_binary_conversion_16",
+                                 "input_repeated_2",
+                                 "input_repeated_4",
+                                 "logical_and_1",
+                                 "logical_or_1",
+                                 "modulo_2",
+                                 "multiple_statement_4",
+                                 "multiply_2",
+                                 "negate_8",
+                                 "numeric_2",
+                                 "operators_repeated_4",
+                                 "parity_4",
+                                 "parity_check_16",
+                                 "shift_4",
+                                 "simple_add_2",
+                                 "single_longstatement_4",
+                                 "skip",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<SyrecCostEstimationTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecCostEstimationTest, CostAwareSynthesisDryRunEstimatesCostsOfCircuit) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit estimatedCirc;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(estimatedCirc, prog, createDryRunSettings()));
+    assertCostsAreEqual(circ, estimatedCirc);
+}
+
+TEST_P(SyrecCostEstimationTest, LineAwareSynthesisDryRunEstimatesCostsOfCircuit) {
+    Circuit circ;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circ, prog));
+
+    Circuit estimatedCirc;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(estimatedCirc, prog, createDryRunSettings()));
+    assertCostsAreEqual(circ, estimatedCirc);
+}
+
+TEST_P(SyrecCostEstimationTest, DryRunIgnoresSettingsInspectingSynthesizedGates) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    estimatedCirc;
+    const auto settings = createDryRunSettings();
+    settings->set("recycle_constant_lines", true);
+    settings->set("memoize_module_synthesis", true);
+    settings->set("instantiate_loop_body_templates", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(estimatedCirc, prog, settings));
+    assertCostsAreEqual(circ, estimatedCirc);
+}
+
+TEST(SyrecCostEstimationModeTest, CostEstimationModeRequiresCircuitWithoutGates) {
+    Circuit circ;
+    circ.addLine("a", "a");
+    ASSERT_NE(nullptr, circ.createAndAddNotGate(0));
+    ASSERT_FALSE(circ.enableCostEstimationMode());
+    ASSERT_FALSE(circ.isInCostEstimationMode());
+}
+
+TEST(SyrecCostEstimationModeTest, CountedGatesIncludePropagatedControlLines) {
+    Circuit circ;
+    for (unsigned i = 0; i < 4; ++i) {
+        circ.addLine("i", "o");
+    }
+    ASSERT_TRUE(circ.enableCostEstimationMode());
+
+    ASSERT_TRUE(circ.registerControlLineForPropagationInCurrentAndNestedScopes(0));
+    ASSERT_NE(nullptr, circ.createAndAddToffoliGate(0, 1, 2));
+    ASSERT_NE(nullptr, circ.createAndAddFredkinGate(2, 3));
+    // A target line may not be a propagated control line
+    ASSERT_EQ(nullptr, circ.createAndAddNotGate(0));
+    ASSERT_EQ(nullptr, circ.createAndAddNotGate(4));
+    circ.deactivateControlLinePropagationScope();
+    ASSERT_NE(nullptr, circ.createAndAddNotGate(0));
+
+    ASSERT_EQ(3U, circ.numGates());
+    ASSERT_EQ(circ.cbegin(), circ.cend());
+    ASSERT_EQ(8U * (2U + 1U), circ.transistorCost());
+    ASSERT_EQ(Gate::quantumCost(Gate::Type::Toffoli, 2, 4) + Gate::quantumCost(Gate::Type::Fredkin, 1, 4) + Gate::quantumCost(Gate::Type::Toffoli, 0, 4), circ.quantumCost());
+}
+
+TEST(SyrecCostEstimationModeTest, InverseOfCountedGatesIsOnlyCountedIfControlLinesAreKnown) {
+    Circuit circ;
+    for (unsigned i = 0; i < 3; ++i) {
+        circ.addLine("i", "o");
+    }
+    ASSERT_TRUE(circ.enableCostEstimationMode());
+
+    Circuit::GateRange gateRange = circ.beginGateRange();
+    ASSERT_NE(nullptr, circ.createAndAddCnotGate(0, 1));
+    ASSERT_NE(nullptr, circ.createAndAddToffoliGate(0, 1, 2));
+    circ.endGateRange(gateRange);
+    ASSERT_EQ(2U, gateRange.size());
+
+    ASSERT_TRUE(circ.appendInverseOfGateRange(circ, gateRange));
+    ASSERT_EQ(4U, circ.numGates());
+    ASSERT_EQ(8U * 2U * (1U + 2U), circ.transistorCost());
+
+    // The control lines of the copies would include the propagated control line which is unknown for the counted gates
+    ASSERT_TRUE(circ.registerControlLineForPropagationInCurrentAndNestedScopes(0));
+    ASSERT_FALSE(circ.appendInverseOfGateRange(circ, gateRange));
+    ASSERT_FALSE(circ.appendInverseOfGateRange(circ, gateRange, {1, 0, 2}));
+    ASSERT_EQ(4U, circ.numGates());
+}
+
+TEST(SyrecCostEstimationModeTest, ModifiedPlaceholderGatesDoNotAffectOtherGates) {
+    Circuit circ;
+    for (unsigned i = 0; i < 3; ++i) {
+        circ.addLine("i", "o");
+    }
+    ASSERT_TRUE(circ.enableCostEstimationMode());
+
+    const auto notGate = circ.createAndAddNotGate(0);
+    ASSERT_NE(nullptr, notGate);
+    ASSERT_EQ(Gate::Type::Toffoli, notGate->type);
+    ASSERT_EQ(Gate::LinesLookup({0}), notGate->targets);
+    notGate->controls.emplace(1);
+    notGate->targets = {2};
+
+    const auto fredkinGate = circ.createAndAddFredkinGate(1, 2);
+    ASSERT_NE(nullptr, fredkinGate);
+    ASSERT_NE(notGate, fredkinGate);
+    ASSERT_EQ(Gate::Type::Fredkin, fredkinGate->type);
+    ASSERT_TRUE(fredkinGate->controls.empty());
+    ASSERT_EQ(Gate::LinesLookup({1, 2}), fredkinGate->targets);
+    ASSERT_EQ(Gate::quantumCost(Gate::Type::Toffoli, 0, 3) + Gate::quantumCost(Gate::Type::Fredkin, 0, 3), circ.quantumCost());
+}
+
+TEST(SyrecCostEstimationModeTest, DryRunEstimatesCostsOfNestedControlledStatements) {
+    const std::string program = "module main(inout a(2), inout b(2), inout c(2))\n"
+                                "  if a.0 then\n"
+                                "    if b.1 then\n"
+                                "      c += a;\n"
+                                "      if c.0 then ++= b else a <=> c fi c.0\n"
+                                "    else\n"
+                                "      c ^= (a + b)\n"
+                                "    fi b.1\n"
+                                "  else\n"
+                                "    --= c\n"
+                                "  fi a.0";
+    Program           prog;
+    ASSERT_TRUE(prog.readFromString(program).empty());
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("dry_run", true);
+    for (const bool isCostAware: {true, false}) {
+        Circuit circ;
+        Circuit estimatedCirc;
+        ASSERT_TRUE(isCostAware ? CostAwareSynthesis::synthesize(circ, prog) : LineAwareSynthesis::synthesize(circ, prog));
+        ASSERT_TRUE(isCostAware ? CostAwareSynthesis::synthesize(estimatedCirc, prog, settings) : LineAwareSynthesis::synthesize(estimatedCirc, prog, settings));
+        ASSERT_TRUE(estimatedCirc.isInCostEstimationMode());
+        ASSERT_EQ(circ.numGates(), estimatedCirc.numGates());
+        ASSERT_EQ(circ.getLines(), estimatedCirc.getLines());
+        ASSERT_EQ(circ.quantumCost(), estimatedCirc.quantumCost());
+        ASSERT_EQ(circ.transistorCost(), estimatedCirc.transistorCost());
+    }
+}
@@ -82,3 +82,17 @@ TEST_P(TestDDSynth, GenericDDSynthesisTest) {
     std::cout << synthesizer.numGate() << "\n";
     std::cout << synthesizer.getExecutionTime() << "\n";
 }
+
+TEST_P(TestDDSynth, CubeWiseDDSynthesisTest) {
+    EXPECT_TRUE(readPla(tt, fileName, false));
+    TruthTable extendedTT;
+    EXPECT_TRUE(readPla(extendedTT, fileName));
+
+    const auto ttDD = buildDDFromCubes(tt, dd);
+    EXPECT_TRUE(ttDD == buildDD(extendedTT, dd));
+
+    const auto qc = DDSynthesizer::synthesizeCubes(tt);
+    ASSERT_NE(qc, nullptr);
+    const auto& qcDD = dd::buildFunctionality(*qc, *dd);
+    EXPECT_TRUE(ttDD == qcDD);
+}
@@ -102,3 +102,19 @@ TEST_P(TestDDSynthDc, GenericDDSynthesisOnePass) {
 
     std::cout << qc->getNops() << "\n";
 }
+
+TEST_P(TestDDSynthDc, GenericDDSynthesisCubes) {
+    EXPECT_TRUE(readPla(tt, fileName, false));
+    TruthTable extendedTT;
+    EXPECT_TRUE(readPla(extendedTT, fileName));
+
+    const auto& qc = DDSynthesizer::synthesizeCubes(tt);
+
+    buildTruthTable(*qc, ttqc);
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, extendedTT));
+    EXPECT_TRUE(TruthTable::equal(extendedTT, ttqc));
+
+    // the DD built from the cubes equals the DD of the extended truth table, hence the circuit equals the one of the one-pass synthesis
+    EXPECT_EQ(qc->getNops(), DDSynthesizer::synthesizeOnePass(extendedTT)->getNops());
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <utility>
+
+using namespace syrec;
+
+namespace {
+    TruthTable parse(const std::string& pla) {
+        TruthTable         tt;
+        std::istringstream is(pla);
+        parsePla(tt, is);
+        return tt;
+    }
+} // namespace
+
+TEST(DenseTruthTableTest, ExtendedTableIsStoredDensely) {
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, "./circuits/dc3bit.pla"));
+    const auto& denseTT = std::as_const(tt);
+    ASSERT_TRUE(denseTT.isDense());
+    EXPECT_EQ(denseTT.size(), 8U);
+
+    // the rows are iterated in the order of their inputs without converting the table
+    std::uint64_t input = 0U;
+    for (const auto& [in, out]: denseTT) {
+        EXPECT_EQ(in.toInteger(), input++);
+        EXPECT_EQ(out, denseTT.getDenseOutputs().output(in.toInteger()));
+    }
+    EXPECT_EQ(input, 8U);
+    EXPECT_TRUE(denseTT.isDense());
+
+    TruthTable sparseTT = tt;
+    sparseTT.toSparse();
+    EXPECT_FALSE(sparseTT.isDense());
+    EXPECT_EQ(sparseTT.size(), 8U);
+    EXPECT_EQ(tt, sparseTT);
+    EXPECT_TRUE(TruthTable::equal(tt, sparseTT, false));
+
+    for (std::uint64_t i = 0U; i < 8U; ++i) {
+        const auto denseIt = denseTT.find(i, 3U);
+        ASSERT_NE(denseIt, denseTT.end());
+        EXPECT_EQ(denseIt->second, sparseTT.find(i, 3U)->second);
+    }
+    EXPECT_EQ(denseTT.find("1-0"), denseTT.end());
+
+    ASSERT_TRUE(sparseTT.toDense());
+    EXPECT_EQ(sparseTT.getDenseOutputs(), tt.getDenseOutputs());
+}
+
+TEST(DenseTruthTableTest, OverlappingCubesAreMerged) {
+    auto tt = parse(".i 2\n.o 2\n1- 10\n11 01\n0- -1\n");
+    extend(tt);
+    ASSERT_TRUE(std::as_const(tt).isDense());
+
+    const auto& outputs = tt.getDenseOutputs();
+    EXPECT_EQ(outputs.output(0b00U).toString(), "-1");
+    EXPECT_EQ(outputs.output(0b01U).toString(), "-1");
+    EXPECT_EQ(outputs.output(0b10U).toString(), "10");
+    // the 1's of the complete cube are added to the output of the preceding cube
+    EXPECT_EQ(outputs.output(0b11U).toString(), "11");
+    ASSERT_NE(outputs.careColumn(0U), nullptr);
+}
+
+TEST(DenseTruthTableTest, MutableAccessConvertsToSparseStorage) {
+    auto tt = parse(".i 2\n.o 1\n11 1\n");
+    extend(tt);
+    ASSERT_TRUE(tt.isDense());
+    EXPECT_EQ(tt.getDenseOutputs().careColumn(0U), nullptr);
+
+    tt[TruthTable::Cube::fromInteger(0b00U, 2U)] = TruthTable::Cube::fromInteger(1U, 1U);
+    EXPECT_FALSE(tt.isDense());
+    EXPECT_EQ(tt.size(), 4U);
+    EXPECT_TRUE(tt.find(0b00U, 2U)->second.equals(1U, 1U));
+    EXPECT_TRUE(tt.find(0b11U, 2U)->second.equals(1U, 1U));
+    EXPECT_TRUE(tt.find(0b01U, 2U)->second.equals(0U, 1U));
+}
+
+TEST(DenseTruthTableTest, IncompleteTableIsNotStoredDensely) {
+    auto tt = parse(".i 2\n.o 1\n1- 1\n00 0\n01 1\n");
+    EXPECT_FALSE(tt.toDense());
+    EXPECT_FALSE(tt.isDense());
+    EXPECT_FALSE(TruthTable().toDense());
+}
+
+TEST(DenseTruthTableTest, EqualityUpToDontCareComparesPrimaryOutputs) {
+    auto tt1 = parse(".i 2\n.o 2\n-- 1-\n");
+    auto tt2 = parse(".i 2\n.o 2\n-- 10\n");
+    auto tt3 = parse(".i 2\n.o 2\n-- 01\n");
+    extend(tt1);
+    extend(tt2);
+    extend(tt3);
+    EXPECT_TRUE(TruthTable::equal(tt1, tt2));
+    EXPECT_FALSE(TruthTable::equal(tt1, tt2, false));
+    EXPECT_FALSE(TruthTable::equal(tt1, tt3));
+
+    // the most significant output is garbage
+    tt1.setGarbage(1U);
+    tt3.setGarbage(1U);
+    EXPECT_TRUE(std::as_const(tt1).isDense());
+    EXPECT_TRUE(TruthTable::equal(tt1, tt3));
+}
+
+TEST(DenseTruthTableTest, TablesOfDifferentSizesAreNotEqual) {
+    auto tt1 = parse(".i 2\n.o 1\n-- 1\n");
+    auto tt2 = parse(".i 3\n.o 1\n--- 1\n");
+    extend(tt1);
+    extend(tt2);
+    ASSERT_TRUE(std::as_const(tt1).isDense());
+    ASSERT_TRUE(std::as_const(tt2).isDense());
+    EXPECT_FALSE(TruthTable::equal(tt1, tt2));
+    EXPECT_FALSE(TruthTable::equal(tt2, tt1));
+    EXPECT_FALSE(TruthTable::equal(tt1, parse(".i 2\n.o 1\n00 1\n")));
+}
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/gate.hpp"
+#include "core/hierarchical_circuit.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "simulation_helpers.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    void assertHierarchicalCircuitIsEquivalent(const Circuit& expectedCirc, const HierarchicalCircuit& hierarchicalCirc) {
+        Circuit flattenedCirc;
+        ASSERT_TRUE(hierarchicalCirc.flatten(flattenedCirc));
+        ASSERT_EQ(expectedCirc.getLines(), flattenedCirc.getLines());
+        ASSERT_EQ(expectedCirc.getConstants(), flattenedCirc.getConstants());
+        ASSERT_EQ(hierarchicalCirc.numGates(), flattenedCirc.numGates());
+        ASSERT_EQ(hierarchicalCirc.quantumCost(), flattenedCirc.quantumCost());
+        ASSERT_EQ(hierarchicalCirc.transistorCost(), flattenedCirc.transistorCost());
+
+        NBitValuesContainer expectedOutput(expectedCirc.getLines());
+        NBitValuesContainer flattenedOutput(flattenedCirc.getLines());
+        NBitValuesContainer hierarchicalOutput(flattenedCirc.getLines());
+        for (const auto values: test::simulatedInputPatterns(expectedCirc.getLines())) {
+            const auto input = test::createInput(expectedCirc, values);
+            simpleSimulation(expectedOutput, expectedCirc, input);
+            simpleSimulation(flattenedOutput, flattenedCirc, input);
+            simpleSimulation(hierarchicalOutput, hierarchicalCirc, input);
+            ASSERT_EQ(expectedOutput.stringify(), flattenedOutput.stringify());
+            ASSERT_EQ(expectedOutput.stringify(), hierarchicalOutput.stringify());
+        }
+    }
+
+    // Creates a circuit with a single line per variable that adds 1 to the value of the given lines
+    Circuit createIncrementCircuit(const unsigned lines) {
+        Circuit circ;
+        for (unsigned i = 0; i < lines; ++i) {
+            circ.addLine("x." + std::to_string(i), "x." + std::to_string(i));
+        }
+        for (Gate::Line target = lines; target > 1; --target) {
+            Gate::LinesLookup controls;
+            for (Gate::Line control = 0; control < target - 1; ++control) {
+                controls.emplace(control);
+            }
+            circ.createAndAddMultiControlToffoliGate(controls, target - 1);
+        }
+        if (lines != 0) {
+            circ.createAndAddNotGate(0);
+        }
+        return circ;
+    }
+
+    std::uint64_t valueOfLines(const NBitValuesContainer& values, const std::size_t begin, const std::size_t end) {
+        std::uint64_t value = 0;
+        for (std::size_t i = end; i > begin; --i) {
+            value = (value << 1U) | (values[i - 1] ? 1U : 0U);
+        }
+        return value;
+    }
+} // namespace
+
+class SyrecHierarchicalSynthesisTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecHierarchicalSynthesisTest,
+                         testing::Values(
+                                 "call_8",
+                                 "call_repeated_4",
+                                 "for_4",
+                                 "for_nested_2",
+                                 "negate_8"),
+                         [](const testing::TestParamInfo<SyrecHierarchicalSynthesisTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecHierarchicalSynthesisTest, CostAwareHierarchicalSynthesisIsEquivalent) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    HierarchicalCircuit hierarchicalCirc;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(hierarchicalCirc, prog));
+    assertHierarchicalCircuitIsEquivalent(circ, hierarchicalCirc);
+}
+
+TEST_P(SyrecHierarchicalSynthesisTest, LineAwareHierarchicalSynthesisIsEquivalent) {
+    Circuit circ;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circ, prog));
+
+    HierarchicalCircuit hierarchicalCirc;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(hierarchicalCirc, prog));
+    assertHierarchicalCircuitIsEquivalent(circ, hierarchicalCirc);
+}
+
+TEST(SyrecHierarchicalSynthesisStatisticsTest, RepeatedCallsAreInstantiated) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/call_repeated_4.src", readSettings).empty());
+
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    HierarchicalCircuit hierarchicalCirc;
+    const auto          statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(hierarchicalCirc, prog, std::make_shared<Properties>(), statistics));
+    ASSERT_EQ(hierarchicalCirc.numDefinitions() - 1U, statistics->get<unsigned>("module_definitions"));
+    ASSERT_EQ(hierarchicalCirc.numInstances(), statistics->get<unsigned>("module_instances"));
+    ASSERT_GT(hierarchicalCirc.numInstances(), hierarchicalCirc.numDefinitions() - 1U);
+
+    // The gates of the instantiated definitions are only stored once
+    std::size_t nStoredGates = 0;
+    for (HierarchicalCircuit::DefinitionId definition = 0; definition < hierarchicalCirc.numDefinitions(); ++definition) {
+        nStoredGates += hierarchicalCirc.getDefinition(definition).circuit.numGates();
+    }
+    ASSERT_LT(nStoredGates, hierarchicalCirc.numGates());
+    ASSERT_EQ(circ.quantumCost(), hierarchicalCirc.quantumCost());
+}
+
+TEST(HierarchicalCircuitTest, InvalidInstancesAreRejected) {
+    HierarchicalCircuit circ;
+    circ.getTopLevelCircuit().setLines(4);
+    const auto increment = circ.addDefinition("increment", createIncrementCircuit(2));
+    ASSERT_TRUE(increment.has_value());
+
+    // The top-level circuit cannot be instantiated and definitions cannot instantiate themselves
+    ASSERT_FALSE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {HierarchicalCircuit::TOP_LEVEL_DEFINITION, {0, 1, 2, 3}, false, {}}));
+    ASSERT_FALSE(circ.addDefinition("recursive", createIncrementCircuit(2), {{0, {*increment + 1, {0, 1}, false, {}}}}).has_value());
+    // The lines of the definition must be mapped to distinct lines of the enclosing definition that are not used as control lines
+    ASSERT_FALSE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {0}, false, {}}));
+    ASSERT_FALSE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {1, 1}, false, {}}));
+    ASSERT_FALSE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {0, 4}, false, {}}));
+    ASSERT_FALSE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {0, 1}, false, {1}}));
+    ASSERT_FALSE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {0, 1}, false, {4}}));
+    ASSERT_EQ(circ.numDefinitions(), 2U);
+    ASSERT_EQ(circ.numInstances(), 0U);
+
+    ASSERT_TRUE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {2, 3}, false, {0, 1}}));
+    ASSERT_EQ(circ.numInstances(), 1U);
+}
+
+TEST(HierarchicalCircuitTest, SimulationOfNestedInvertedAndControlledInstances) {
+    HierarchicalCircuit circ;
+    const auto          increment = circ.addDefinition("increment", createIncrementCircuit(3));
+    ASSERT_TRUE(increment.has_value());
+
+    // Adds 2 to the value of the lines by incrementing twice
+    Circuit linesOfAddTwo;
+    linesOfAddTwo.setLines(3);
+    const auto addTwo = circ.addDefinition("add_two", linesOfAddTwo, {{0, {*increment, {0, 1, 2}, false, {}}}, {0, {*increment, {0, 1, 2}, false, {}}}});
+    ASSERT_TRUE(addTwo.has_value());
+
+    Circuit& topLevelCircuit = circ.getTopLevelCircuit();
+    topLevelCircuit.setLines(4);
+    // x += 2; if c then x -= 1
+    ASSERT_TRUE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*addTwo, {0, 1, 2}, false, {}}));
+    ASSERT_TRUE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {0, 1, 2}, true, {3}}));
+
+    Circuit flattenedCirc;
+    ASSERT_TRUE(circ.flatten(flattenedCirc));
+    ASSERT_EQ(circ.numGates(), 9U);
+    ASSERT_EQ(flattenedCirc.numGates(), circ.numGates());
+    ASSERT_EQ(circ.quantumCost(), flattenedCirc.quantumCost());
+    ASSERT_EQ(circ.transistorCost(), flattenedCirc.transistorCost());
+
+    NBitValuesContainer output(4);
+    NBitValuesContainer flattenedOutput(4);
+    for (std::uint64_t value = 0; value < 16U; ++value) {
+        const NBitValuesContainer input(4, value);
+        simpleSimulation(output, circ, input);
+        simpleSimulation(flattenedOutput, flattenedCirc, input);
+        ASSERT_EQ(output.stringify(), flattenedOutput.stringify());
+
+        const std::uint64_t x        = value & 7U;
+        const bool          c        = ((value >> 3U) & 1U) != 0;
+        const std::uint64_t expected = (x + 2U - (c ? 1U : 0U)) & 7U;
+        ASSERT_EQ(valueOfLines(output, 0, 3), expected);
+        ASSERT_EQ(output[3], c);
+    }
+}
+
+TEST(HierarchicalCircuitTest, TruncationRemovesGatesAndInstances) {
+    HierarchicalCircuit circ;
+    const auto          increment = circ.addDefinition("increment", createIncrementCircuit(2));
+    ASSERT_TRUE(increment.has_value());
+
+    Circuit& topLevelCircuit = circ.getTopLevelCircuit();
+    topLevelCircuit.setLines(2);
+    topLevelCircuit.createAndAddNotGate(0);
+    ASSERT_TRUE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {0, 1}, false, {}}));
+    topLevelCircuit.createAndAddNotGate(1);
+    ASSERT_TRUE(circ.addInstance(HierarchicalCircuit::TOP_LEVEL_DEFINITION, {*increment, {1, 0}, false, {}}));
+    ASSERT_EQ(circ.numGates(), 6U);
+
+    // The kept instance must not succeed any of the removed gates
+    ASSERT_FALSE(circ.truncate(HierarchicalCircuit::TOP_LEVEL_DEFINITION, 0, 1));
+    ASSERT_FALSE(circ.truncate(HierarchicalCircuit::TOP_LEVEL_DEFINITION, 1, 3));
+    ASSERT_TRUE(circ.truncate(HierarchicalCircuit::TOP_LEVEL_DEFINITION, 1, 1));
+    ASSERT_EQ(topLevelCircuit.numGates(), 1U);
+    ASSERT_EQ(circ.numInstances(), 1U);
+    ASSERT_EQ(circ.numGates(), 3U);
+}
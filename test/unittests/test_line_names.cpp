@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // Names the lines of a variable by recursively concatenating the indices of its dimensions, i.e. the way the line names of variables used to be built
+    void appendLineNamesOfVariable(std::vector<std::string>& names, const std::string& name, const std::vector<unsigned>& dimensions, const unsigned bitwidth, const std::size_t dimension = 0) {
+        if (dimension == dimensions.size()) {
+            for (unsigned bit = 0; bit < bitwidth; ++bit) {
+                names.emplace_back(name + "." + std::to_string(bit));
+            }
+            return;
+        }
+        for (unsigned i = 0; i < dimensions[dimension]; ++i) {
+            appendLineNamesOfVariable(names, name + "[" + std::to_string(i) + "]", dimensions, bitwidth, dimension + 1);
+        }
+    }
+} // namespace
+
+TEST(LineNamesTest, LinesOfVariableAreNamedByTheirElementAndBit) {
+    Circuit circ;
+    circ.addLine("first", "first");
+
+    EXPECT_EQ(circ.addLinesOfVariable("a", {2, 3}, 2, constant(false), true), 1U);
+    ASSERT_EQ(circ.getLines(), 13U);
+    EXPECT_EQ(circ.getInput(1), "a[0][0].0");
+    EXPECT_EQ(circ.getInput(2), "a[0][0].1");
+    EXPECT_EQ(circ.getInput(6), "a[0][2].1");
+    EXPECT_EQ(circ.getInput(7), "a[1][0].0");
+    EXPECT_EQ(circ.getOutput(12), "a[1][2].1");
+    EXPECT_EQ(circ.getInputs(), circ.getOutputs());
+    EXPECT_FALSE(circ.getGarbage()[0]);
+    EXPECT_TRUE(circ.getGarbage()[12]);
+    EXPECT_EQ(circ.getConstants()[12], constant(false));
+
+    std::vector<std::string> expectedNames{"first"};
+    appendLineNamesOfVariable(expectedNames, "a", {2, 3}, 2);
+    EXPECT_EQ(circ.getInputs(), expectedNames);
+}
+
+TEST(LineNamesTest, LinesOfVariablesWithoutDimensionsOrBits) {
+    Circuit circ;
+
+    EXPECT_EQ(circ.addLinesOfVariable("x", {}, 3), 0U);
+    EXPECT_THAT(circ.getInputs(), testing::ElementsAre("x.0", "x.1", "x.2"));
+
+    EXPECT_EQ(circ.addLinesOfVariable("empty", {2, 0}, 3), 3U);
+    EXPECT_EQ(circ.addLinesOfVariable("empty", {2}, 0), 3U);
+    EXPECT_EQ(circ.getLines(), 3U);
+}
+
+TEST(LineNamesTest, CopiesOfLines) {
+    Circuit circ;
+    circ.addLinesOfVariable("a", {2}, 2, constant(true), true);
+    circ.addLine("in", "out");
+
+    EXPECT_EQ(circ.addLineCopy(circ, 3), 5U);
+    EXPECT_EQ(circ.addLineCopy(circ, 4), 6U);
+    EXPECT_EQ(circ.getInput(5), "a[1].1");
+    EXPECT_EQ(circ.getInput(6), "in");
+    EXPECT_EQ(circ.getOutput(6), "out");
+    EXPECT_EQ(circ.getConstants()[5], constant(true));
+    EXPECT_TRUE(circ.getGarbage()[5]);
+
+    Circuit other;
+    EXPECT_EQ(other.addLineCopy(circ, 2), 0U);
+    EXPECT_EQ(other.addLineCopy(circ, 4), 1U);
+    EXPECT_THAT(other.getInputs(), testing::ElementsAre("a[1].0", "in"));
+    EXPECT_THAT(other.getOutputs(), testing::ElementsAre("a[1].0", "out"));
+    EXPECT_EQ(other.getConstants()[0], constant(true));
+}
+
+TEST(LineNamesTest, SettingNamesReplacesNamesOfVariables) {
+    Circuit circ;
+    circ.addLinesOfVariable("a", {3}, 1);
+    circ.setInputs({"x", "y"});
+    circ.setOutputs({});
+
+    EXPECT_THAT(circ.getInputs(), testing::ElementsAre("x", "y", "i"));
+    EXPECT_THAT(circ.getOutputs(), testing::ElementsAre("o", "o", "o"));
+}
+
+TEST(LineNamesTest, NamesAreFormattedAgainAfterChangingTheLines) {
+    Circuit circ;
+    circ.addLinesOfVariable("a", {2}, 1);
+    EXPECT_THAT(circ.getInputs(), testing::ElementsAre("a[0].0", "a[1].0"));
+    EXPECT_EQ(circ.getInputs(), circ.formatInputs());
+
+    circ.addLine("in", "out");
+    circ.addLineCopy(circ, 0);
+    EXPECT_THAT(circ.getInputs(), testing::ElementsAre("a[0].0", "a[1].0", "in", "a[0].0"));
+    EXPECT_THAT(circ.getOutputs(), testing::ElementsAre("a[0].0", "a[1].0", "out", "a[0].0"));
+
+    circ.setOutputs({"x"});
+    EXPECT_THAT(circ.getOutputs(), testing::ElementsAre("x", "o", "o", "o"));
+    EXPECT_EQ(circ.getOutputs(), circ.formatOutputs());
+}
+
+TEST(LineNamesTest, NamesOfSynthesizedVariables) {
+    Program prog;
+    ASSERT_TRUE(prog.read("./circuits/for_nested_2.src").empty());
+
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    const auto&              mainModule = *prog.findModule("main");
+    std::vector<std::string> expectedNames;
+    for (const auto& variable: mainModule.parameters) {
+        appendLineNamesOfVariable(expectedNames, variable->name, variable->dimensions, variable->bitwidth);
+    }
+    const auto names = circ.getInputs();
+    ASSERT_GE(names.size(), expectedNames.size());
+    EXPECT_EQ(std::vector<std::string>(names.cbegin(), names.cbegin() + static_cast<std::ptrdiff_t>(expectedNames.size())), expectedNames);
+    EXPECT_EQ(circ.getInput(0), "a[0].0");
+}
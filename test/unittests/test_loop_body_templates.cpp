@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <algorithm>
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+class SyrecLoopBodyTemplatesTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+    }
+
+    static void assertCircuitsAreEqual(const Circuit& expectedCirc, const Circuit& actualCirc) {
+        ASSERT_EQ(expectedCirc.getLines(), actualCirc.getLines());
+        ASSERT_EQ(expectedCirc.getInputs(), actualCirc.getInputs());
+        ASSERT_EQ(expectedCirc.getOutputs(), actualCirc.getOutputs());
+        ASSERT_EQ(expectedCirc.getConstants(), actualCirc.getConstants());
+        ASSERT_EQ(expectedCirc.getGarbage(), actualCirc.getGarbage());
+        ASSERT_EQ(expectedCirc.numGates(), actualCirc.numGates());
+
+        auto actualGateIt = actualCirc.cbegin();
+        for (auto expectedGateIt = expectedCirc.cbegin(); expectedGateIt != expectedCirc.cend(); ++expectedGateIt, ++actualGateIt) {
+            ASSERT_EQ((*expectedGateIt)->type, (*actualGateIt)->type);
+            ASSERT_THAT((*actualGateIt)->controls, testing::ElementsAreArray((*expectedGateIt)->controls.cbegin(), (*expectedGateIt)->controls.cend()));
+            ASSERT_THAT((*actualGateIt)->targets, testing::ElementsAreArray((*expectedGateIt)->targets.cbegin(), (*expectedGateIt)->targets.cend()));
+            ASSERT_EQ(expectedCirc.getAnnotations(**expectedGateIt), actualCirc.getAnnotations(**actualGateIt));
+        }
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecLoopBodyTemplatesTest,
+                         testing::Values(
+                                 "call_repeated_4",
+                                 "for_4",
+                                 "for_32",
+                                 "for_indexed_4",
+                                 "for_long_8"),
+                         [](const testing::TestParamInfo<SyrecLoopBodyTemplatesTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecLoopBodyTemplatesTest, CostAwareSynthesisWithLoopBodyTemplatesCreatesSameCircuit) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithTemplates;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("instantiate_loop_body_templates", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithTemplates, prog, settings));
+    assertCircuitsAreEqual(circ, circWithTemplates);
+}
+
+TEST_P(SyrecLoopBodyTemplatesTest, LineAwareSynthesisWithLoopBodyTemplatesCreatesSameCircuit) {
+    Circuit circ;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithTemplates;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("instantiate_loop_body_templates", true);
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circWithTemplates, prog, settings));
+    assertCircuitsAreEqual(circ, circWithTemplates);
+}
+
+TEST_P(SyrecLoopBodyTemplatesTest, LoopBodyTemplatesAreCompatibleWithModuleSynthesisMemoization) {
+    Circuit    circ;
+    const auto memoizationSettings = std::make_shared<Properties>();
+    memoizationSettings->set("memoize_module_synthesis", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, memoizationSettings));
+
+    Circuit    circWithTemplates;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("memoize_module_synthesis", true);
+    settings->set("instantiate_loop_body_templates", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithTemplates, prog, settings));
+    assertCircuitsAreEqual(circ, circWithTemplates);
+}
+
+TEST_P(SyrecLoopBodyTemplatesTest, ConcurrentInstantiationOfLoopBodyTemplatesCreatesSameCircuit) {
+    Circuit    circ;
+    const auto templateSettings = std::make_shared<Properties>();
+    templateSettings->set("instantiate_loop_body_templates", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, templateSettings));
+
+    for (const unsigned nSynthesisThreads: {2U, 3U, 0U}) {
+        Circuit    circWithThreads;
+        const auto settings = std::make_shared<Properties>();
+        settings->set("instantiate_loop_body_templates", true);
+        settings->set("synthesis_threads", nSynthesisThreads);
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithThreads, prog, settings));
+        assertCircuitsAreEqual(circ, circWithThreads);
+    }
+}
+
+TEST(SyrecLoopBodyTemplatesStatisticsTest, OnlyTemplatableIterationsAreInstantiated) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/for_indexed_4.src", readSettings).empty());
+
+    Circuit    circ;
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, std::make_shared<Properties>(), statistics));
+    ASSERT_EQ(0U, statistics->get<unsigned>("instantiated_loop_iterations"));
+
+    Circuit    circWithTemplates;
+    const auto settings                = std::make_shared<Properties>();
+    const auto statisticsWithTemplates = std::make_shared<Properties>();
+    settings->set("instantiate_loop_body_templates", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithTemplates, prog, settings, statisticsWithTemplates));
+
+    // All but the first iteration of the first three loops are instantiated while the third iteration of the fourth loop accesses the same bit twice.
+    // The fifth loop accesses the lines of a variable both by the loop variable and by the called module and the loop variable of the last loop is used as the value of a numeric expression.
+    ASSERT_EQ(10U, statisticsWithTemplates->get<unsigned>("instantiated_loop_iterations"));
+    ASSERT_EQ(statistics->get<unsigned>("total_constant_lines"), statisticsWithTemplates->get<unsigned>("total_constant_lines"));
+    ASSERT_EQ(statistics->get<unsigned>("added_constant_lines"), statisticsWithTemplates->get<unsigned>("added_constant_lines"));
+}
+
+TEST(SyrecLoopBodyTemplatesStatisticsTest, LoopBodyTemplatesAreIgnoredWhenRecyclingConstantLines) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/for_indexed_4.src", readSettings).empty());
+
+    Circuit    circ;
+    const auto settings   = std::make_shared<Properties>();
+    const auto statistics = std::make_shared<Properties>();
+    settings->set("instantiate_loop_body_templates", true);
+    settings->set("recycle_constant_lines", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, settings, statistics));
+    ASSERT_EQ(0U, statistics->get<unsigned>("instantiated_loop_iterations"));
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "simulation_helpers.hpp"
+
+#include <algorithm>
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class SyrecModuleSynthesisMemoizationTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    Program     prog;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        ASSERT_TRUE(prog.read(testCircuitsDir + GetParam() + ".src", settings).empty());
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisTest, SyrecModuleSynthesisMemoizationTest,
+                         testing::Values(
+                                 "call_8",
+                                 "call_repeated_4",
+                                 "for_4",
+                                 "negate_8"),
+                         [](const testing::TestParamInfo<SyrecModuleSynthesisMemoizationTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecModuleSynthesisMemoizationTest, CostAwareSynthesisWithMemoizationIsEquivalent) {
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithMemoization;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("memoize_module_synthesis", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithMemoization, prog, settings));
+    test::assertCircuitsAreFunctionallyEquivalent(circ, circWithMemoization);
+}
+
+TEST_P(SyrecModuleSynthesisMemoizationTest, LineAwareSynthesisWithMemoizationIsEquivalent) {
+    Circuit circ;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithMemoization;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("memoize_module_synthesis", true);
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(circWithMemoization, prog, settings));
+    test::assertCircuitsAreFunctionallyEquivalent(circ, circWithMemoization);
+}
+
+TEST(SyrecModuleSynthesisMemoizationStatisticsTest, ReplayOfCalledModulesCreatesSameGates) {
+    Program                   prog;
+    const ReadProgramSettings readSettings;
+    ASSERT_TRUE(prog.read("./circuits/call_repeated_4.src", readSettings).empty());
+
+    Circuit    circ;
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog, std::make_shared<Properties>(), statistics));
+    ASSERT_EQ(0U, statistics->get<unsigned>("replayed_module_syntheses"));
+
+    Circuit    circWithMemoization;
+    const auto settings                  = std::make_shared<Properties>();
+    const auto statisticsWithMemoization = std::make_shared<Properties>();
+    settings->set("memoize_module_synthesis", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithMemoization, prog, settings, statisticsWithMemoization));
+
+    // Both modules are called four times in the loop while the additional call of the add module only differs in the order of its arguments.
+    // The uncall of the add module requires additional lines and is synthesized again while the uncall of the mix module inverts its cached call.
+    ASSERT_EQ(8U, statisticsWithMemoization->get<unsigned>("replayed_module_syntheses"));
+    ASSERT_EQ(statistics->get<unsigned>("total_constant_lines"), statisticsWithMemoization->get<unsigned>("total_constant_lines"));
+    ASSERT_EQ(circ.getLines(), circWithMemoization.getLines());
+    ASSERT_EQ(circ.getConstants(), circWithMemoization.getConstants());
+    ASSERT_LE(circWithMemoization.numGates(), circ.numGates());
+
+    // The gates of the inverted call of the mix module, which are annotated with the line number of its uncall, differ from the gates of its synthesized uncall
+    const std::string lineNumberOfUncallOfMixModule = "19";
+    auto              gateWithMemoizationIt         = circWithMemoization.cbegin();
+    for (auto gateIt = circ.cbegin(); gateIt != circ.cend() && circWithMemoization.getAnnotations(**gateWithMemoizationIt)->at("lno") != lineNumberOfUncallOfMixModule; ++gateIt, ++gateWithMemoizationIt) {
+        ASSERT_EQ((*gateIt)->type, (*gateWithMemoizationIt)->type);
+        ASSERT_THAT((*gateWithMemoizationIt)->controls, testing::ElementsAreArray((*gateIt)->controls.cbegin(), (*gateIt)->controls.cend()));
+        ASSERT_THAT((*gateWithMemoizationIt)->targets, testing::ElementsAreArray((*gateIt)->targets.cbegin(), (*gateIt)->targets.cend()));
+        ASSERT_EQ(circ.getAnnotations(**gateIt), circWithMemoization.getAnnotations(**gateWithMemoizationIt));
+    }
+}
+
+TEST(SyrecModuleSynthesisMemoizationStatisticsTest, CallControlledByItsOwnArgumentIsNotReplayedWithThatControl) {
+    // The control line of the if statement is the line of the argument a, which is also bound to the parameter x of the called module
+    Program prog;
+    ASSERT_TRUE(prog.readFromString("module inc(inout x(1), inout y(2))\n  ++= y\n\nmodule main(inout a(1), inout b(2))\n  if a then\n    call inc(a, b)\n  else\n    skip\n  fi a;\n  call inc(a, b)\n").empty());
+
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+
+    Circuit    circWithMemoization;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("memoize_module_synthesis", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithMemoization, prog, settings));
+    test::assertCircuitsAreFunctionallyEquivalent(circ, circWithMemoization);
+}
+
+TEST(SyrecModuleSynthesisMemoizationStatisticsTest, UncallOfSwapModuleUndoesItsCall) {
+    Program prog;
+    ASSERT_TRUE(prog.readFromString("module swap(inout x(2), inout y(2))\n  x <=> y\n\nmodule main(inout a(2), inout b(2))\n  call swap(a, b);\n  uncall swap(a, b)\n").empty());
+    Program identityProg;
+    ASSERT_TRUE(identityProg.readFromString("module main(inout a(2), inout b(2))\n  skip\n").empty());
+
+    Circuit identityCirc;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(identityCirc, identityProg));
+
+    Circuit circ;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+    test::assertSimulatedLinesAreEqual(identityCirc, circ, test::nParameterLinesOfMainModule(prog));
+
+    Circuit    circWithMemoization;
+    const auto settings = std::make_shared<Properties>();
+    settings->set("memoize_module_synthesis", true);
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithMemoization, prog, settings));
+    test::assertSimulatedLinesAreEqual(identityCirc, circWithMemoization, test::nParameterLinesOfMainModule(prog));
+}
+
+TEST(SyrecModuleSynthesisMemoizationStatisticsTest, RepeatedCallsOfModuleWithLocalVariableAreEquivalent) {
+    // The parser does not add local variables to the modules, hence the program is created explicitly:
+    // module inc(inout x(2)) wire w(2)  w ^= x; x += w
+    // module twice(inout y(2))          call inc(y); call inc(y)
+    // module main(inout a(2), inout b(2)) call inc(a); call inc(b); call twice(a); call twice(b)
+    const auto variableExpression = [](const Variable::ptr& var) {
+        auto access = std::make_shared<VariableAccess>();
+        access->setVar(var);
+        return std::make_shared<VariableExpression>(access);
+    };
+
+    const auto inc = std::make_shared<Module>("inc");
+    const auto x   = std::make_shared<Variable>(Variable::Inout, "x", std::vector<unsigned>{}, 2U);
+    const auto w   = std::make_shared<Variable>(Variable::Wire, "w", std::vector<unsigned>{}, 2U);
+    inc->addParameter(x);
+    inc->variables.emplace_back(w);
+    inc->addStatement(std::make_shared<AssignStatement>(variableExpression(w)->var, AssignStatement::Exor, variableExpression(x)));
+    inc->addStatement(std::make_shared<AssignStatement>(variableExpression(x)->var, AssignStatement::Add, variableExpression(w)));
+
+    const auto twice = std::make_shared<Module>("twice");
+    twice->addParameter(std::make_shared<Variable>(Variable::Inout, "y", std::vector<unsigned>{}, 2U));
+    twice->addStatement(std::make_shared<CallStatement>(inc, std::vector<std::string>{"y"}));
+    twice->addStatement(std::make_shared<CallStatement>(inc, std::vector<std::string>{"y"}));
+
+    const auto mainModule = std::make_shared<Module>("main");
+    mainModule->addParameter(std::make_shared<Variable>(Variable::Inout, "a", std::vector<unsigned>{}, 2U));
+    mainModule->addParameter(std::make_shared<Variable>(Variable::Inout, "b", std::vector<unsigned>{}, 2U));
+    mainModule->addStatement(std::make_shared<CallStatement>(inc, std::vector<std::string>{"a"}));
+    mainModule->addStatement(std::make_shared<CallStatement>(inc, std::vector<std::string>{"b"}));
+    mainModule->addStatement(std::make_shared<CallStatement>(twice, std::vector<std::string>{"a"}));
+    mainModule->addStatement(std::make_shared<CallStatement>(twice, std::vector<std::string>{"b"}));
+
+    Program prog;
+    prog.addModule(inc);
+    prog.addModule(twice);
+    prog.addModule(mainModule);
+
+    // The wire of the inc module keeps the lines of its first call in all later calls, which can neither be replayed for the calls of inc nor for the calls of twice
+    for (const auto lineAware: {false, true}) {
+        Circuit    circ;
+        Circuit    circWithMemoization;
+        const auto settings = std::make_shared<Properties>();
+        settings->set("memoize_module_synthesis", true);
+        if (lineAware) {
+            ASSERT_TRUE(LineAwareSynthesis::synthesize(circ, prog));
+            ASSERT_TRUE(LineAwareSynthesis::synthesize(circWithMemoization, prog, settings));
+        } else {
+            ASSERT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+            ASSERT_TRUE(CostAwareSynthesis::synthesize(circWithMemoization, prog, settings));
+        }
+        test::assertCircuitsAreFunctionallyEquivalent(circ, circWithMemoization);
+    }
+}
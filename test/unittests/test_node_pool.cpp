@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/node_pool.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class SyrecNodePoolTest: public testing::Test {
+protected:
+    std::string testCircuit = "./circuits/common_subexpressions_2.src";
+
+    // Collects the right-hand sides of the top-level assignments of the given module
+    static std::vector<Expression::ptr> getRhsOfAssignments(const Module& module) {
+        std::vector<Expression::ptr> rhs;
+        for (const auto& statement: module.statements) {
+            if (const auto assignStatement = std::dynamic_pointer_cast<AssignStatement>(statement)) {
+                rhs.emplace_back(assignStatement->rhs);
+            }
+        }
+        return rhs;
+    }
+};
+
+TEST_F(SyrecNodePoolTest, StructurallyEqualSubexpressionsAreShared) {
+    Program prog;
+    ASSERT_TRUE(prog.read(testCircuit).empty());
+
+    // x += (a + b); y ^= (b + a); c ^= ((a + b) * (a + b))
+    const auto rhs = getRhsOfAssignments(*prog.findModule("main"));
+    ASSERT_GE(rhs.size(), 3U);
+    EXPECT_NE(rhs[0], rhs[1]);
+
+    const auto product = std::dynamic_pointer_cast<BinaryExpression>(rhs[2]);
+    ASSERT_NE(product, nullptr);
+    EXPECT_EQ(product->lhs, rhs[0]);
+    EXPECT_EQ(product->rhs, rhs[0]);
+
+    const auto& pool = prog.nodePool();
+    ASSERT_TRUE(pool.getId(*rhs[0]).has_value());
+    EXPECT_EQ(pool.getId(*product->lhs), pool.getId(*rhs[0]));
+    EXPECT_NE(pool.getId(*rhs[0]), pool.getId(*rhs[1]));
+    EXPECT_GT(pool.numSharedNodes(), 0U);
+    EXPECT_GT(pool.allocatedBytes(), 0U);
+}
+
+TEST_F(SyrecNodePoolTest, AccessesOfDifferentModulesAreNotShared) {
+    Program prog;
+    ASSERT_TRUE(prog.read(testCircuit).empty());
+
+    // Both modules increment or assign to a parameter named x
+    const auto incStatement  = std::dynamic_pointer_cast<UnaryStatement>(prog.findModule("inc")->statements.front());
+    const auto mainStatement = std::dynamic_pointer_cast<AssignStatement>(prog.findModule("main")->statements.front());
+    ASSERT_NE(incStatement, nullptr);
+    ASSERT_NE(mainStatement, nullptr);
+    EXPECT_EQ(incStatement->var->getVar()->name, mainStatement->lhs->getVar()->name);
+    EXPECT_NE(incStatement->var, mainStatement->lhs);
+}
+
+TEST_F(SyrecNodePoolTest, IdsAreStableAcrossParses) {
+    Program first;
+    Program second;
+    ASSERT_TRUE(first.read(testCircuit).empty());
+    ASSERT_TRUE(second.read(testCircuit).empty());
+
+    const auto rhsOfFirst  = getRhsOfAssignments(*first.findModule("main"));
+    const auto rhsOfSecond = getRhsOfAssignments(*second.findModule("main"));
+    ASSERT_EQ(rhsOfFirst.size(), rhsOfSecond.size());
+    for (std::size_t i = 0; i < rhsOfFirst.size(); ++i) {
+        ASSERT_TRUE(first.nodePool().getId(*rhsOfFirst[i]).has_value());
+        EXPECT_EQ(first.nodePool().getId(*rhsOfFirst[i]), second.nodePool().getId(*rhsOfSecond[i]));
+    }
+    EXPECT_EQ(first.nodePool().numNodes(), second.nodePool().numNodes());
+    EXPECT_EQ(first.nodePool().numSharedNodes(), second.nodePool().numSharedNodes());
+}
+
+TEST_F(SyrecNodePoolTest, NodesOutliveProgram) {
+    Expression::ptr rhs;
+    {
+        Program prog;
+        ASSERT_TRUE(prog.read(testCircuit).empty());
+        rhs = getRhsOfAssignments(*prog.findModule("main")).front();
+    }
+    EXPECT_EQ(rhs->bitwidth(), 2U);
+}
+
+TEST_F(SyrecNodePoolTest, SynthesisOfSharedNodes) {
+    Program prog;
+    ASSERT_TRUE(prog.read(testCircuit).empty());
+
+    Circuit circ;
+    EXPECT_TRUE(CostAwareSynthesis::synthesize(circ, prog));
+    EXPECT_GT(circ.numGates(), 0U);
+}
+
+TEST(NodePoolTest, InternNumbersAndExpressions) {
+    NodePool pool;
+
+    EXPECT_EQ(pool.number(3U), pool.number(3U));
+    EXPECT_NE(pool.number(3U), pool.number(4U));
+    EXPECT_EQ(pool.loopVariable("i", 0U), pool.loopVariable("i", 0U));
+    EXPECT_NE(pool.loopVariable("i", 0U), pool.loopVariable("j", 0U));
+    EXPECT_NE(pool.loopVariable("i", 0U), pool.loopVariable("i", 1U));
+    EXPECT_EQ(pool.numericExpression(pool.number(1U), 4U), pool.numericExpression(pool.number(1U), 4U));
+    EXPECT_NE(pool.numericExpression(pool.number(1U), 4U), pool.numericExpression(pool.number(1U), 2U));
+
+    const auto var    = std::make_shared<Variable>(Variable::Inout, "a", std::vector<unsigned>{}, 4U);
+    const auto access = pool.variableAccess(var, std::nullopt, {});
+    EXPECT_EQ(access, pool.variableAccess(var, std::nullopt, {}));
+    EXPECT_NE(access, pool.variableAccess(var, std::make_pair(pool.number(0U), pool.number(1U)), {}));
+
+    const auto sum = pool.binaryExpression(pool.variableExpression(access), BinaryExpression::Add, pool.numericExpression(pool.number(1U), 4U));
+    EXPECT_EQ(sum, pool.binaryExpression(pool.variableExpression(access), BinaryExpression::Add, pool.numericExpression(pool.number(1U), 4U)));
+    EXPECT_NE(sum, pool.binaryExpression(pool.variableExpression(access), BinaryExpression::Subtract, pool.numericExpression(pool.number(1U), 4U)));
+    EXPECT_EQ(pool.shiftExpression(sum, ShiftExpression::Left, pool.number(1U)), pool.shiftExpression(sum, ShiftExpression::Left, pool.number(1U)));
+}
+
+TEST(NodePoolTest, IdsOfUnknownNodes) {
+    NodePool pool;
+
+    const Number unknownNumber(1U);
+    EXPECT_EQ(pool.getId(unknownNumber), std::nullopt);
+
+    // Nodes not created by the pool become known once they are used as children of a node of the pool
+    const auto externalNumber = std::make_shared<Number>(1U);
+    const auto expression     = pool.numericExpression(externalNumber, 2U);
+    EXPECT_TRUE(pool.getId(*externalNumber).has_value());
+    EXPECT_NE(pool.getId(*externalNumber), pool.getId(*pool.number(1U)));
+    EXPECT_TRUE(pool.getId(*expression).has_value());
+}
+
+TEST(NodePoolTest, ArenaAlignsAllocatedAddresses) {
+    NodeArena arena;
+
+    // Interleaving unaligned allocations shifts the offset of the following allocation within its chunk
+    for (const std::size_t alignment: {1U, 2U, 8U, 64U, 256U}) {
+        for (std::size_t i = 0; i < 3U; ++i) {
+            static_cast<void>(arena.allocate(1U, 1U));
+            const auto address = reinterpret_cast<std::uintptr_t>(arena.allocate(alignment, alignment)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            EXPECT_EQ(address % alignment, 0U);
+        }
+    }
+    // Nodes larger than a chunk are aligned as well
+    const auto address = reinterpret_cast<std::uintptr_t>(arena.allocate(128U * 1024U, 128U)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    EXPECT_EQ(address % 128U, 0U);
+}
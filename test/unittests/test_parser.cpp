@@ -8,9 +8,16 @@
  * Licensed under the MIT License
  */
 
+#include "core/syrec/expression.hpp"
 #include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
 
 #include "gtest/gtest.h"
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
 
 using namespace syrec;
 
@@ -35,6 +42,7 @@ INSTANTIATE_TEST_SUITE_P(SyrecParserTest, SyrecParserTest,
                                  "divide_2",
                                  "for_4",
                                  "for_32",
+                                 "for_nested_2",
                                  "gray_binary_conversion_16",
                                  "input_repeated_2",
                                  "input_repeated_4",
@@ -64,3 +72,60 @@ TEST_P(SyrecParserTest, GenericParserTest) {
     errorString = prog.read(fileName, settings);
     EXPECT_TRUE(errorString.empty());
 }
+
+TEST(SyrecParserLoopVariableTest, LoopVariablesAreBoundToSlotsOfNestedLoops) {
+    Program prog;
+    ASSERT_TRUE(prog.read("./circuits/for_nested_2.src").empty());
+
+    // The loop variable of the called module is bound to the same slot as the outermost loop variable of the caller
+    const auto& loopOfCallee = std::dynamic_pointer_cast<ForStatement>(prog.findModule("twice")->statements.front());
+    ASSERT_NE(loopOfCallee, nullptr);
+    EXPECT_EQ(loopOfCallee->loopVariableSlot, 0U);
+
+    const auto& outerLoop = std::dynamic_pointer_cast<ForStatement>(prog.findModule("main")->statements.front());
+    ASSERT_NE(outerLoop, nullptr);
+    EXPECT_EQ(outerLoop->loopVariableSlot, 0U);
+
+    const auto& innerLoop = std::dynamic_pointer_cast<ForStatement>(outerLoop->statements.back());
+    ASSERT_NE(innerLoop, nullptr);
+    EXPECT_EQ(innerLoop->loopVariableSlot, 1U);
+
+    // c[$j] += $i
+    const auto& assignment = std::dynamic_pointer_cast<AssignStatement>(innerLoop->statements.front());
+    ASSERT_NE(assignment, nullptr);
+    const auto& index = std::dynamic_pointer_cast<NumericExpression>(assignment->lhs->indexes.front());
+    const auto& value = std::dynamic_pointer_cast<NumericExpression>(assignment->rhs);
+    ASSERT_NE(index, nullptr);
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(index->value->loopVariableSlot(), 1U);
+    EXPECT_EQ(value->value->loopVariableSlot(), 0U);
+    EXPECT_EQ(index->value->evaluate({3U, 1U}), 1U);
+    EXPECT_EQ(value->value->evaluate({3U, 1U}), 3U);
+}
+
+TEST(SyrecParserReadFromStringTest, ReadsSameProgramAsFile) {
+    const std::string fileName = "./circuits/alu_2.src";
+    Program           fileProg;
+    ASSERT_TRUE(fileProg.read(fileName).empty());
+
+    std::ifstream     is(fileName);
+    const std::string content((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+    // The view does not need to end with a null character
+    const std::string buffer = content + "module";
+    Program           stringProg;
+    ASSERT_TRUE(stringProg.readFromString(std::string_view(buffer).substr(0, content.size())).empty());
+    ASSERT_EQ(stringProg.modules().size(), fileProg.modules().size());
+    EXPECT_EQ(stringProg.modules().front()->parameters.size(), fileProg.modules().front()->parameters.size());
+    EXPECT_EQ(stringProg.modules().front()->statements.size(), fileProg.modules().front()->statements.size());
+
+    Program spiritProg;
+    EXPECT_TRUE(spiritProg.readFromString(content, ReadProgramSettings(32U, true)).empty());
+}
+
+TEST(SyrecParserReadFromStringTest, ReportsErrors) {
+    Program prog;
+    EXPECT_EQ(prog.readFromString("module main(inout a(2))\n  b ^= 1"), "In line 0: Unknown variable %sb");
+    EXPECT_EQ(Program().readFromString(""), "PARSE_STRING_FAILED");
+    EXPECT_EQ(Program().read("./circuits/does_not_exist.src"), "PARSE_STRING_FAILED");
+}
@@ -8,11 +8,16 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/io/quantum_computation_import.hpp"
 #include "core/real/parser.hpp"
+#include "core/syrec/program.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/Permutation.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -21,6 +26,7 @@
 #include <initializer_list>
 #include <iomanip>
 #include <ios>
+#include <iterator>
 #include <optional>
 #include <sstream>
 #include <stdexcept>
@@ -1564,3 +1570,61 @@ TEST_F(RealParserTest, CombinationOfCommentLineAndWhitespacePostfixAllowed) {
     ASSERT_EQ(2, qc.getNqubits());
     ASSERT_EQ(1, qc.getNops());
 }
+
+TEST_F(RealParserTest, ImportOfGatesWithNegativeControlLines) {
+    usingVersion(DEFAULT_REAL_VERSION)
+            .usingNVariables(3)
+            .usingVariables({"v1", "v2", "v3"})
+            .withGates({"t3 -v1 v2 v3", "f2 v1 v3"});
+
+    EXPECT_NO_THROW(
+            qc = syrec::RealParser::import(realFileContent));
+
+    syrec::Circuit circ;
+    ASSERT_TRUE(syrec::importQuantumComputation(circ, qc));
+    ASSERT_EQ(3U, circ.getLines());
+    ASSERT_EQ(4U, circ.numGates());
+
+    // The negative control line is negated before and after the gate
+    auto gateIt = circ.cbegin();
+    ASSERT_THAT((*gateIt)->targets, testing::ElementsAre(0));
+    ASSERT_TRUE((*gateIt)->controls.empty());
+    ++gateIt;
+    ASSERT_THAT((*gateIt)->controls, testing::ElementsAre(0, 1));
+    ASSERT_THAT((*gateIt)->targets, testing::ElementsAre(2));
+    ++gateIt;
+    ASSERT_THAT((*gateIt)->targets, testing::ElementsAre(0));
+    ++gateIt;
+    ASSERT_EQ(syrec::Gate::Type::Fredkin, (*gateIt)->type);
+    ASSERT_THAT((*gateIt)->targets, testing::ElementsAre(0, 2));
+}
+
+TEST_F(RealParserTest, RealRepresentationOfSynthesizedCircuitCanBeImported) {
+    syrec::Program prog;
+    ASSERT_TRUE(prog.read("./circuits/alu_2.src").empty());
+    syrec::Circuit circ;
+    ASSERT_TRUE(syrec::CostAwareSynthesis::synthesize(circ, prog));
+
+    EXPECT_NO_THROW(
+            qc = syrec::RealParser::imports(circ.toReal()));
+
+    syrec::Circuit importedCirc;
+    ASSERT_TRUE(syrec::importQuantumComputation(importedCirc, qc));
+    ASSERT_EQ(circ.getLines(), importedCirc.getLines());
+    ASSERT_EQ(circ.getGarbage(), importedCirc.getGarbage());
+
+    // Constant lines are imported as ancillary lines with the initial value false that are negated by an additional gate if their constant value is true
+    const auto& constants             = circ.getConstants();
+    const auto  nLinesWithConstantOne = static_cast<std::size_t>(std::count(constants.cbegin(), constants.cend(), syrec::constant(true)));
+    ASSERT_EQ(circ.numGates() + nLinesWithConstantOne, importedCirc.numGates());
+    for (std::size_t line = 0; line < circ.getLines(); ++line) {
+        ASSERT_EQ(constants[line].has_value(), importedCirc.getConstants()[line].has_value());
+    }
+
+    auto importedGateIt = std::next(importedCirc.cbegin(), static_cast<std::ptrdiff_t>(nLinesWithConstantOne));
+    for (auto gateIt = circ.cbegin(); gateIt != circ.cend(); ++gateIt, ++importedGateIt) {
+        ASSERT_EQ((*gateIt)->type, (*importedGateIt)->type);
+        ASSERT_THAT((*importedGateIt)->controls, testing::ElementsAreArray((*gateIt)->controls.cbegin(), (*gateIt)->controls.cend()));
+        ASSERT_THAT((*importedGateIt)->targets, testing::ElementsAreArray((*gateIt)->targets.cbegin(), (*gateIt)->targets.cend()));
+    }
+}
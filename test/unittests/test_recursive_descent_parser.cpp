@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/syrec/lexer.hpp"
+#include "core/syrec/program.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+class SyrecRecursiveDescentParserTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    std::string fileName;
+
+    void SetUp() override {
+        fileName = testCircuitsDir + GetParam() + ".src";
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecRecursiveDescentParserTest, SyrecRecursiveDescentParserTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "binary_numeric",
+                                 "bitwise_and_2",
+                                 "bitwise_or_2",
+                                 "bn_2",
+                                 "call_8",
+                                 "call_repeated_4",
+                                 "common_subexpressions_2",
+                                 "divide_2",
+                                 "for_4",
+                                 "for_32",
+                                 "for_indexed_4",
+                                 "for_nested_2",
+                                 "gray_binary_conversion_16",
+                                 "input_repeated_2",
+                                 "input_repeated_4",
+                                 "logical_and_1",
+                                 "logical_or_1",
+                                 "modulo_2",
+                                 "multiple_statement_4",
+                                 "multiply_2",
+                                 "negate_8",
+                                 "numeric_2",
+                                 "operators_repeated_4",
+                                 "parity_4",
+                                 "parity_check_16",
+                                 "shift_4",
+                                 "simple_add_2",
+                                 "single_longstatement_4",
+                                 "skip",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<SyrecRecursiveDescentParserTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecRecursiveDescentParserTest, SynthesizesSameCircuitAsSpiritGrammar) {
+    Program recursiveDescentProg;
+    ASSERT_TRUE(recursiveDescentProg.read(fileName).empty());
+
+    Program spiritProg;
+    ASSERT_TRUE(spiritProg.read(fileName, ReadProgramSettings(32U, true)).empty());
+
+    ASSERT_EQ(recursiveDescentProg.modules().size(), spiritProg.modules().size());
+    for (std::size_t i = 0; i < spiritProg.modules().size(); ++i) {
+        EXPECT_EQ(recursiveDescentProg.modules()[i]->parameters.size(), spiritProg.modules()[i]->parameters.size());
+        EXPECT_EQ(recursiveDescentProg.modules()[i]->statements.size(), spiritProg.modules()[i]->statements.size());
+    }
+
+    Circuit recursiveDescentCirc;
+    Circuit spiritCirc;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(recursiveDescentCirc, recursiveDescentProg));
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(spiritCirc, spiritProg));
+    EXPECT_EQ(recursiveDescentCirc.toQasm(), spiritCirc.toQasm());
+}
+
+class SyrecRecursiveDescentParserErrorTest: public testing::Test {
+protected:
+    std::string fileName = "./recursive_descent_parser_test.src";
+
+    void TearDown() override {
+        std::remove(fileName.c_str());
+    }
+
+    // Parses the given program with both parsers and returns the error message of the recursive-descent parser after comparing it to the one of the Boost.Spirit grammar
+    std::string readWithBothParsers(const std::string& content) {
+        std::ofstream(fileName) << content;
+
+        Program     recursiveDescentProg;
+        std::string error = recursiveDescentProg.read(fileName);
+
+        Program     spiritProg;
+        std::string spiritError = spiritProg.read(fileName, ReadProgramSettings(32U, true));
+
+        EXPECT_EQ(error, spiritError);
+        EXPECT_EQ(recursiveDescentProg.modules().size(), spiritProg.modules().size());
+        return error;
+    }
+};
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, SyntaxError) {
+    // Unlike the Boost.Spirit grammar, which throws an exception for some syntax errors, the recursive-descent parser reports all of them
+    for (const std::string content: {"module main(inout a(2))\n  a ^= ", "", "module main(inout a(2))\n  a ^= (a + 1)\nmodule", "module main(inout a(2))\n  a ^= 99999999999999999999"}) {
+        std::ofstream(fileName) << content;
+        Program prog;
+        EXPECT_EQ(prog.read(fileName), "PARSE_STRING_FAILED");
+        EXPECT_TRUE(prog.modules().empty());
+    }
+}
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, UnknownVariable) {
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  a ^= 1;\n  b ^= 1"), "In line 2: Unknown variable %sb");
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  a ^= #b"), "In line 0: Unknown variable b");
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  a ^= $i"), "In line 0: Unknown loop variable $i");
+}
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, WrongBitwidth) {
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2), in b(3))\n  a ^= b"), "In line 0: Wrong bit-width in assignment to a");
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  a.2 ^= 1"), "In line 0: Bound 2 out of range in variable a(2)");
+}
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, Calls) {
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  call inc(a)\nmodule inc(inout x(2))\n  ++= x"), "In line 0: Unknown module inc");
+    EXPECT_EQ(readWithBothParsers("module inc(inout x(2))\n  ++= x\nmodule main(inout a(2))\n  call inc(a, a)"), "In line 2: Wrong number of arguments in (un)call of inc. Expected 1, got 2");
+    EXPECT_EQ(readWithBothParsers("module inc(inout x(2))\n  ++= x\nmodule main(inout a(3))\n  skip\n  uncall inc(a)"), "In line 4: 1. parameter (a) in (un)call of inc has bit-width of 3, but 2 is required");
+}
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, Redefinitions) {
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2), in a(2))\n  skip"), "In line 0: Redefinition of variable a");
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  for $i = 0 to 1 do\n    for $i = 0 to 1 do\n      skip\n    rof\n  rof"), "In line 0: Redefinition of loop variable $i");
+}
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, OrderOfSemanticChecks) {
+    // The fi-condition is checked before the branches, the end of a range before its start and the indexes of a variable after its bit range
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2), in c(1))\n  skip\n  if c then\n    x ^= 1\n  else\n    skip\n  fi d"), "In line 2: Unknown variable %sd");
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2), in c(1))\n  skip\n  if c then\n    skip;\n    x ^= 1\n  else\n    skip\n  fi c"), "In line 4: Unknown variable %sx");
+    EXPECT_EQ(readWithBothParsers("module main(inout a(2))\n  for $i = $j to $k do\n    skip\n  rof"), "In line 0: Unknown loop variable $k");
+    EXPECT_EQ(readWithBothParsers("module main(inout a[2](2))\n  a[x].3 ^= 1"), "In line 0: Bound 3 out of range in variable a(2)");
+    EXPECT_EQ(readWithBothParsers("module main(inout a[2](2))\n  a[x] ^= 1"), "In line 0: Unknown variable %sx");
+}
+
+TEST_F(SyrecRecursiveDescentParserErrorTest, ModulesPrecedingErrorAreAdded) {
+    EXPECT_EQ(readWithBothParsers("module inc(inout x(2))\n  ++= x\nmodule main(inout a(2))\n  a ^= b\nmodule dec(inout x(2))\n  --= x"), "In line 2: Unknown variable %sb");
+}
+
+TEST(SyrecLexerTest, OperatorsAreMatchedGreedily) {
+    Lexer                                       lexer("a <=> b[0].1:2 ^= (#c <= $i) // comment\n/* multi-line\ncomment */ ++= d;");
+    std::vector<std::pair<Token::Kind, unsigned>> tokens;
+    for (Token token = lexer.next(); token.kind != Token::Kind::EndOfInput; token = lexer.next()) {
+        tokens.emplace_back(token.kind, token.lineNumber);
+    }
+
+    const std::vector<std::pair<Token::Kind, unsigned>> expected{
+            {Token::Kind::Identifier, 1U}, {Token::Kind::Swap, 1U}, {Token::Kind::Identifier, 1U}, {Token::Kind::LeftBracket, 1U}, {Token::Kind::Number, 1U}, {Token::Kind::RightBracket, 1U}, {Token::Kind::Dot, 1U}, {Token::Kind::Number, 1U}, {Token::Kind::Colon, 1U}, {Token::Kind::Number, 1U}, {Token::Kind::Caret, 1U}, {Token::Kind::Assign, 1U}, {Token::Kind::LeftParenthesis, 1U}, {Token::Kind::Hash, 1U}, {Token::Kind::Identifier, 1U}, {Token::Kind::LessEquals, 1U}, {Token::Kind::Dollar, 1U}, {Token::Kind::Identifier, 1U}, {Token::Kind::RightParenthesis, 1U}, {Token::Kind::Increment, 3U}, {Token::Kind::Assign, 3U}, {Token::Kind::Identifier, 3U}};
+    EXPECT_EQ(tokens, expected);
+    EXPECT_EQ(Lexer("/* unterminated").next().kind, Token::Kind::Invalid);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class SyrecStatementKindsTest: public testing::Test {
+protected:
+    VariableAccess::ptr access;
+    Expression::ptr     expression;
+
+    void SetUp() override {
+        access = std::make_shared<VariableAccess>();
+        access->setVar(std::make_shared<Variable>(Variable::Inout, "a", std::vector<unsigned>{}, 2U));
+        expression = std::make_shared<VariableExpression>(access);
+    }
+};
+
+TEST_F(SyrecStatementKindsTest, KindsOfStatements) {
+    const auto module = std::make_shared<Module>("m");
+
+    EXPECT_EQ(SkipStatement().kind(), Statement::Kind::Skip);
+    EXPECT_EQ(SwapStatement(access, access).kind(), Statement::Kind::Swap);
+    EXPECT_EQ(UnaryStatement(UnaryStatement::Increment, access).kind(), Statement::Kind::Unary);
+    EXPECT_EQ(AssignStatement(access, AssignStatement::Add, expression).kind(), Statement::Kind::Assign);
+    EXPECT_EQ(IfStatement().kind(), Statement::Kind::If);
+    EXPECT_EQ(ForStatement().kind(), Statement::Kind::For);
+    EXPECT_EQ(CallStatement(module, {}).kind(), Statement::Kind::Call);
+    EXPECT_EQ(UncallStatement(module, {}).kind(), Statement::Kind::Uncall);
+}
+
+TEST_F(SyrecStatementKindsTest, KindsOfReversedStatements) {
+    const auto module = std::make_shared<Module>("m");
+
+    EXPECT_EQ(std::make_shared<SwapStatement>(access, access)->reverse()->kind(), Statement::Kind::Swap);
+    EXPECT_EQ(std::make_shared<CallStatement>(module, std::vector<std::string>{})->reverse()->kind(), Statement::Kind::Uncall);
+    EXPECT_EQ(std::make_shared<UncallStatement>(module, std::vector<std::string>{})->reverse()->kind(), Statement::Kind::Call);
+    EXPECT_EQ(std::make_shared<AssignStatement>(access, AssignStatement::Add, expression)->reverse()->kind(), Statement::Kind::Assign);
+}
+
+TEST_F(SyrecStatementKindsTest, KindsOfExpressions) {
+    const auto number = std::make_shared<Number>(1U);
+
+    EXPECT_EQ(NumericExpression(number, 2U).kind(), Expression::Kind::Numeric);
+    EXPECT_EQ(expression->kind(), Expression::Kind::Variable);
+    EXPECT_EQ(BinaryExpression(expression, BinaryExpression::Add, expression).kind(), Expression::Kind::Binary);
+    EXPECT_EQ(ShiftExpression(expression, ShiftExpression::Left, number).kind(), Expression::Kind::Shift);
+}
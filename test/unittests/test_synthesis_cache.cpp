@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_cache.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+class SyrecSynthesisCacheTest: public testing::TestWithParam<SynthesisScheme> {
+protected:
+    std::string cacheDirectory = (std::filesystem::temp_directory_path() / "syrec_synthesis_cache_test").string();
+    std::string program        = "module inc(inout x(4))\n  ++= x\nmodule main(inout a(4), inout b(4))\n  call inc(a);\n  uncall inc(b);\n  a += (b - 1)\n";
+
+    void SetUp() override {
+        std::filesystem::remove_all(cacheDirectory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(cacheDirectory);
+    }
+
+    bool synthesize(Circuit& circ, const std::string& source, const Properties::ptr& settings, const Properties::ptr& statistics) const {
+        Program prog;
+        EXPECT_TRUE(prog.readFromString(source).empty());
+        return GetParam() == SynthesisScheme::CostAware ? CostAwareSynthesis::synthesize(circ, prog, settings, statistics) : LineAwareSynthesis::synthesize(circ, prog, settings, statistics);
+    }
+
+    [[nodiscard]] std::string synthesizeWithoutCache(const std::string& source) const {
+        Circuit circ;
+        EXPECT_TRUE(synthesize(circ, source, std::make_shared<Properties>(), std::make_shared<Properties>()));
+        return circ.toQasm();
+    }
+
+    [[nodiscard]] Properties::ptr settingsWithCache() const {
+        auto settings = std::make_shared<Properties>();
+        settings->set("synthesis_cache_directory", cacheDirectory);
+        return settings;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisCacheTest, SyrecSynthesisCacheTest,
+                         testing::Values(SynthesisScheme::CostAware, SynthesisScheme::LineAware),
+                         [](const testing::TestParamInfo<SyrecSynthesisCacheTest::ParamType>& info) {
+                             return std::string(getNameOfSynthesisScheme(info.param)); });
+
+TEST_P(SyrecSynthesisCacheTest, CachedCircuitEqualsSynthesizedCircuit) {
+    const auto settings = settingsWithCache();
+    settings->set("memoize_module_synthesis", true);
+
+    Circuit    circ;
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+    EXPECT_FALSE(statistics->get<bool>("synthesis_cache_hit"));
+
+    Circuit    cachedCirc;
+    const auto cachedStatistics = std::make_shared<Properties>();
+    ASSERT_TRUE(synthesize(cachedCirc, program, settings, cachedStatistics));
+    EXPECT_TRUE(cachedStatistics->get<bool>("synthesis_cache_hit"));
+    EXPECT_EQ(cachedCirc.toQasm(), circ.toQasm());
+    EXPECT_EQ(cachedCirc.getGarbage(), circ.getGarbage());
+    EXPECT_EQ(cachedCirc.getConstants(), circ.getConstants());
+    for (const std::string statistic: {"total_constant_lines", "added_constant_lines", "replayed_module_syntheses"}) {
+        EXPECT_EQ(cachedStatistics->get<unsigned>(statistic), statistics->get<unsigned>(statistic));
+    }
+}
+
+TEST_P(SyrecSynthesisCacheTest, ChangedCalleeOrSettingsAreSynthesizedAgain) {
+    const auto settings   = settingsWithCache();
+    const auto statistics = std::make_shared<Properties>();
+    Circuit    circ;
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+
+    // Line numbers are not part of the key
+    circ = Circuit();
+    ASSERT_TRUE(synthesize(circ, "\n\n" + program, settings, statistics));
+    EXPECT_TRUE(statistics->get<bool>("synthesis_cache_hit"));
+
+    const std::string changedProgram = "module inc(inout x(4))\n  --= x\nmodule main(inout a(4), inout b(4))\n  call inc(a);\n  uncall inc(b);\n  a += (b - 1)\n";
+    circ                             = Circuit();
+    ASSERT_TRUE(synthesize(circ, changedProgram, settings, statistics));
+    EXPECT_FALSE(statistics->get<bool>("synthesis_cache_hit"));
+    EXPECT_EQ(circ.toQasm(), synthesizeWithoutCache(changedProgram));
+
+    settings->set("main_module", std::string("inc"));
+    circ = Circuit();
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+    EXPECT_FALSE(statistics->get<bool>("synthesis_cache_hit"));
+
+    settings->set("main_module", std::string("main"));
+    settings->set("eliminate_common_subexpressions", true);
+    settings->set("instantiate_loop_body_templates", true);
+    circ = Circuit();
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+    EXPECT_FALSE(statistics->get<bool>("synthesis_cache_hit"));
+}
+
+TEST_P(SyrecSynthesisCacheTest, CorruptedEntryIsSynthesizedAgain) {
+    const auto settings   = settingsWithCache();
+    const auto statistics = std::make_shared<Properties>();
+    Circuit    circ;
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+
+    for (const auto& entry: std::filesystem::directory_iterator(cacheDirectory)) {
+        std::ofstream(entry.path(), std::ios::binary | std::ios::trunc) << "SYCE";
+    }
+    circ = Circuit();
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+    EXPECT_FALSE(statistics->get<bool>("synthesis_cache_hit"));
+    EXPECT_EQ(circ.toQasm(), synthesizeWithoutCache(program));
+
+    // The corrupted entry was replaced
+    circ = Circuit();
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+    EXPECT_TRUE(statistics->get<bool>("synthesis_cache_hit"));
+    EXPECT_EQ(circ.toQasm(), synthesizeWithoutCache(program));
+}
+
+TEST_P(SyrecSynthesisCacheTest, CacheIsNotUsedForDryRun) {
+    const auto settings = settingsWithCache();
+    settings->set("dry_run", true);
+    const auto statistics = std::make_shared<Properties>();
+    Circuit    circ;
+    ASSERT_TRUE(synthesize(circ, program, settings, statistics));
+    EXPECT_FALSE(statistics->get<bool>("synthesis_cache_hit", false));
+    EXPECT_FALSE(std::filesystem::exists(cacheDirectory));
+}
+
+TEST(SyrecSynthesisCacheKeyTest, KeyDependsOnCalleesAndConfiguration) {
+    Program prog;
+    ASSERT_TRUE(prog.readFromString("module inc(inout x(4))\n  ++= x\nmodule dec(inout x(4))\n  --= x\nmodule main(inout a(4))\n  call inc(a)\n").empty());
+    Program changedProg;
+    ASSERT_TRUE(changedProg.readFromString("module inc(inout x(4))\n  ++= x; ++= x\nmodule dec(inout x(4))\n  --= x\nmodule main(inout a(4))\n  call inc(a)\n").empty());
+    Program otherProg;
+    ASSERT_TRUE(otherProg.readFromString("module inc(inout x(4))\n  ++= x\nmodule dec(inout x(4))\n  --= x; --= x\nmodule main(inout a(4))\n  call inc(a)\n").empty());
+
+    const auto key = SynthesisCache::computeKey(*prog.findModule("main"), "cost_aware");
+    EXPECT_EQ(key.size(), 16U);
+    EXPECT_NE(SynthesisCache::computeKey(*changedProg.findModule("main"), "cost_aware"), key);
+    EXPECT_NE(SynthesisCache::computeKey(*prog.findModule("main"), "line_aware"), key);
+    // The module dec is not called by the main module
+    EXPECT_EQ(SynthesisCache::computeKey(*otherProg.findModule("main"), "cost_aware"), key);
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_server.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/io/binary_circuit.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/io/quantum_computation_import.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <variant>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    std::string readFile(const std::string& fileName) {
+        std::ifstream is(fileName);
+        return {std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    }
+
+    std::string synthesizeInProcess(const std::string& source, const SynthesisScheme scheme) {
+        Program prog;
+        EXPECT_TRUE(prog.readFromString(source).empty());
+        Circuit    circ;
+        const auto settings = std::make_shared<Properties>();
+        settings->set("memoize_module_synthesis", true);
+        EXPECT_TRUE(scheme == SynthesisScheme::CostAware ? CostAwareSynthesis::synthesize(circ, prog, settings) : LineAwareSynthesis::synthesize(circ, prog, settings));
+        return circ.toQasm();
+    }
+
+    std::string toQasm(const SynthesisResponse& response) {
+        Circuit            circ;
+        std::istringstream is(response.circuit);
+        EXPECT_TRUE(readBinaryCircuit(circ, is));
+        return circ.toQasm();
+    }
+} // namespace
+
+TEST(SyrecSynthesisServerProtocolTest, RequestsAndResponsesAreDecodedAsEncoded) {
+    SynthesisRequest request;
+    request.format        = SynthesisRequest::Format::Pla;
+    request.content       = std::string("module main(inout a(2))\n  ++= a\n\0", 33);
+    request.scheme        = SynthesisScheme::LineAware;
+    request.ddMethod      = DdSynthesisMethod::CodingWithoutAdditionalLine;
+    request.settings      = {{"main_module", std::string("main")}, {"memoize_module_synthesis", true}, {"constant_line_budget", 7U}};
+    request.returnCircuit = false;
+
+    const auto decodedRequest = SynthesisRequest::decode(request.encode());
+    ASSERT_TRUE(decodedRequest.has_value());
+    EXPECT_EQ(decodedRequest->format, request.format);
+    EXPECT_EQ(decodedRequest->content, request.content);
+    EXPECT_EQ(decodedRequest->scheme, request.scheme);
+    EXPECT_EQ(decodedRequest->ddMethod, request.ddMethod);
+    EXPECT_EQ(decodedRequest->settings, request.settings);
+    EXPECT_EQ(decodedRequest->returnCircuit, request.returnCircuit);
+
+    SynthesisResponse response;
+    response.error      = "error";
+    response.statistics = {{"runtime", 0.25}, {"gates", std::uint64_t{1} << 40U}, {"reused_circuit", true}};
+    response.circuit    = "SYRC";
+
+    const auto decodedResponse = SynthesisResponse::decode(response.encode());
+    ASSERT_TRUE(decodedResponse.has_value());
+    EXPECT_EQ(decodedResponse->error, response.error);
+    EXPECT_EQ(decodedResponse->statistics, response.statistics);
+    EXPECT_EQ(decodedResponse->circuit, response.circuit);
+}
+
+TEST(SyrecSynthesisServerProtocolTest, MalformedPayloadsAreRejected) {
+    const auto encodedRequest = SynthesisRequest().encode();
+    for (std::size_t length = 0; length < encodedRequest.size(); ++length) {
+        EXPECT_FALSE(SynthesisRequest::decode(encodedRequest.substr(0, length)).has_value());
+    }
+    EXPECT_FALSE(SynthesisRequest::decode(encodedRequest + "x").has_value());
+
+    auto unknownFormat = encodedRequest;
+    unknownFormat[1]   = 3;
+    EXPECT_FALSE(SynthesisRequest::decode(unknownFormat).has_value());
+
+    const auto encodedResponse = SynthesisResponse().encode();
+    for (std::size_t length = 0; length < encodedResponse.size(); ++length) {
+        EXPECT_FALSE(SynthesisResponse::decode(encodedResponse.substr(0, length)).has_value());
+    }
+}
+
+#if !defined(_WIN32)
+namespace {
+    // A socket per test and process, so that tests running in parallel do not share a socket
+    std::string getUniqueSocketPath() {
+        const auto* testInfo = testing::UnitTest::GetInstance()->current_test_info();
+        return "./" + std::string(testInfo->name()) + "_" + std::to_string(::getpid()) + ".sock";
+    }
+} // namespace
+
+class SyrecSynthesisServerTest: public testing::Test {
+protected:
+    std::string     socketPath = getUniqueSocketPath();
+    SynthesisServer server{socketPath, 4U};
+
+    void SetUp() override {
+        std::remove(socketPath.c_str());
+        ASSERT_EQ(server.start(), "");
+    }
+
+    void TearDown() override {
+        server.stop();
+    }
+};
+
+TEST_F(SyrecSynthesisServerTest, ConcurrentClientsReceiveSynthesizedCircuits) {
+    const std::vector<std::string> fileNames{"./circuits/alu_2.src", "./circuits/call_8.src", "./circuits/for_nested_2.src", "./circuits/negate_8.src"};
+
+    std::vector<std::thread>       clients;
+    std::vector<SynthesisResponse> responses(fileNames.size() * 2U);
+    for (std::size_t i = 0; i < responses.size(); ++i) {
+        clients.emplace_back([&, i]() {
+            SynthesisRequest request;
+            request.content  = readFile(fileNames[i % fileNames.size()]);
+            request.scheme   = i < fileNames.size() ? SynthesisScheme::CostAware : SynthesisScheme::LineAware;
+            request.settings = {{"memoize_module_synthesis", true}};
+            responses[i]     = sendSynthesisRequest(socketPath, request);
+        });
+    }
+    for (auto& client: clients) {
+        client.join();
+    }
+
+    for (std::size_t i = 0; i < responses.size(); ++i) {
+        ASSERT_EQ(responses[i].error, "");
+        const auto scheme = i < fileNames.size() ? SynthesisScheme::CostAware : SynthesisScheme::LineAware;
+        EXPECT_EQ(toQasm(responses[i]), synthesizeInProcess(readFile(fileNames[i % fileNames.size()]), scheme));
+        Circuit            circ;
+        std::istringstream is(responses[i].circuit);
+        ASSERT_TRUE(readBinaryCircuit(circ, is));
+        EXPECT_EQ(std::get<std::uint64_t>(responses[i].statistics.at("gates")), circ.numGates());
+    }
+}
+
+TEST_F(SyrecSynthesisServerTest, CachesAreKeptBetweenRequests) {
+    const std::string inc  = "module inc(inout x(4))\n  ++= x\n";
+    const std::string main = "module main(inout a(4), inout b(4))\n  call inc(a);\n  uncall inc(b);\n  a ^= b\n";
+
+    SynthesisRequest request;
+    request.content = inc + main;
+    auto response   = sendSynthesisRequest(socketPath, request);
+    ASSERT_EQ(response.error, "");
+    EXPECT_FALSE(std::get<bool>(response.statistics.at("reused_response")));
+
+    // The repeated request is answered by the response to the previous request
+    response = sendSynthesisRequest(socketPath, request);
+    ASSERT_EQ(response.error, "");
+    EXPECT_TRUE(std::get<bool>(response.statistics.at("reused_response")));
+    EXPECT_EQ(toQasm(response), synthesizeInProcess(inc + main, SynthesisScheme::CostAware));
+
+    // Only the changed module of the program is parsed again
+    request.content = inc + "module main(inout a(4), inout b(4))\n  call inc(a);\n  uncall inc(b);\n  b ^= a\n";
+    response        = sendSynthesisRequest(socketPath, request);
+    ASSERT_EQ(response.error, "");
+    EXPECT_EQ(std::get<std::uint64_t>(response.statistics.at("reparsed_modules")), 1U);
+    EXPECT_EQ(std::get<std::uint64_t>(response.statistics.at("reused_modules")), 1U);
+    EXPECT_EQ(toQasm(response), synthesizeInProcess(request.content, SynthesisScheme::CostAware));
+
+    // Only the statistics are returned
+    request.returnCircuit = false;
+    response              = sendSynthesisRequest(socketPath, request);
+    ASSERT_EQ(response.error, "");
+    EXPECT_TRUE(response.circuit.empty());
+    EXPECT_GT(std::get<std::uint64_t>(response.statistics.at("gates")), 0U);
+}
+
+TEST_F(SyrecSynthesisServerTest, ErrorsAreReported) {
+    SynthesisRequest request;
+    request.content = "module main(inout a(2))\n  b ^= a\n";
+    EXPECT_EQ(sendSynthesisRequest(socketPath, request).error, Program().readFromString(request.content));
+
+    request.content  = "module main(inout a(2))\n  ++= a\n";
+    request.settings = {{"main_module", std::string("unknown")}};
+    EXPECT_EQ(sendSynthesisRequest(socketPath, request).error, "Synthesis of program failed");
+
+    request.format  = SynthesisRequest::Format::Real;
+    request.content = ".version 2.0\n.numvars 1\n.variables a\n.begin\nx1 b\n.end\n";
+    EXPECT_NE(sendSynthesisRequest(socketPath, request).error, "");
+}
+
+TEST_F(SyrecSynthesisServerTest, TruthTablesAreSynthesizedByDdBasedSynthesis) {
+    SynthesisRequest request;
+    request.format      = SynthesisRequest::Format::Pla;
+    request.content     = readFile("./circuits/4gt5.pla");
+    request.ddMethod    = DdSynthesisMethod::Coding;
+    const auto response = sendSynthesisRequest(socketPath, request);
+    ASSERT_EQ(response.error, "");
+
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, "./circuits/4gt5.pla"));
+    const auto qc = DDSynthesizer::synthesizeTruthTable(tt, DdSynthesisMethod::Coding);
+    ASSERT_NE(qc, nullptr);
+    Circuit circ;
+    ASSERT_TRUE(importQuantumComputation(circ, *qc));
+    EXPECT_EQ(toQasm(response), circ.toQasm());
+}
+
+TEST_F(SyrecSynthesisServerTest, SocketOfRunningServerIsNotReplaced) {
+    SynthesisServer secondServer(socketPath, 1U);
+    EXPECT_NE(secondServer.start(), "");
+
+    SynthesisRequest request;
+    request.content = "module main(inout a(2))\n  ++= a\n";
+    EXPECT_EQ(sendSynthesisRequest(socketPath, request).error, "");
+}
+
+TEST(SyrecSynthesisServerIdleTimeoutTest, IdleConnectionsAreClosed) {
+    const auto      socketPath = getUniqueSocketPath();
+    SynthesisServer server(socketPath, 1U, std::chrono::milliseconds(200));
+    std::remove(socketPath.c_str());
+    ASSERT_EQ(server.start(), "");
+
+    // The only worker thread serves the connection of a client that does not send any request until the connection is closed by the server
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::copy(socketPath.cbegin(), socketPath.cend(), static_cast<char*>(address.sun_path));
+    const int idleClient = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    ASSERT_GE(idleClient, 0);
+    ASSERT_EQ(::connect(idleClient, reinterpret_cast<const sockaddr*>(&address), sizeof(address)), 0);
+
+    SynthesisRequest request;
+    request.content = "module main(inout a(2))\n  ++= a\n";
+    EXPECT_EQ(sendSynthesisRequest(socketPath, request).error, "");
+
+    char data = 0;
+    EXPECT_EQ(::recv(idleClient, &data, 1, 0), 0);
+    ::close(idleClient);
+    server.stop();
+}
+
+TEST(SyrecSynthesisClientTest, UnreachableServerIsReported) {
+    EXPECT_EQ(sendSynthesisRequest("./no_synthesis_server.sock", SynthesisRequest()).error, "Could not connect to synthesis server at ./no_synthesis_server.sock");
+}
+#endif
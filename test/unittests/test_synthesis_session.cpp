@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/batch_synthesis.hpp"
+#include "algorithms/synthesis/synthesis_session.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/circuit.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+class SyrecSynthesisSessionTest: public testing::TestWithParam<SynthesisScheme> {
+protected:
+    std::string inc  = "module inc(inout x(4))\n  ++= x\n";
+    std::string dec  = "module dec(inout x(4))\n  --= x\n";
+    std::string main = "module main(inout a(4), inout b(4))\n  call inc(a);\n  uncall inc(b);\n  a ^= b\n";
+
+    // Synthesizes the program from scratch with the memoization of module syntheses used by the session
+    [[nodiscard]] std::string synthesizeFromScratch(const std::string& source) const {
+        Program prog;
+        EXPECT_TRUE(prog.readFromString(source).empty());
+
+        Circuit    circ;
+        const auto settings = std::make_shared<Properties>();
+        settings->set("memoize_module_synthesis", true);
+        const bool synthesisOk = GetParam() == SynthesisScheme::CostAware ? CostAwareSynthesis::synthesize(circ, prog, settings) : LineAwareSynthesis::synthesize(circ, prog, settings);
+        EXPECT_TRUE(synthesisOk);
+        return circ.toQasm();
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecSynthesisSessionTest, SyrecSynthesisSessionTest,
+                         testing::Values(SynthesisScheme::CostAware, SynthesisScheme::LineAware),
+                         [](const testing::TestParamInfo<SyrecSynthesisSessionTest::ParamType>& info) {
+                             return std::string(getNameOfSynthesisScheme(info.param)); });
+
+TEST_P(SyrecSynthesisSessionTest, SynthesizesSameCircuitAsFromScratch) {
+    for (const std::string fileName: {"./circuits/call_8.src", "./circuits/call_repeated_4.src", "./circuits/for_nested_2.src", "./circuits/alu_2.src"}) {
+        std::ifstream     is(fileName);
+        const std::string source((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+        SynthesisSession session(GetParam());
+        ASSERT_TRUE(session.parse(source).empty());
+        ASSERT_TRUE(session.synthesize());
+        EXPECT_EQ(session.circuit().toQasm(), synthesizeFromScratch(source));
+    }
+}
+
+TEST_P(SyrecSynthesisSessionTest, OnlyChangedModulesAndTheirCallersAreParsedAgain) {
+    SynthesisSession session(GetParam());
+    const auto       statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(session.parse(inc + dec + main, statistics).empty());
+    EXPECT_EQ(statistics->get<unsigned>("reparsed_modules"), 3U);
+    ASSERT_TRUE(session.synthesize(statistics));
+    EXPECT_FALSE(statistics->get<bool>("reused_circuit"));
+
+    // Unchanged program
+    ASSERT_TRUE(session.parse(inc + dec + main, statistics).empty());
+    EXPECT_EQ(statistics->get<unsigned>("reparsed_modules"), 0U);
+    EXPECT_EQ(statistics->get<unsigned>("reused_modules"), 3U);
+    ASSERT_TRUE(session.synthesize(statistics));
+    EXPECT_TRUE(statistics->get<bool>("reused_circuit"));
+
+    // Changed main module, whose calls replay the syntheses of the previous version
+    const std::string changedMain = "module main(inout a(4), inout b(4))\n  call inc(a);\n  uncall inc(b);\n  b ^= a\n";
+    ASSERT_TRUE(session.parse(inc + dec + changedMain, statistics).empty());
+    EXPECT_EQ(statistics->get<unsigned>("reparsed_modules"), 1U);
+    EXPECT_EQ(statistics->get<unsigned>("reused_modules"), 2U);
+    ASSERT_TRUE(session.synthesize(statistics));
+    EXPECT_FALSE(statistics->get<bool>("reused_circuit"));
+    EXPECT_GT(statistics->get<unsigned>("replayed_module_syntheses"), 0U);
+    EXPECT_EQ(session.circuit().toQasm(), synthesizeFromScratch(inc + dec + changedMain));
+
+    // Changed callee, whose callers are parsed again while the module not called by the changed module is reused
+    const std::string changedInc = "module inc(inout x(4))\n  ++= x; ++= x\n";
+    ASSERT_TRUE(session.parse(changedInc + dec + changedMain, statistics).empty());
+    EXPECT_EQ(statistics->get<unsigned>("reparsed_modules"), 2U);
+    EXPECT_EQ(statistics->get<unsigned>("reused_modules"), 1U);
+    ASSERT_TRUE(session.synthesize(statistics));
+    EXPECT_EQ(session.circuit().toQasm(), synthesizeFromScratch(changedInc + dec + changedMain));
+}
+
+TEST_P(SyrecSynthesisSessionTest, CircuitIsKeptIfNoCalledModuleChanged) {
+    SynthesisSession session(GetParam());
+    const auto       statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(session.parse(inc + dec + main).empty());
+    ASSERT_TRUE(session.synthesize());
+
+    // The module dec is not called by the main module
+    const std::string changedDec = "module dec(inout x(4))\n  --= x; --= x\n";
+    ASSERT_TRUE(session.parse(inc + changedDec + main, statistics).empty());
+    EXPECT_EQ(statistics->get<unsigned>("reparsed_modules"), 1U);
+    ASSERT_TRUE(session.synthesize(statistics));
+    EXPECT_TRUE(statistics->get<bool>("reused_circuit"));
+    EXPECT_EQ(session.circuit().toQasm(), synthesizeFromScratch(inc + changedDec + main));
+}
+
+TEST_P(SyrecSynthesisSessionTest, VersionsParsedWithoutSynthesisDoNotReuseReplacedModules) {
+    SynthesisSession session(GetParam());
+    ASSERT_TRUE(session.parse(inc + dec + main).empty());
+    ASSERT_TRUE(session.synthesize());
+
+    // The cached syntheses of the replaced modules are dropped when parsing, before a later version could reuse the addresses of the replaced modules
+    for (const std::string changedInc: {"module inc(inout x(4))\n  ++= x; ++= x\n", "module inc(inout x(4))\n  --= x\n", "module inc(inout x(4))\n  ++= x; --= x; ++= x\n"}) {
+        ASSERT_TRUE(session.parse(changedInc + dec + main).empty());
+    }
+    const std::string lastInc = "module inc(inout x(4))\n  --= x; --= x\n";
+    ASSERT_TRUE(session.parse(lastInc + dec + main).empty());
+    ASSERT_TRUE(session.synthesize());
+    EXPECT_EQ(session.circuit().toQasm(), synthesizeFromScratch(lastInc + dec + main));
+}
+
+TEST_P(SyrecSynthesisSessionTest, ModulesAreParsedAgainIfTheirFirstLineMoved) {
+    SynthesisSession session(GetParam());
+    const auto       statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(session.parse(inc + dec + main).empty());
+
+    const std::string changedInc = "module inc(inout x(4))\n  ++= x;\n\n";
+    ASSERT_TRUE(session.parse(changedInc + dec + main, statistics).empty());
+    EXPECT_EQ(statistics->get<unsigned>("reparsed_modules"), 3U);
+    ASSERT_TRUE(session.program().findModule("main"));
+    EXPECT_EQ(session.program().findModule("main")->statements.front()->lineNumber, 7U);
+}
+
+TEST_P(SyrecSynthesisSessionTest, ErrorsAreReportedLikeForWholeProgram) {
+    SynthesisSession session(GetParam());
+    ASSERT_TRUE(session.parse(inc + dec + main).empty());
+
+    const std::string wrongMain = "module main(inout a(4), inout b(4))\n  call inc(a);\n  c ^= b\n";
+    EXPECT_EQ(session.parse(inc + dec + wrongMain), Program().readFromString(inc + dec + wrongMain));
+    EXPECT_EQ(session.parse(inc + dec + wrongMain), "In line 6: Unknown variable %sc");
+    EXPECT_EQ(session.parse(inc + dec + "module main("), "PARSE_STRING_FAILED");
+
+    // The last successfully parsed version of the program is kept
+    EXPECT_EQ(session.program().modules().size(), 3U);
+    ASSERT_TRUE(session.synthesize());
+    EXPECT_EQ(session.circuit().toQasm(), synthesizeFromScratch(inc + dec + main));
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    std::vector<TruthTable::Cube::Value> toValues(const std::string& str) {
+        std::vector<TruthTable::Cube::Value> values;
+        for (const auto c: str) {
+            values.emplace_back(TruthTable::Cube::getValue(c));
+        }
+        return values;
+    }
+} // namespace
+
+TEST(TruthTableCubeTest, OrderEqualsLexicographicalOrderOfValues) {
+    // cubes wider than the inline words are compared across multiple heap words
+    const std::string wide(150U, '1');
+    for (const auto& [lhs, rhs]: std::vector<std::pair<std::string, std::string>>{{"-", "0"}, {"0", "1"}, {"-1", "0-"}, {"01", "011"}, {"", "-"}, {"10-1", "10-1"}, {wide + "-", wide + "0"}, {wide + "0" + wide, wide + "1"}}) {
+        const auto lhsCube = TruthTable::Cube::fromString(lhs);
+        const auto rhsCube = TruthTable::Cube::fromString(rhs);
+        EXPECT_EQ(lhsCube < rhsCube, toValues(lhs) < toValues(rhs)) << lhs << " < " << rhs;
+        EXPECT_EQ(rhsCube < lhsCube, toValues(rhs) < toValues(lhs)) << rhs << " < " << lhs;
+        EXPECT_EQ(lhsCube == rhsCube, lhs == rhs);
+        EXPECT_EQ(lhsCube.toString(), lhs);
+    }
+}
+
+TEST(TruthTableCubeTest, IntegerConversion) {
+    const auto cube = TruthTable::Cube::fromInteger(0b1011U, 4U);
+    EXPECT_EQ(cube.toString(), "1011");
+    EXPECT_EQ(cube.toInteger(), 0b1011U);
+    EXPECT_EQ(cube.toBoolVec(), (std::vector<bool>{true, true, false, true}));
+    EXPECT_EQ(TruthTable::Cube::fromInteger(~0ULL, 64U).toInteger(), ~0ULL);
+    EXPECT_TRUE(TruthTable::Cube::fromInteger(0U, 0U).empty());
+}
+
+TEST(TruthTableCubeTest, PositionsAreAssignedLikeValues) {
+    auto cube = TruthTable::Cube::fromString("1-0");
+    cube[0]   = std::nullopt;
+    cube[1]   = true;
+    cube[2]   = cube[1];
+    EXPECT_EQ(cube.toString(), "-11");
+    EXPECT_FALSE(cube[0].has_value());
+    EXPECT_TRUE(*cube[2]);
+
+    cube.insertZero();
+    cube.pop_back();
+    EXPECT_EQ(cube, TruthTable::Cube::fromString("0-1"));
+    EXPECT_EQ(cube.appendOne().toString(), "0-11");
+    EXPECT_EQ(TruthTable::Cube(cube.begin() + 1, cube.end()).toString(), "-1");
+
+    cube.resize(130U, false);
+    cube.insertZero();
+    EXPECT_EQ(cube.size(), 131U);
+    EXPECT_EQ(cube.toString(), "00-1" + std::string(127U, '0'));
+    cube.resize(2U);
+    EXPECT_EQ(cube, TruthTable::Cube::fromString("00"));
+}
+
+TEST(TruthTableCubeTest, EqualityUpToDontCare) {
+    const auto cube = TruthTable::Cube::fromString("1-0" + std::string(100U, '-'));
+    EXPECT_TRUE(TruthTable::Cube::checkCubeEquality(cube, TruthTable::Cube::fromString("110" + std::string(100U, '1'))));
+    EXPECT_FALSE(TruthTable::Cube::checkCubeEquality(cube, TruthTable::Cube::fromString("111" + std::string(100U, '1'))));
+    EXPECT_FALSE(TruthTable::Cube::checkCubeEquality(cube, TruthTable::Cube::fromString("110" + std::string(100U, '1')), false));
+    EXPECT_TRUE(TruthTable::Cube::checkCubeEquality(cube, cube, false));
+}
+
+TEST(TruthTableCubeTest, CompleteCubes) {
+    const auto               completeCubes = TruthTable::Cube::fromString("-1-").completeCubes();
+    std::vector<std::string> strings;
+    for (const auto& cube: completeCubes) {
+        strings.emplace_back(cube.toString());
+    }
+    EXPECT_EQ(strings, (std::vector<std::string>{"010", "011", "110", "111"}));
+}
+
+TEST(TruthTableCubeTest, EqualCubesHaveEqualHashes) {
+    auto cube = TruthTable::Cube::fromString("1-0");
+    cube.resize(200U, true);
+    cube.resize(3U);
+    EXPECT_EQ(cube.hash(), TruthTable::Cube::fromString("1-0").hash());
+
+    const std::unordered_set<TruthTable::Cube, TruthTable::Cube::Hash> cubes{TruthTable::Cube::fromString("1-0"), TruthTable::Cube::fromString("1-1"), TruthTable::Cube::fromString("1-0")};
+    EXPECT_EQ(cubes.size(), 2U);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    std::vector<std::string> rows(const TruthTable& tt) {
+        std::vector<std::string> result;
+        for (const auto& [input, output]: tt) {
+            result.emplace_back(input.toString() + " " + output.toString());
+        }
+        return result;
+    }
+} // namespace
+
+class TruthTableStorageTest: public testing::TestWithParam<TruthTable::SparseStorage> {};
+
+INSTANTIATE_TEST_SUITE_P(TruthTableStorageTest, TruthTableStorageTest,
+                         testing::Values(TruthTable::SparseStorage::Map, TruthTable::SparseStorage::SortedVector),
+                         [](const testing::TestParamInfo<TruthTableStorageTest::ParamType>& info) {
+                             return info.param == TruthTable::SparseStorage::Map ? "Map" : "SortedVector"; });
+
+TEST_P(TruthTableStorageTest, RowsAreIteratedInOrderOfInputs) {
+    TruthTable tt(GetParam());
+    tt.try_emplace(TruthTable::Cube::fromString("1-"), TruthTable::Cube::fromString("1"));
+    tt.try_emplace(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("0"));
+    // the first row inserted with an input is kept
+    tt.try_emplace(TruthTable::Cube::fromString("1-"), TruthTable::Cube::fromString("0"));
+    tt.try_emplace(TruthTable::Cube::fromString("-0"), TruthTable::Cube::fromString("-"));
+
+    const auto& sparseTT = std::as_const(tt);
+    EXPECT_EQ(sparseTT.nInputs(), 2U);
+    EXPECT_EQ(sparseTT.nOutputs(), 1U);
+    EXPECT_EQ(sparseTT.size(), 3U);
+    EXPECT_EQ(rows(sparseTT), (std::vector<std::string>{"-0 -", "01 0", "1- 1"}));
+
+    // rows inserted after a read are merged on the next read
+    tt.try_emplace(TruthTable::Cube::fromString("00"), TruthTable::Cube::fromString("1"));
+    tt.try_emplace(TruthTable::Cube::fromString("01"), TruthTable::Cube::fromString("1"));
+    EXPECT_EQ(rows(sparseTT), (std::vector<std::string>{"-0 -", "00 1", "01 0", "1- 1"}));
+
+    const auto it = sparseTT.find("01");
+    ASSERT_NE(it, sparseTT.end());
+    EXPECT_EQ(it->second.toString(), "0");
+    EXPECT_EQ(sparseTT.find("11"), sparseTT.end());
+    EXPECT_EQ(sparseTT.getSparseStorage(), GetParam());
+}
+
+TEST_P(TruthTableStorageTest, MutableAccessConvertsToMapStorage) {
+    TruthTable tt(GetParam());
+    tt.try_emplace(TruthTable::Cube::fromString("10"), TruthTable::Cube::fromString("1"));
+    tt.try_emplace(TruthTable::Cube::fromString("0-"), TruthTable::Cube::fromString("0"));
+
+    TruthTable mapTT;
+    mapTT.try_emplace(TruthTable::Cube::fromString("0-"), TruthTable::Cube::fromString("0"));
+    mapTT.try_emplace(TruthTable::Cube::fromString("10"), TruthTable::Cube::fromString("1"));
+    EXPECT_EQ(tt, mapTT);
+
+    tt[TruthTable::Cube::fromString("11")] = TruthTable::Cube::fromString("1");
+    EXPECT_EQ(tt.getSparseStorage(), TruthTable::SparseStorage::Map);
+    EXPECT_EQ(rows(tt), (std::vector<std::string>{"0- 0", "10 1", "11 1"}));
+
+    tt.setSparseStorage(GetParam());
+    EXPECT_EQ(tt.getSparseStorage(), GetParam());
+    EXPECT_EQ(rows(tt), (std::vector<std::string>{"0- 0", "10 1", "11 1"}));
+}
+
+TEST(TruthTableStorageTest, ParsedCubesAreCollectedInSortedVector) {
+    TruthTable         tt;
+    std::istringstream is(".i 2\n.o 1\n1- 1\n00 0\n1- 0\n");
+    parsePla(tt, is);
+    EXPECT_EQ(tt.getSparseStorage(), TruthTable::SparseStorage::SortedVector);
+    EXPECT_EQ(rows(tt), (std::vector<std::string>{"00 0", "1- 1"}));
+
+    extend(tt);
+    EXPECT_TRUE(tt.isDense());
+    EXPECT_EQ(rows(tt), (std::vector<std::string>{"00 0", "01 0", "10 1", "11 1"}));
+}
@@ -17,8 +17,12 @@
 #include "ir/operations/OpType.hpp"
 #include "ir/operations/StandardOperation.hpp"
 
+#include <array>
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <memory>
+#include <random>
+#include <sstream>
 #include <string>
 
 using namespace qc::literals;
@@ -82,3 +86,64 @@ TEST_F(TruthTableDD, Toffoli) {
     const auto toffoli = qc::StandardOperation({1_pc, 2_pc}, 0, qc::X);
     EXPECT_TRUE(ttDD == dd::getDD(toffoli, *dd));
 }
+
+TEST_F(TruthTableDD, CubesWithoutExtension) {
+    // overlapping cubes, the 1's of the complete cube are added to the output of the preceding cube
+    std::istringstream is(".i 3\n.o 3\n1-- 100\n11- 010\n111 001\n0-1 -1-\n");
+    parsePla(tt, is);
+    TruthTable extendedTT = tt;
+    extend(extendedTT);
+
+    const auto ttDD = buildDDFromCubes(tt, dd);
+    EXPECT_TRUE(ttDD.p != nullptr);
+    EXPECT_TRUE(ttDD == buildDD(extendedTT, dd));
+}
+
+TEST_F(TruthTableDD, RandomCubesWithoutExtension) {
+    constexpr std::size_t maxBits  = 7U;
+    auto                  randomDD = std::make_unique<dd::Package>(maxBits);
+    std::mt19937          generator(7U);
+
+    for (std::size_t iteration = 0U; iteration < 1000U; ++iteration) {
+        // random, possibly overlapping cubes with don't care inputs and outputs
+        const auto         nBits  = 1U + (generator() % maxBits);
+        const auto         nCubes = 1U + (generator() % 12U);
+        std::ostringstream pla;
+        pla << ".i " << nBits << "\n.o " << nBits << "\n";
+        for (std::size_t cube = 0U; cube < nCubes; ++cube) {
+            for (std::size_t i = 0U; i < nBits; ++i) {
+                pla << "01-"[generator() % 3U];
+            }
+            pla << ' ';
+            for (std::size_t i = 0U; i < nBits; ++i) {
+                pla << "0101-"[generator() % 5U];
+            }
+            pla << '\n';
+        }
+
+        TruthTable         cubes;
+        std::istringstream is(pla.str());
+        parsePla(cubes, is);
+        TruthTable extendedTT = cubes;
+        extend(extendedTT);
+
+        EXPECT_TRUE(buildDDFromCubes(cubes, randomDD) == buildDD(extendedTT, randomDD)) << pla.str();
+    }
+}
+
+TEST_F(TruthTableDD, WideCubesWithoutExtension) {
+    constexpr std::size_t nBits = 40U;
+    std::istringstream    is(".i 40\n.o 40\n1" + std::string(nBits - 1U, '-') + " 1" + std::string(nBits - 1U, '0') + "\n");
+    parsePla(tt, is);
+
+    auto       wideDD = std::make_unique<dd::Package>(nBits);
+    const auto ttDD   = buildDDFromCubes(tt, wideDD);
+
+    // the most significant input is copied to the most significant output, all other outputs are zero
+    auto expected = dd::mEdge::one();
+    for (std::size_t i = 0U; i < nBits - 1U; ++i) {
+        expected = wideDD->makeDDNode(static_cast<dd::Qubit>(i), std::array{expected, expected, dd::mEdge::zero(), dd::mEdge::zero()});
+    }
+    expected = wideDD->makeDDNode(static_cast<dd::Qubit>(nBits - 1U), std::array{expected, dd::mEdge::zero(), dd::mEdge::zero(), expected});
+    EXPECT_TRUE(ttDD == expected);
+}